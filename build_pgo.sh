@@ -0,0 +1,218 @@
+#!/bin/bash
+
+# ============================================================================
+# Giant Instruments Profile-Guided Optimization Build Script
+# ============================================================================
+#
+# 1. Baseline build     (GIANT_PGO=OFF)       - benchmark reference
+# 2. Instrumented build (GIANT_PGO=GENERATE)  - run the training workload
+# 3. Merge profiles     (llvm-profdata)
+# 4. Optimized build    (GIANT_PGO=USE)       - DSP and all plugin formats
+# 5. Benchmark baseline vs. optimized and report the speedup
+#
+# Requires Clang / AppleClang (profiles are merged with llvm-profdata).
+#
+# Usage: ./build_pgo.sh [clean] [--seconds <training seconds per preset>]
+#
+# ============================================================================
+
+set -e  # Exit on error
+
+# ============================================================================
+# Configuration
+# ============================================================================
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+PGO_ROOT="${SCRIPT_DIR}/.build/pgo"
+BASELINE_DIR="${PGO_ROOT}/baseline"
+GENERATE_DIR="${PGO_ROOT}/generate"
+USE_DIR="${PGO_ROOT}/use"
+PROFILE_DIR="${PGO_ROOT}/profiles"
+TRAINING_SECONDS=6
+
+# Colors for output
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+BLUE='\033[0;34m'
+NC='\033[0m' # No Color
+
+# ============================================================================
+# Functions
+# ============================================================================
+
+log_info() {
+    echo -e "${BLUE}[INFO]${NC} $1"
+}
+
+log_success() {
+    echo -e "${GREEN}[SUCCESS]${NC} $1"
+}
+
+log_warning() {
+    echo -e "${YELLOW}[WARNING]${NC} $1"
+}
+
+log_error() {
+    echo -e "${RED}[ERROR]${NC} $1"
+}
+
+print_banner() {
+    echo ""
+    echo "============================================================================"
+    echo "  Giant Instruments PGO Build Script"
+    echo "============================================================================"
+    echo ""
+}
+
+num_jobs() {
+    if [[ "$OSTYPE" == "darwin"* ]]; then
+        sysctl -n hw.ncpu
+    else
+        getconf _NPROCESSORS_ONLN
+    fi
+}
+
+find_profdata() {
+    if [[ "$OSTYPE" == "darwin"* ]] && xcrun --find llvm-profdata &> /dev/null; then
+        echo "xcrun llvm-profdata"
+    elif command -v llvm-profdata &> /dev/null; then
+        echo "llvm-profdata"
+    else
+        echo ""
+    fi
+}
+
+# Locate the GiantPgoTraining binary inside a build tree
+find_training_binary() {
+    find "$1" -type f -name "GiantPgoTraining" -perm -u+x | head -n 1
+}
+
+# ============================================================================
+# Pre-flight Checks
+# ============================================================================
+
+check_prerequisites() {
+    log_info "Checking prerequisites..."
+
+    if ! command -v cmake &> /dev/null; then
+        log_error "CMake not found. Please install CMake."
+        exit 1
+    fi
+
+    PROFDATA="$(find_profdata)"
+    if [ -z "$PROFDATA" ]; then
+        log_error "llvm-profdata not found. PGO requires a Clang toolchain."
+        exit 1
+    fi
+
+    log_success "Prerequisites check passed (profdata: ${PROFDATA})"
+}
+
+# ============================================================================
+# Build Stages
+# ============================================================================
+
+# configure_and_build <build dir> <PGO stage> <targets...>
+configure_and_build() {
+    local build_dir="$1"
+    local stage="$2"
+    shift 2
+
+    log_info "Configuring ${stage} build..."
+    cmake -S "${SCRIPT_DIR}" -B "${build_dir}" \
+        -DCMAKE_BUILD_TYPE=Release \
+        -DGIANT_PGO="${stage}" \
+        -DGIANT_PGO_PROFILE_DIR="${PROFILE_DIR}"
+
+    for target in "$@"; do
+        log_info "Building ${target} (${stage})..."
+        cmake --build "${build_dir}" --config Release --target "${target}" --parallel "$(num_jobs)"
+    done
+
+    log_success "${stage} build complete"
+}
+
+# run_benchmark <build dir> -> prints total render time in ms
+run_benchmark() {
+    local binary
+    binary="$(find_training_binary "$1")"
+
+    if [ -z "$binary" ]; then
+        log_error "GiantPgoTraining not found in $1"
+        exit 1
+    fi
+
+    "$binary" --seconds "${TRAINING_SECONDS}" | tee /dev/stderr | awk '/^TOTAL_RENDER_MS/ { print $2 }'
+}
+
+train() {
+    log_info "Running training workload on the instrumented build..."
+
+    rm -rf "${PROFILE_DIR}"
+    mkdir -p "${PROFILE_DIR}"
+
+    run_benchmark "${GENERATE_DIR}" > /dev/null
+
+    log_info "Merging profiles..."
+    ${PROFDATA} merge -output="${PROFILE_DIR}/giant.profdata" "${PROFILE_DIR}"/*.profraw
+
+    log_success "Profile written to ${PROFILE_DIR}/giant.profdata"
+}
+
+report_speedup() {
+    log_info "Benchmarking baseline build..."
+    local baseline_ms
+    baseline_ms="$(run_benchmark "${BASELINE_DIR}")"
+
+    log_info "Benchmarking PGO build..."
+    local pgo_ms
+    pgo_ms="$(run_benchmark "${USE_DIR}")"
+
+    echo ""
+    echo "============================================================================"
+    echo "  PGO Benchmark"
+    echo "============================================================================"
+    awk -v base="${baseline_ms}" -v pgo="${pgo_ms}" 'BEGIN {
+        printf "  Baseline render: %10.2f ms\n", base
+        printf "  PGO render:      %10.2f ms\n", pgo
+        printf "  Speedup:         %10.2fx\n", base / pgo
+    }'
+    echo "============================================================================"
+    echo ""
+}
+
+# ============================================================================
+# Main Build Process
+# ============================================================================
+
+main() {
+    print_banner
+
+    while [ $# -gt 0 ]; do
+        case "$1" in
+            clean)
+                log_info "Cleaning PGO build directories..."
+                rm -rf "${PGO_ROOT}"
+                ;;
+            --seconds)
+                TRAINING_SECONDS="$2"
+                shift
+                ;;
+        esac
+        shift
+    done
+
+    check_prerequisites
+
+    configure_and_build "${BASELINE_DIR}" OFF GiantPgoTraining
+    configure_and_build "${GENERATE_DIR}" GENERATE GiantPgoTraining GiantInstruments_All
+    train
+    configure_and_build "${USE_DIR}" USE GiantPgoTraining GiantInstruments_All
+    report_speedup
+
+    log_success "PGO build complete! Optimized plugins are in ${USE_DIR}"
+}
+
+# Run main function
+main "$@"
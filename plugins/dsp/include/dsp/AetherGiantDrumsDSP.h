@@ -0,0 +1,771 @@
+/*
+  ==============================================================================
+
+   AetherGiantDrumsDSP.h
+   Giant Drum Synthesizer (Seismic Membranes)
+
+   Physical modeling of giant-scale drums with:
+   - SVF-based membrane resonator (2-6 primary modes with tension/diameter scaling)
+   - Bidirectional shell/cavity coupling (Helmholtz resonator model)
+   - Nonlinear loss/saturation (prevents sterile modal ringing)
+   - Room coupling (early reflections, "huge room" feel)
+   - Kit map: a drum definition per MIDI note, coefficients precomputed
+
+   Preset archetypes:
+   - Titan Taiko - huge membrane, slow bloom, long room tail
+   - Seismic Kick - tight tension, massive shell cavity
+   - Thunder Tom - pitched membrane, strong shell formant
+   - War Drum - heavy saturation, brutal transient
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherGiantBase.h"
+#include "dsp/InstrumentDSP.h"
+#include "dsp/GiantAdaa.h"
+#include "dsp/GiantCpuBudget.h"
+#include "dsp/GiantMeterFeed.h"
+#include "dsp/GiantModMatrix.h"
+#include "dsp/GiantModeDetail.h"
+#include "dsp/GiantRenderProfile.h"
+#include "dsp/GiantVoiceWarmUp.h"
+#include <juce_dsp/juce_dsp.h>
+#include <vector>
+#include <array>
+#include <memory>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Single membrane mode using a State Variable Filter
+ *
+ * Each mode is a 2nd-order resonant filter (TPT structure, Andy Simper's
+ * trapezoidal integrator design) driven by strike energy. The bandpass output
+ * is scaled by a decaying energy envelope that models air damping and
+ * membrane loss.
+ */
+struct SVFMembraneMode
+{
+    float frequency = 100.0f;       // Mode frequency (Hz)
+    float qFactor = 50.0f;          // Quality factor (resonance)
+    float amplitude = 1.0f;         // Mode amplitude
+
+    // Long-decay state is kept in double: at decay ~0.9999 a float energy
+    // envelope and integrators drift audibly over multi-second giant tails
+    double decay = 0.999;           // Energy decay coefficient
+    double energy = 0.0;            // Current energy level
+
+    // SVF state
+    double z1 = 0.0;                // Integrator states
+    double z2 = 0.0;
+    float frequencyFactor = 0.0f;   // Pre-calculated g parameter
+    float resonance = 0.0f;         // Filter resonance
+
+    // Coefficient cache (only recalculate when frequency/Q change)
+    float cachedFrequency = -1.0f;
+    float cachedQFactor = -1.0f;
+    bool coefficientsDirty = true;
+
+    double sampleRate = 48000.0;
+
+    void prepare(double sr);
+    float processSample(float excitation);
+    void reset();
+    void calculateCoefficients();
+};
+
+//==============================================================================
+/**
+ * Membrane resonator
+ *
+ * Models a circular drum membrane as a bank of SVF modes tuned to the
+ * Bessel-function roots of the (m,n) membrane modes.
+ */
+class MembraneResonator
+{
+public:
+    struct Parameters
+    {
+        float fundamentalFrequency = 80.0f;  // Fundamental (0,1) mode (Hz)
+        float tension = 0.5f;                // Membrane tension (0.0 - 1.0)
+        float diameterMeters = 1.5f;         // Drum diameter (larger = lower, longer)
+        float damping = 0.995f;              // Base energy decay per sample
+        float inharmonicity = 0.1f;          // Mode stretch (nonlinear membrane)
+        int numModes = 4;                    // Active SVF modes (2-6)
+    };
+
+    static constexpr int maxModes = 6;
+
+    /** Mode coefficients derived from Parameters, built off the note-on path */
+    struct Setup
+    {
+        struct Mode
+        {
+            float frequency = 100.0f;
+            float qFactor = 50.0f;
+            float amplitude = 1.0f;
+            float frequencyFactor = 0.0f;
+            float resonance = 0.0f;
+            double decay = 0.999;
+        };
+
+        Parameters params;
+        std::array<Mode, maxModes> modes {};
+    };
+
+    MembraneResonator();
+    ~MembraneResonator() = default;
+
+    void prepare(double sampleRate);
+    void reset();
+
+    /** Strike the membrane
+        @param velocity    Strike velocity (0.0 - 1.0)
+        @param force       Strike force (affects initial energy)
+        @param contactArea Size of striking surface */
+    void strike(float velocity, float force, float contactArea);
+
+    /** Process membrane
+        @param excitation   Drive into every active mode (sympathetic coupling)
+        @returns            Summed output from all active modes */
+    float processSample(float excitation = 0.0f);
+
+    void setParameters(const Parameters& p);
+    Parameters getParameters() const { return params; }
+
+    /** Derive mode frequencies, SVF coefficients and decays (no side effects)
+        @param p            Membrane parameters
+        @param sampleRate   Sample rate the coefficients are computed for
+        @returns            Setup ready for loadSetup() */
+    static Setup makeSetup(const Parameters& p, double sampleRate);
+
+    /** Load precomputed coefficients (copies only, no math: note-on safe) */
+    void loadSetup(const Setup& setup);
+
+    /** Get total energy (for decay detection and voice stealing) */
+    float getEnergy() const;
+
+    /** Limit processing to the lowest N modes (CPU budget level of detail) */
+    void setModeLimit(int limit);
+    int getModeLimit() const { return modeLimit; }
+
+    /** Number of active modes below a frequency (level of detail air cutoff) */
+    int countModesBelow(float frequencyHz) const;
+
+    /** Frequency of the (0,1) mode (Hz) */
+    float getFundamental() const { return svfModes[0].frequency; }
+
+    /** Drop top modes whose energy has fallen below maskingRatio times the
+        strongest rendered mode (level of detail over the tail)
+        @returns    The new mode limit */
+    int trimMaskedModes(float maskingRatio);
+
+private:
+    Parameters params;
+    std::vector<SVFMembraneMode> svfModes;
+    int modeLimit = 6;
+
+    double sr = 48000.0;
+    float totalEnergy = 0.0f;
+    float strikeEnergy = 0.0f;
+
+};
+
+//==============================================================================
+/**
+ * Coupled shell/cavity resonator
+ *
+ * Bidirectional coupling between a mass-spring-damper shell and a Helmholtz
+ * cavity. Shell vibration drives cavity pressure and cavity pressure pushes
+ * back on the shell, giving the natural pitch envelope of a real drum body.
+ */
+class CoupledResonator
+{
+public:
+    struct Parameters
+    {
+        float cavityFrequency = 120.0f;  // Helmholtz resonance (Hz)
+        float shellFormant = 300.0f;     // Shell resonance (Hz)
+        float cavityQ = 0.7f;            // Cavity resonance Q
+        float shellQ = 0.5f;             // Shell resonance Q
+        float coupling = 0.3f;           // Membrane -> shell coupling (0.0 - 1.0)
+
+        // Derived physical coefficients (see deriveCoefficients)
+        float cavityMass = 1.0f;
+        float cavityStiffness = 0.0f;
+        float cavityDamping = 0.0f;
+        float shellMass = 1.0f;
+        float shellStiffness = 0.0f;
+        float shellDamping = 0.0f;
+        float cavityToShellCoupling = 0.0f;
+        float shellToCavityCoupling = 0.0f;
+        float shellMix = 0.4f;
+        float cavityMix = 0.6f;
+    };
+
+    CoupledResonator() = default;
+    ~CoupledResonator() = default;
+
+    void prepare(double sampleRate);
+    void reset();
+
+    /** Process coupled system
+        @param membraneInput    Energy arriving from the membrane
+        @returns                Mixed shell/cavity output */
+    float processSample(float membraneInput);
+
+    void setParameters(const Parameters& p);
+
+    /** Load parameters whose physical coefficients are already derived */
+    void setDerivedParameters(const Parameters& p) { params = p; }
+
+    /** Fill in the physical coefficients (masses, stiffness, damping, coupling)
+        from the frequency/Q fields */
+    static void deriveCoefficients(Parameters& p);
+
+private:
+    Parameters params;
+
+    float cavityPressure = 0.0f;
+    float cavityVelocity = 0.0f;
+    float shellDisplacement = 0.0f;
+    float shellVelocity = 0.0f;
+
+    double sr = 48000.0;
+};
+
+//==============================================================================
+/**
+ * Shell resonator
+ *
+ * Wraps the coupled shell/cavity model and feeds it membrane energy.
+ */
+class ShellResonator
+{
+public:
+    struct Parameters
+    {
+        float cavityFrequency = 120.0f;  // Cavity resonance (Hz)
+        float shellFormant = 300.0f;     // Shell formant (Hz)
+        float cavityQ = 0.7f;            // Cavity Q
+        float shellQ = 0.5f;             // Shell Q
+        float coupling = 0.3f;           // Membrane/shell coupling (0.0 - 1.0)
+    };
+
+    /** Parameters plus their derived coupled-resonator coefficients */
+    struct Setup
+    {
+        Parameters params;
+        CoupledResonator::Parameters coupled;
+    };
+
+    ShellResonator();
+    ~ShellResonator() = default;
+
+    void prepare(double sampleRate);
+    void reset();
+
+    /** Feed membrane energy into the shell */
+    void processMembraneEnergy(float membraneEnergy);
+
+    /** Process shell
+        @returns    Shell/cavity output */
+    float processSample();
+
+    void setParameters(const Parameters& p);
+
+    /** Derive coupled-resonator coefficients (no side effects) */
+    static Setup makeSetup(const Parameters& p);
+
+    /** Load precomputed coefficients (copies only, note-on safe) */
+    void loadSetup(const Setup& setup);
+
+private:
+    Parameters params;
+    CoupledResonator coupledResonator;
+
+    float lastMembraneEnergy = 0.0f;
+
+    double sr = 48000.0;
+};
+
+//==============================================================================
+/**
+ * Nonlinear loss/saturation
+ *
+ * Keeps the modal ringing from sounding sterile:
+ * - Soft saturation on loud hits
+ * - Level/velocity-dependent damping
+ * - Mass effect (heavier drums lose more energy on hard strikes)
+ */
+class DrumNonlinearLoss
+{
+public:
+    DrumNonlinearLoss();
+    ~DrumNonlinearLoss() = default;
+
+    void prepare(double sampleRate);
+    void reset();
+
+    /** Apply nonlinear loss
+        @param input       Dry signal
+        @param velocity    Strike velocity (0.0 - 1.0)
+        @returns           Saturated, damped signal */
+    float processSample(float input, float velocity);
+
+    void setSaturationAmount(float amount);
+    void setMassEffect(float mass);
+
+private:
+    float saturationAmount = 0.1f;
+    float massEffect = 0.5f;
+
+    // Cubic soft clip, antiderivative anti-aliased (no oversampling needed)
+    GiantAdaa<GiantAdaaShapes::Cubic> softClip;
+
+    double sr = 48000.0;
+
+    float calculateDynamicDamping(float level, float velocity) const;
+};
+
+//==============================================================================
+/**
+ * Room coupling
+ *
+ * Early reflection delay plus an 8-line feedback delay network for the
+ * "huge room" feel of a giant drum. The lines are mixed by an orthogonal
+ * Hadamard matrix and each has its own loop gain and one-pole damping, set
+ * so the tail decays by exactly 60 dB in reverbTime at DC and in
+ * reverbTime * hfDecayRatio at Nyquist. All eight lines are filtered and
+ * mixed in one 8-lane SIMD pass; delay buffers are powers of two so wrap
+ * is a mask.
+ */
+class DrumRoomCoupling
+{
+public:
+    static constexpr int numLines = 8;  // FDN size (one 8-lane pass)
+
+    struct Parameters
+    {
+        float roomSize = 0.7f;        // Room mix (0.0 = dry, 1.0 = huge)
+        float reflectionGain = 0.3f;  // Early reflection and tail level
+        float reverbTime = 2.0f;      // Tail T60 (seconds, exact at DC)
+        float preDelayMs = 5.0f;      // Early reflection delay (ms, up to 100)
+        float hfDecayRatio = 0.5f;    // T60 at Nyquist as a fraction of reverbTime
+    };
+
+    DrumRoomCoupling() = default;
+    ~DrumRoomCoupling() = default;
+
+    /** Allocate delay buffers (the only allocating call) */
+    void prepare(double sampleRate);
+    void reset();
+
+    /** Process room coupling
+        @param input    Dry drum signal
+        @returns        Signal with room */
+    float processSample(float input);
+
+    /** Update mix and decay coefficients (no allocation, tail keeps ringing) */
+    void setParameters(const Parameters& p);
+
+    /** Limit the tail to the first N delay lines (CPU budget level of detail).
+        Rounded down to a power of two so the Hadamard mix stays orthogonal. */
+    void setActiveLines(int lines);
+    int getActiveLines() const { return activeLines; }
+
+private:
+    static constexpr float maxPreDelayMs = 100.0f;
+
+    Parameters params;
+
+    // Early reflection ring buffer (power-of-two size)
+    std::vector<float> earlyBuffer;
+    uint32_t earlyMask = 0;
+    uint32_t earlyDelay = 1;
+
+    // FDN lines share one allocation; each is a power-of-two ring buffer
+    std::vector<float> lineBuffer;
+    std::array<uint32_t, numLines> lineOffset {};
+    std::array<uint32_t, numLines> lineMask {};
+    std::array<uint32_t, numLines> lineDelay {};
+    uint32_t writePosition = 0;     // Shared by all lines and the early buffer
+
+    // Per-line loop filter: state = feed * delayed + pole * state
+    alignas(32) std::array<float, numLines> lineFeed {};
+    alignas(32) std::array<float, numLines> linePole {};
+    alignas(32) std::array<float, numLines> lineState {};
+
+    int activeLines = numLines;
+    float lineInputGain = 0.35355339f;  // 1 / sqrt(activeLines), keeps injected energy constant
+    double sr = 48000.0;
+
+    void updateDecay();
+    void mixReducedLines(float* lanes) const;
+};
+
+//==============================================================================
+/**
+ * One drum of a kit, as the user describes it
+ */
+struct DrumDefinition
+{
+    float fundamentalFrequency = 80.0f;  // (0,1) mode before diameter/tension scaling (Hz)
+    float diameterMeters = 1.5f;         // Drum diameter (larger = lower, longer)
+    float tension = 0.5f;                // Membrane tension (0.5 = nominal pitch)
+    float damping = 0.995f;              // Base energy decay per sample
+    float inharmonicity = 0.1f;          // Mode stretch
+    int numModes = 4;                    // Membrane modes (2-6)
+    ShellResonator::Parameters shell;
+    float saturationAmount = 0.1f;
+    float massEffect = 0.5f;
+    int chokeGroup = 0;                  // 0 = none; a hit silences the group's other voices
+};
+
+//==============================================================================
+/**
+ * Kit map
+ *
+ * A DrumDefinition per MIDI note and its precomputed voice setup (membrane
+ * SVF coefficients, coupled shell/cavity coefficients, nonlinear settings).
+ * Setups are rebuilt when a definition or the sample rate changes, never at
+ * note-on, so a trigger only copies coefficients whatever the kit.
+ */
+class DrumKitMap
+{
+public:
+    static constexpr int numNotes = 128;
+
+    struct DrumSetup
+    {
+        MembraneResonator::Setup membrane;
+        ShellResonator::Setup shell;
+        float saturationAmount = 0.1f;
+        float massEffect = 0.5f;
+        int chokeGroup = 0;
+    };
+
+    DrumKitMap();
+
+    /** Rebuild every setup for a new sample rate (allocation free) */
+    void prepare(double sampleRate);
+
+    /** Define one drum and rebuild its setup (note clamped to 0-127) */
+    void setDrum(int note, const DrumDefinition& drum);
+
+    const DrumDefinition& getDrum(int note) const;
+    const DrumSetup& getSetup(int note) const;
+
+    /** Derive a setup from a definition */
+    static DrumSetup makeSetup(const DrumDefinition& drum, double sampleRate);
+
+private:
+    std::vector<DrumDefinition> definitions;
+    std::vector<DrumSetup> setups;
+    double sr = 48000.0;
+};
+
+//==============================================================================
+/**
+ * Single giant drum voice
+ */
+struct GiantDrumVoice
+{
+    int midiNote = -1;
+    float velocity = 0.0f;
+    bool active = false;
+    bool prepared = false;      // Adopted by the audio thread (lazy, see GiantVoiceWarmUp)
+    std::atomic<bool> ready { false };     // Resonators built and published
+    int detailModes = 0;        // Level-of-detail mode count (GiantModeDetail)
+    int detailCountdown = 0;    // Samples until the next tail trim
+    bool trimTail = true;       // Tail level of detail (off for offline renders)
+
+    // Choke: a hit in the same group fades this voice to chokeFloor over chokeTimeSeconds
+    static constexpr float chokeTimeSeconds = 0.015f;
+    static constexpr float chokeFloor = 0.0001f;  // -80 dB, voice retired
+    int chokeGroup = 0;
+    bool choking = false;
+    float chokeGain = 1.0f;
+    float chokeDecay = 0.0f;    // Per-sample gain multiplier while choking
+
+    // Sympathetic coupling (see GiantDrumVoiceManager::updateCouplings)
+    float membraneOutput = 0.0f;    // Last membrane sample, drives coupled voices
+    float sympatheticInput = 0.0f;  // Drive from other voices for this sample (set by the manager)
+
+    // DSP components
+    MembraneResonator membrane;
+    ShellResonator shell;
+    DrumNonlinearLoss nonlinear;
+
+    // Gesture of the current hit
+    GiantGestureParameters gesture;
+
+    void prepare(double sampleRate);
+    void reset();
+    void trigger(int note, float vel, const GiantGestureParameters& gesture,
+                 const DrumKitMap::DrumSetup& setup, const GiantModeDetail::Context& detail);
+    void choke();
+    float processSample();
+    bool isActive() const;
+};
+
+//==============================================================================
+/**
+ * Giant Drum voice manager
+ *
+ * Manages polyphonic drum voices (typically 8-16 voices).
+ * Steals the quietest voice (lowest membrane energy) when full.
+ */
+class GiantDrumVoiceManager
+{
+public:
+    GiantDrumVoiceManager();
+    ~GiantDrumVoiceManager() = default;
+
+    void prepare(double sampleRate, int maxVoices = 16);
+    void reset();
+
+    GiantDrumVoice* findFreeVoice();
+    GiantDrumVoice* findVoiceForNote(int note);
+
+    void handleNoteOn(int note, float velocity, const GiantGestureParameters& gesture,
+                      const GiantScaleParameters& scale);
+    void handleNoteOff(int note);
+    void allNotesOff();
+
+    float processSample();
+    int getActiveVoiceCount() const;
+
+    /** Per-voice level for the meter feed (see GiantMeterSource) */
+    int getVoiceEnergies(float* energies, int maxVoices) const;
+
+    /** Define the drum played by a MIDI note (rebuilds that note's setup) */
+    void setDrum(int note, const DrumDefinition& drum) { kit.setDrum(note, drum); }
+    const DrumKitMap& getKit() const { return kit; }
+
+    void setRoomParameters(const DrumRoomCoupling::Parameters& params);
+
+    /** Apply CPU budget quality: trim modes and room lines, retire the quietest */
+    void applyQuality(const GiantCpuBudget& budget);
+
+    /** Listener distance for the level-of-detail air cutoff (meters) */
+    void setListenerDistance(float meters) { listenerDistance = meters; }
+
+    /** Offline profile: new hits keep every mode for their whole tail */
+    void setFullDetail(bool enabled) { fullDetail = enabled; }
+
+    /** Modulation matrix the voices follow (owned by the engine, nullptr = none) */
+    void setModMatrix(GiantModMatrix* matrix) { modulation = matrix; }
+
+    /** Sympathetic coupling amount (0.0 = off, 1.0 = strong) */
+    void setSympatheticCoupling(float amount) { sympatheticAmount = juce::jlimit(0.0f, 1.0f, amount); }
+
+    /** Rebuild the sparse voice-to-voice coupling matrix (once per block).
+        The drive itself is mixed once per couplingHop samples, not per sample */
+    void updateCouplings();
+
+    /** Prepare up to maxVoices cold voices
+        @returns    Number of voices still cold */
+    int warmUp(int maxVoices);
+    int getPreparedVoiceCount() const;
+
+private:
+    std::vector<std::unique_ptr<GiantDrumVoice>> voices;
+    double currentSampleRate = 48000.0;
+
+    // Voices prepared eagerly in prepare(); the rest only through warmUp()
+    static constexpr int eagerVoices = 4;
+
+    // Per-note drums; voices load their setup on trigger
+    DrumKitMap kit;
+    DrumRoomCoupling::Parameters roomParams;
+    float listenerDistance = 10.0f;
+    bool fullDetail = false;
+    GiantModMatrix* modulation = nullptr;
+
+    // One room for all voices: it is linear, so the summed dry signal through
+    // a single FDN equals per-voice rooms, and tails outlive their voices
+    DrumRoomCoupling room;
+
+    // Sparse coupling matrix: each active voice is driven by at most
+    // maxCouplingsPerVoice sounding voices, weighted by pitch proximity
+    struct Coupling
+    {
+        int source = 0;
+        int target = 0;
+        float gain = 0.0f;
+    };
+
+    static constexpr int maxCouplingsPerVoice = 3;
+    static constexpr float maxCouplingGain = 0.2f;    // Gain at amount 1.0, unison pitch
+    static constexpr float minCouplingWeight = 0.1f;  // Pitch proximity below this is ignored
+
+    std::vector<Coupling> couplings;    // Capacity reserved in prepare()
+    float sympatheticAmount = 0.0f;
+
+    // Coupling runs in fixed hops (independent of the host block size): a
+    // source's membrane output over one hop, weighted, drives its targets
+    // over the next. The 64-sample delay (1.3 ms at 48 kHz) is well under
+    // the acoustic path between giant drums.
+    static constexpr int couplingHop = 64;
+    std::vector<float> couplingHistory;     // [voice * couplingHop + sample], this hop's output
+    std::vector<float> couplingDrive;       // [voice * couplingHop + sample], this hop's input
+    int couplingPosition = 0;
+    bool couplingDriveActive = false;       // Drive buffers hold something this hop
+
+    /** End of a hop: mix every coupling's history into the next hop's drive */
+    void advanceCouplingHop();
+
+    void prepareVoice(GiantDrumVoice& voice);
+    int indexOf(const GiantDrumVoice* voice) const;
+};
+
+//==============================================================================
+/**
+ * Main Aether Giant Drums Pure DSP Instrument
+ */
+class AetherGiantDrumsPureDSP : public InstrumentDSP,
+                                public GiantVoiceWarmUp,
+                                public GiantMeterSource,
+                                public GiantRenderProfileTarget,
+                                public GiantModulationTarget
+{
+public:
+    AetherGiantDrumsPureDSP();
+    ~AetherGiantDrumsPureDSP() override;
+
+    //==============================================================================
+    // InstrumentDSP interface
+    bool prepare(double sampleRate, int blockSize) override;
+    void reset() override;
+    void process(float** outputs, int numChannels, int numSamples) override;
+    void handleEvent(const ScheduledEvent& event) override;
+
+    float getParameter(const char* paramId) const override;
+    void setParameter(const char* paramId, float value) override;
+
+    bool savePreset(char* jsonBuffer, int jsonBufferSize) const override;
+    bool loadPreset(const char* jsonData) override;
+
+    int getActiveVoiceCount() const override;
+    int getMaxPolyphony() const override { return maxVoices_; }
+
+    const GiantCpuBudget& getCpuBudget() const { return cpuBudget_; }
+
+    //==============================================================================
+    // GiantVoiceWarmUp interface
+    int warmUpVoices(int maxVoices) override { return voiceManager_.warmUp(maxVoices); }
+    int getPreparedVoiceCount() const override { return voiceManager_.getPreparedVoiceCount(); }
+
+    //==============================================================================
+    // GiantMeterSource interface
+    int getVoiceEnergies(float* energies, int maxVoices) const override
+    {
+        return voiceManager_.getVoiceEnergies(energies, maxVoices);
+    }
+
+    //==============================================================================
+    // GiantRenderProfileTarget interface
+    void setRenderProfile(GiantRenderProfile profile) override;
+
+    //==============================================================================
+    // GiantModulationTarget interface (level only: membrane pitch is baked into
+    // each hit's coefficients)
+    bool supportsModDestination(GiantModDestination destination) const override
+    {
+        return destination == GiantModDestination::Level;
+    }
+    GiantModMatrix& getModMatrix() override { return modMatrix_; }
+
+    const char* getInstrumentName() const override { return "AetherGiantDrums"; }
+    const char* getInstrumentVersion() const override { return "2.0.0"; }
+
+private:
+    //==============================================================================
+    GiantDrumVoiceManager voiceManager_;
+    GiantCpuBudget cpuBudget_;
+    GiantModMatrix modMatrix_;
+
+    struct Parameters
+    {
+        // Membrane
+        float membraneTension = 0.5f;
+        float membraneDiameter = 1.5f;
+        float membraneDamping = 0.995f;
+        float membraneInharmonicity = 0.1f;
+        int membraneNumModes = 4;
+
+        // Shell
+        float shellCavityFreq = 120.0f;
+        float shellFormant = 300.0f;
+        float shellCoupling = 0.3f;
+
+        // Nonlinear
+        float saturationAmount = 0.1f;
+        float massEffect = 0.5f;
+
+        // Room
+        float roomSize = 0.7f;
+        float reflectionGain = 0.3f;
+        float reverbTime = 2.0f;
+
+        // Giant
+        float scaleMeters = 3.0f;
+        float massBias = 0.7f;
+        float airLoss = 0.4f;
+        float transientSlowing = 0.5f;
+        float distanceMeters = 10.0f;  // Listener distance: air hides high modes (1 - 100)
+        float sympatheticCoupling = 0.0f;  // Voices ring each other (0 = off)
+
+        // Gesture
+        float force = 0.7f;
+        float speed = 0.6f;
+        float contactArea = 0.5f;
+        float roughness = 0.3f;
+
+        // Global
+        float masterVolume = 0.8f;
+        float cpuBudget = 0.3f;        // Fraction of block deadline (not saved in presets)
+
+        // Kit
+        int kitLayout = 0;             // 0 = chromatic (pitched drum per key), 1 = giant GM kit
+
+    } params_;
+
+    double sampleRate_ = 48000.0;
+    int blockSize_ = 512;
+    int maxVoices_ = 16;
+
+    // Current giant state
+    GiantScaleParameters currentScale_;
+    GiantGestureParameters currentGesture_;
+
+    // Kit map derived from params_; setParameter() only marks it stale and
+    // it is rebuilt once before the next note-on or block
+    bool kitDirty_ = false;
+
+    void applyParameters();
+    void applyRoomParameters();
+    void rebuildKit();
+    void updateKit();
+
+    /** Store a kit-shaping parameter; marks the kit stale only if it changed */
+    void setKitParameter(float& field, float value);
+
+    void processStereoSample(float& left, float& right);
+    float calculateFrequency(int midiNote) const;
+
+    // Preset serialization
+    bool writeJsonParameter(const char* name, double value, char* buffer,
+                            int& offset, int bufferSize) const;
+    bool parseJsonParameter(const char* json, const char* param, double& value) const;
+};
+
+}  // namespace DSP
@@ -0,0 +1,688 @@
+/*
+  ==============================================================================
+
+   AetherGiantHornsDSP.h
+   Giant Horn Synthesizer (Colossal Brass)
+
+   Physical modeling of giant-scale brass instruments:
+   - Lip reed exciter (nonlinear brass oscillation, growl at high pressure)
+   - Bore waveguide (air column with mouthpiece cavity and bore shapes)
+   - Bell radiation filter (directional output)
+   - Formant shaping (instrument identity)
+   - Giant scale physics (mass, inertia, air coupling)
+
+   Preset archetypes:
+   - Titan Tuba - dark, massive, slow attack
+   - War Horn - growling, aggressive, chaotic
+   - Cathedral Trombone - warm, broad, long bore
+   - Mythic Trumpet - bright, focused, penetrating
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "AetherGiantBase.h"
+#include "dsp/InstrumentDSP.h"
+#include "dsp/GiantAdaa.h"
+#include "dsp/GiantCpuBudget.h"
+#include "dsp/GiantMeterFeed.h"
+#include "dsp/GiantModMatrix.h"
+#include "dsp/GiantNoise.h"
+#include "dsp/GiantRenderProfile.h"
+#include "dsp/GiantSpatialEncoder.h"
+#include "dsp/GiantTuningTable.h"
+#include "dsp/GiantVoiceWarmUp.h"
+#include "dsp/GiantSharedTables.h"
+#include <juce_dsp/juce_dsp.h>
+#include <vector>
+#include <array>
+#include <memory>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Lip reed exciter
+ *
+ * Models brass lip oscillation:
+ * - Pressure-dependent oscillation threshold
+ * - Lip mass/stiffness mass-spring-damper dynamics
+ * - Asymmetric nonlinear transfer
+ * - Chaos/growl above a pressure threshold
+ */
+class LipReedExciter
+{
+public:
+    struct Parameters
+    {
+        float lipTension = 0.5f;       // Lip tension (shifts reed frequency)
+        float mouthPressure = 0.5f;    // Mouth pressure scaling (0.0 - 1.0)
+        float nonlinearity = 0.3f;     // Transfer nonlinearity (0.0 - 1.0)
+        float chaosThreshold = 0.7f;   // Pressure where growl begins (0.0 - 1.0)
+        float growlAmount = 0.2f;      // Growl/chaos amount (0.0 - 1.0)
+        float lipMass = 0.5f;          // Lip mass (0.0 = light, 1.0 = heavy)
+        float lipStiffness = 0.5f;     // Lip stiffness (0.0 = loose, 1.0 = stiff)
+    };
+
+    LipReedExciter();
+    ~LipReedExciter() = default;
+
+    void prepare(double sampleRate);
+    void reset();
+
+    /** Process lip reed
+        @param pressure    Breath pressure (0.0 - 1.0)
+        @param frequency   Target playing frequency (Hz)
+        @returns           Excitation signal */
+    float processSample(float pressure, float frequency);
+
+    void setParameters(const Parameters& p);
+
+    /** Growl noise seed; reset() restarts the sequence from it */
+    void setNoiseSeed(uint64_t seed);
+
+    /** Controller targets, smoothed per sample inside processSample()
+        @param breath      Scales mouth pressure (0.0 - 1.0, 1.0 = no controller)
+        @param lipBend     Offset added to lip tension (-0.5 - 0.5) */
+    void setControlTargets(float breath, float lipBend);
+
+    /** Jump straight to the controller targets (new notes, no glide in) */
+    void snapControls();
+
+    /** Anti-alias the reed's soft clip (offline profile; costs a log per sample) */
+    void setAntialiased(bool enabled);
+
+private:
+    static constexpr float controlSmoothingSeconds = 0.005f;
+
+    Parameters params;
+
+    float reedPosition = 0.0f;
+    float reedVelocity = 0.0f;
+    float currentPressure = 0.0f;
+    float phase = 0.0f;
+    float lipMass = 1.0f;
+    float lipStiffness = 1.0f;
+    bool oscillationStarted = false;
+    float attackTransient = 0.0f;
+
+    // Breath/expression and lip bend (one-pole smoothed at audio rate)
+    float breathTarget = 1.0f;
+    float breath = 1.0f;
+    float lipBendTarget = 0.0f;
+    float lipBend = 0.0f;
+    float effectiveLipTension = 0.5f;
+    float controlSmoothing = 1.0f;
+
+    // Growl noise (deterministic per voice, see GiantNoise::deriveSeed)
+    GiantNoise noise;
+    uint64_t noiseSeed = 0;
+
+    // Soft clip: plain tanh live, antiderivative anti-aliased offline
+    bool antialiased = false;
+    GiantAdaa<GiantAdaaShapes::Tanh> softClip;
+
+    double sr = 48000.0;
+
+    float calculateReedFrequency(float targetFreq) const;
+    float calculateOscillationThreshold(float frequency) const;
+    float nonlinearTransfer(float x) const;
+};
+
+//==============================================================================
+/**
+ * Bore waveguide
+ *
+ * Bidirectional delay-line model of the air column:
+ * - Mouthpiece cavity resonance
+ * - Bore shape character (cylindrical, conical, flared, hybrid)
+ * - Multi-stage bell radiation and frequency-dependent reflection
+ * - Length-dependent loss
+ */
+class BoreWaveguide
+{
+public:
+    enum class BoreShape
+    {
+        Cylindrical,   // Trombone-like, even harmonic emphasis
+        Conical,       // Flugelhorn-like, warm
+        Flared,        // Tuba-like, bright and penetrating
+        Hybrid         // Balanced (most realistic)
+    };
+
+    struct Parameters
+    {
+        float lengthMeters = 3.0f;        // Bore length (0.5 - 40.0 m)
+        float reflectionCoeff = 0.9f;     // Bell reflection (0.0 - 1.0)
+        BoreShape boreShape = BoreShape::Hybrid;
+        float flareFactor = 0.5f;         // Bell flare (0.0 - 1.0)
+        float lossPerMeter = 0.05f;       // Propagation loss
+    };
+
+    BoreWaveguide();
+    ~BoreWaveguide() = default;
+
+    void prepare(double sampleRate);
+    void reset();
+
+    /** Process bore
+        @param input    Excitation from the lip reed
+        @returns        Bell output */
+    float processSample(float input);
+
+    void setLengthMeters(float length);
+    void setBoreShape(BoreShape shape);
+    void setParameters(const Parameters& p);
+
+    /** Open-open tube fundamental for the current length (Hz) */
+    float getFundamentalFrequency() const;
+
+private:
+    Parameters params;
+
+    // Delay lines (fixed capacity, circular)
+    std::vector<float> forwardDelay;
+    std::vector<float> backwardDelay;
+    std::vector<float> mouthpieceCavity;
+    int writeIndex = 0;
+    int delayLength = 1;
+    int maxDelaySize = 1;
+    int maxCavitySize = 1;
+    int cavityWriteIndex = 0;
+
+    // Filter states
+    float bellState = 0.0f;
+    float cavityState = 0.0f;
+    float cylState = 0.0f;
+    float conState = 0.0f;
+    float flareState = 0.0f;
+    float hybridLF = 0.0f;
+    float hybridHF = 0.0f;
+    float stage1State = 0.0f;
+    float stage2State = 0.0f;
+    float stage3State = 0.0f;
+    float lfState = 0.0f;
+    float hfState = 0.0f;
+
+    // OPTIMIZED: Cached filter coefficients
+    float cylCoeff = 0.0f;
+    float conCoeff = 0.0f;
+    float flareCoeff = 0.0f;
+    float hybridLFCoeff = 0.0f;
+    float hybridHFCoeff = 0.0f;
+    float stage1Coeff = 0.0f;
+    float stage2Coeff = 0.0f;
+    float stage3Coeff = 0.0f;
+    float lfLossCoeff = 0.0f;
+    float hfLossCoeff = 0.0f;
+    BoreShape cachedBoreShape = BoreShape::Hybrid;
+    float cachedBellSize = -1.0f;
+    bool boreCoefficientsDirty = true;
+    bool bellCoefficientsDirty = true;
+    bool lossCoefficientsDirty = true;
+
+    double sr = 48000.0;
+
+    void updateDelayLength();
+    float processMouthpieceCavity(float input);
+    float applyBoreShape(float input);
+    float applyCylindricalBore(float input);
+    float applyConicalBore(float input);
+    float applyFlaredBore(float input);
+    float applyHybridBore(float input);
+    float calculateFrequencyDependentReflection() const;
+    float processBellRadiation(float input);
+    float calculateBellRadiation(float frequency) const;
+    float calculateRadiationImpedance(float frequency, float bellSize) const;
+    float bellRadiationStage1(float input, float bellSize);
+    float bellRadiationStage2(float input, float bellSize);
+    float bellRadiationStage3(float input, float bellSize);
+    float applyFrequencyDependentLoss(float input, float lfLoss, float hfLoss);
+};
+
+//==============================================================================
+/**
+ * Bell radiation filter
+ *
+ * Larger bells radiate less high-frequency energy.
+ */
+class BellRadiationFilter
+{
+public:
+    BellRadiationFilter();
+    ~BellRadiationFilter() = default;
+
+    void prepare(double sampleRate);
+    void reset();
+
+    /** Process bell radiation
+        @param input       Bore output
+        @param bellSize    Relative bell size (larger = darker)
+        @returns           Radiated signal */
+    float processSample(float input, float bellSize);
+
+    void setCutoffFrequency(float freq);
+
+private:
+    float cutoffFrequency = 3000.0f;
+    float shaperState = 0.0f;
+
+    double sr = 48000.0;
+
+    float radiationFilter(float input, float cutoff);
+};
+
+//==============================================================================
+/**
+ * Horn formant shaper
+ *
+ * Gives each horn type its identity with a small resonant formant bank
+ * plus brightness/warmth/metalness tone shaping.
+ */
+class HornFormantShaper
+{
+public:
+    enum class HornType
+    {
+        Trumpet,      // Bright, focused
+        Trombone,     // Warm, broad
+        Tuba,         // Dark, massive
+        FrenchHorn,   // Mellow, complex
+        Saxophone,    // Reed character
+        Custom        // Neutral
+    };
+
+    struct Parameters
+    {
+        HornType hornType = HornType::Tuba;
+        float brightness = 0.5f;    // High-frequency emphasis (0.0 - 1.0)
+        float warmth = 0.5f;        // Low-frequency emphasis (0.0 - 1.0)
+        float metalness = 0.7f;     // Brass character (0.0 - 1.0)
+    };
+
+    HornFormantShaper();
+    ~HornFormantShaper() = default;
+
+    void prepare(double sampleRate);
+    void reset();
+
+    /** Process formant shaping
+        @param input    Bell output
+        @returns        Shaped output */
+    float processSample(float input);
+
+    void setParameters(const Parameters& p);
+    void setHornType(HornType type);
+
+    /** Use process-wide precomputed formant coefficients (may be nullptr) */
+    void setSharedTables(const GiantSharedTables* tables);
+
+    /** Limit processing to the first N formants (CPU budget level of detail) */
+    void setFormantLimit(int limit);
+    int getFormantLimit() const { return formantLimit; }
+    int getFormantCount() const { return static_cast<int>(formants.size()); }
+
+private:
+    struct FormantFilter
+    {
+        float frequency = 500.0f;
+        float amplitude = 1.0f;
+        float bandwidth = 1.5f;
+        float pole = 0.0f;              // Precomputed in GiantSharedTables
+        float phaseIncrement = 0.0f;
+        float phase = 0.0f;
+        float state = 0.0f;
+
+        float processSample(float input);
+        void reset();
+    };
+
+    Parameters params;
+    std::vector<FormantFilter> formants;
+    int formantLimit = 0;
+    const GiantSharedTables* sharedTables = nullptr;
+
+    float brightnessState = 0.0f;
+    float warmthState = 0.0f;
+
+    double sr = 48000.0;
+
+    float brightnessFilter(float input, float amount);
+    float warmthFilter(float input, float amount);
+    void initializeHornType(HornType type);
+};
+
+//==============================================================================
+/**
+ * Single giant horn voice
+ */
+struct GiantHornVoice
+{
+    int midiNote = -1;
+    float velocity = 0.0f;
+    bool active = false;
+    bool prepared = false;      // Adopted by the audio thread (lazy, see GiantVoiceWarmUp)
+    std::atomic<bool> ready { false };     // Bore delay lines allocated and published
+
+    // DSP components
+    LipReedExciter lipReed;
+    BoreWaveguide bore;
+    BellRadiationFilter bell;
+    HornFormantShaper formants;
+
+    // Giant parameters
+    GiantScaleParameters scale;
+    GiantGestureParameters gesture;
+
+    // Pressure envelope
+    float currentPressure = 0.0f;
+    float targetPressure = 0.0f;
+    float envelopePhase = 0.0f;  // 0 = attack, 1 = sustain, 2 = release
+
+    // Note pitch from the tuning table (glides when retuned)
+    GiantPitchGlide pitch;
+
+    // Modulation matrix values (GiantModMatrix), set per sample while it runs
+    float modGain = 1.0f;
+    float modPressure = 1.0f;
+    float modSemitones = 0.0f;
+    float modPitchRatio = 1.0f;
+    float appliedPitchRatio = 1.0f;     // Ratio the bore length already carries
+
+    double sr = 48000.0;
+
+    void prepare(double sampleRate);
+    void reset();
+    void trigger(int note, float noteFrequency, float vel, const GiantGestureParameters& gesture,
+                 const GiantScaleParameters& scale);
+    void retune(float noteFrequency);
+
+    /** Matrix destinations: Level, Pitch (semitones) and Breath */
+    void setModulation(float level, float semitones, float breath);
+    void release(bool damping = false);
+    float processSample();
+    bool isActive() const;
+
+    float calculateTargetPressure(float velocity, float force) const;
+    float processPressureEnvelope();
+};
+
+//==============================================================================
+/**
+ * Giant Horn voice manager
+ *
+ * Manages polyphonic horn voices (typically 8-12 voices).
+ */
+class GiantHornVoiceManager
+{
+public:
+    GiantHornVoiceManager();
+    ~GiantHornVoiceManager() = default;
+
+    void prepare(double sampleRate, int maxVoices = 12);
+    void reset();
+
+    GiantHornVoice* findFreeVoice();
+    GiantHornVoice* findVoiceForNote(int note);
+
+    void handleNoteOn(int note, float velocity, const GiantGestureParameters& gesture,
+                      const GiantScaleParameters& scale);
+    void handleNoteOff(int note, bool damping = false);
+    void allNotesOff();
+
+    /** One output sample: every voice summed and soft clipped
+        @param voiceOutputs  nullptr, or one value per voice slot receiving that
+                             voice's share of the clipped sample (they sum to it) */
+    float processSample(float* voiceOutputs = nullptr);
+    int getActiveVoiceCount() const;
+
+    /** Voice slots (spatial stems) and the note sounding in one, or -1 if idle */
+    int getNumVoices() const { return static_cast<int>(voices.size()); }
+    int getVoiceNote(int index) const;
+
+    /** Per-voice level for the meter feed (see GiantMeterSource) */
+    int getVoiceEnergies(float* energies, int maxVoices) const;
+
+    void setLipReedParameters(const LipReedExciter::Parameters& params);
+    void setBoreParameters(const BoreWaveguide::Parameters& params);
+    void setFormantParameters(const HornFormantShaper::Parameters& params);
+
+    /** Shared tables handed to every voice (owned by the engine) */
+    void setSharedTables(const GiantSharedTables* tables);
+
+    /** Engine noise seed; each voice gets its own stream derived from it.
+        Reseeds only when the seed changes. */
+    void setNoiseSeed(uint64_t seed);
+
+    /** Breath controller (CC2 or aftertouch, 0.0 - 1.0) for every voice's reed */
+    void setBreath(float breath);
+
+    /** Expression (CC11, 0.0 - 1.0); scales the breath, so a swell shapes
+        whatever the breath controller is doing rather than replacing it */
+    void setExpression(float expression);
+
+    /** Lip tension offset (-0.5 - 0.5, from pitch bend) for every voice's reed */
+    void setLipBend(float lipBend);
+
+    /** Tuning for new notes; sounding voices glide to their new pitch */
+    void setTuningTable(const GiantTuningTable& table);
+
+    /** Offline profile: anti-aliased reed nonlinearity on every voice */
+    void setAntialiasedReed(bool enabled);
+
+    /** Modulation matrix the voices follow (owned by the engine, nullptr = none) */
+    void setModMatrix(GiantModMatrix* matrix) { modulation = matrix; }
+
+    /** Apply CPU budget quality: trim formants on quiet voices, retire the quietest */
+    void applyQuality(const GiantCpuBudget& budget);
+
+    /** Prepare up to maxVoices cold voices
+        @returns    Number of voices still cold */
+    int warmUp(int maxVoices);
+    int getPreparedVoiceCount() const;
+
+private:
+    std::vector<std::unique_ptr<GiantHornVoice>> voices;
+    double currentSampleRate = 48000.0;
+
+    // Voices prepared eagerly in prepare(); the rest only through warmUp()
+    static constexpr int eagerVoices = 2;
+
+    // Current settings, applied to each voice as it is prepared
+    LipReedExciter::Parameters lipReedParams;
+    BoreWaveguide::Parameters boreParams;
+    HornFormantShaper::Parameters formantParams;
+    const GiantSharedTables* sharedTables = nullptr;
+    uint64_t noiseSeed = 1;
+    const GiantTuningTable* tuning = &GiantTuningTable::equalTemperament();
+    GiantModMatrix* modulation = nullptr;
+
+    // Current controller values; new notes start from them
+    float breath = 1.0f;
+    float expression = 1.0f;
+    float lipBend = 0.0f;
+    bool antialiasedReed = false;
+
+    // Output tanh, antiderivative anti-aliased
+    GiantAdaa<GiantAdaaShapes::Tanh> outputClip;
+
+    void prepareVoice(GiantHornVoice& voice);
+    void adoptVoice(size_t index);
+    int indexOf(const GiantHornVoice* voice) const;
+};
+
+//==============================================================================
+/**
+ * Main Aether Giant Horns Pure DSP Instrument
+ */
+class AetherGiantHornsPureDSP : public InstrumentDSP,
+                                public GiantVoiceWarmUp,
+                                public GiantTunable,
+                                public GiantMeterSource,
+                                public GiantRenderProfileTarget,
+                                public GiantSpatialSource,
+                                public GiantModulationTarget
+{
+public:
+    AetherGiantHornsPureDSP();
+    ~AetherGiantHornsPureDSP() override;
+
+    //==============================================================================
+    // InstrumentDSP interface
+    bool prepare(double sampleRate, int blockSize) override;
+    void reset() override;
+    void process(float** outputs, int numChannels, int numSamples) override;
+    void handleEvent(const ScheduledEvent& event) override;
+
+    float getParameter(const char* paramId) const override;
+    void setParameter(const char* paramId, float value) override;
+
+    bool savePreset(char* jsonBuffer, int jsonBufferSize) const override;
+    bool loadPreset(const char* jsonData) override;
+
+    int getActiveVoiceCount() const override;
+    int getMaxPolyphony() const override { return maxVoices_; }
+
+    const GiantCpuBudget& getCpuBudget() const { return cpuBudget_; }
+
+    //==============================================================================
+    // GiantVoiceWarmUp interface
+    int warmUpVoices(int maxVoices) override { return voiceManager_.warmUp(maxVoices); }
+    int getPreparedVoiceCount() const override { return voiceManager_.getPreparedVoiceCount(); }
+
+    //==============================================================================
+    // GiantMeterSource interface
+    int getVoiceEnergies(float* energies, int maxVoices) const override
+    {
+        return voiceManager_.getVoiceEnergies(energies, maxVoices);
+    }
+
+    //==============================================================================
+    // GiantRenderProfileTarget interface
+    void setRenderProfile(GiantRenderProfile profile) override;
+
+    //==============================================================================
+    // GiantTunable interface
+    void setTuningTable(const GiantTuningTable* table) override;
+
+    //==============================================================================
+    // GiantSpatialSource interface
+    int getNumStems() const override { return voiceManager_.getNumVoices(); }
+    void processStems(float* const* stems, GiantStemPosition* positions, int numSamples) override;
+
+    //==============================================================================
+    // GiantModulationTarget interface (every destination: level, pitch, breath)
+    bool supportsModDestination(GiantModDestination) const override { return true; }
+    GiantModMatrix& getModMatrix() override { return modMatrix_; }
+
+    const char* getInstrumentName() const override { return "AetherGiantHorns"; }
+    const char* getInstrumentVersion() const override { return "1.0.0"; }
+
+private:
+    //==============================================================================
+    GiantHornVoiceManager voiceManager_;
+    GiantCpuBudget cpuBudget_;
+    GiantModMatrix modMatrix_;
+    std::shared_ptr<const GiantSharedTables> sharedTables_;
+    const GiantTuningTable* tuning_ = &GiantTuningTable::equalTemperament();
+
+    struct Parameters
+    {
+        // Lip reed
+        float lipTension = 0.5f;
+        float mouthPressure = 0.6f;
+        float nonlinearity = 0.3f;
+        float chaosThreshold = 0.7f;
+        float growlAmount = 0.2f;
+        float lipMass = 0.5f;
+        float lipStiffness = 0.5f;
+
+        // Bore
+        float boreLength = 5.0f;
+        float reflectionCoeff = 0.9f;
+        float boreShape = 3.0f;         // 0 = cylindrical, 1 = conical, 2 = flared, 3 = hybrid
+        float flareFactor = 0.5f;
+
+        // Bell
+        float bellSize = 1.5f;
+
+        // Formants
+        float hornType = 2.0f;          // 0 = trumpet, 1 = trombone, 2 = tuba, 3 = french horn, 4 = sax
+        float brightness = 0.4f;
+        float warmth = 0.6f;
+        float metalness = 0.7f;
+
+        // Giant
+        float scaleMeters = 5.0f;
+        float massBias = 0.6f;
+        float airLoss = 0.4f;
+        float transientSlowing = 0.6f;
+
+        // Gesture
+        float force = 0.6f;
+        float speed = 0.3f;
+        float contactArea = 0.5f;
+        float roughness = 0.3f;
+
+        // Global
+        float masterVolume = 0.8f;
+        float cpuBudget = 0.3f;         // Fraction of block deadline (not saved in presets)
+        float noiseSeed = 1.0f;         // Growl noise seed (integer; same seed, same render)
+
+    } params_;
+
+    double sampleRate_ = 48000.0;
+    int blockSize_ = 512;
+    int maxVoices_ = 12;
+
+    // Current giant state
+    GiantScaleParameters currentScale_;
+    GiantGestureParameters currentGesture_;
+
+    // Breath, expression, aftertouch and bend are queued with their sample
+    // offsets and applied inside process(), bypassing setParameter()
+    enum class ControllerTarget
+    {
+        Breath,         // CC2, aftertouch (the same gesture from different hardware)
+        Expression,     // CC11, multiplies the breath
+        LipBend
+    };
+
+    struct ControllerEvent
+    {
+        int sampleOffset = 0;
+        ControllerTarget target = ControllerTarget::Breath;
+        float value = 0.0f;
+    };
+
+    static constexpr int maxControllerEvents = 256;  // Per block
+    std::array<ControllerEvent, maxControllerEvents> controllerEvents_ {};
+    int numControllerEvents_ = 0;
+
+    void queueControllerEvent(int sampleOffset, ControllerTarget target, float value);
+    void applyControllerEvent(const ControllerEvent& event);
+
+    // Spatial stems: per-voice samples and the note each slot held last block
+    std::vector<float> voiceSamples_;
+    std::vector<int> stemNotes_;
+
+    /** Shared per-sample loop of process() and processStems()
+        @param mono     numSamples output samples (nullptr when rendering stems)
+        @param stems    One buffer per voice slot (nullptr when rendering mono) */
+    void renderBlock(float* mono, float* const* stems, int numSamples);
+
+    void applyParameters();
+    void processStereoSample(float& left, float& right);
+    float calculateFrequency(int midiNote) const;
+
+    // Preset serialization
+    bool writeJsonParameter(const char* name, double value, char* buffer,
+                            int& offset, int bufferSize) const;
+    bool parseJsonParameter(const char* json, const char* param, double& value) const;
+};
+
+}  // namespace DSP
@@ -32,10 +32,18 @@
 #include "AetherGiantBase.h"
 #include "dsp/FastRNG.h"
 #include "dsp/InstrumentDSP.h"
+#include "dsp/GiantCpuBudget.h"
+#include "dsp/GiantMeterFeed.h"
+#include "dsp/GiantModMatrix.h"
+#include "dsp/GiantModeDetail.h"
+#include "dsp/GiantRenderProfile.h"
+#include "dsp/GiantVoiceWarmUp.h"
+#include "dsp/GiantSharedTables.h"
 #include <juce_dsp/juce_dsp.h>
 #include <vector>
 #include <array>
 #include <memory>
+#include <atomic>
 #include <cmath>
 
 namespace DSP {
@@ -58,19 +66,31 @@ struct ModalResonatorMode
 {
     float frequency = 440.0f;       // Mode frequency (Hz)
     float Q = 10.0f;                 // Resonance (determines decay time)
-    float amplitude = 0.0f;         // Current amplitude (energy)
     float initialAmplitude = 1.0f;   // Starting amplitude (for strike)
-    float decay = 0.995f;           // Global decay multiplier
+
+    // Long-decay state is kept in double: with decay ~0.9999 over tens of
+    // seconds a float envelope/filter accumulates audible rounding error
+    double amplitude = 0.0;         // Current amplitude (output gain)
+    double decay = 0.995;           // Global decay multiplier
+    double inputGain = 1.0;         // Re-strike input scale: new hits sound at their own level
+    double peakGain = 1.0;          // Loudest hit's envelope relative to amplitude
+    double pendingImpulse = 0.0;    // Strike impulse, added to the next input sample
+
+    static constexpr double maxRestrikeGain = 1000.0;  // Tail 60 dB under a new hit: restart
 
     // State Variable Filter (TPT topology - normalized ladder)
-    juce::dsp::StateVariableTPTFilter<float> svf;
+    juce::dsp::StateVariableTPTFilter<double> svf;
 
     double sampleRate = 48000.0;
 
     void prepare(double sr);
     float processSample(float input);  // Now takes input excitation
     void excite(float energy);
+    void reExcite(float energy);       // Strike while ringing: superpose, never damp
     void reset();
+
+    /** Envelope of the loudest hit still ringing (decay detection, level of detail) */
+    double getEnergy() const { return amplitude * peakGain; }
 };
 
 //==============================================================================
@@ -121,14 +141,25 @@ public:
         @param contactArea Size of striking surface */
     void strike(float velocity, float force, float contactArea);
 
+    /** Strike a resonator that is still ringing (rolls, tremolos)
+        The new impulse superposes on the modes' current motion at the level
+        a fresh hit would have, so a soft hit neither damps a loud tail nor
+        takes on its loudness. A mode whose tail has fallen more than 60 dB
+        under the new hit restarts instead.
+        @param velocity    Strike velocity (0.0 - 1.0)
+        @param force       Strike force (affects added energy)
+        @param contactArea Size of striking surface */
+    void restrike(float velocity, float force, float contactArea);
+
     /** Scrape the resonator (continuous excitation)
         @param intensity    Scrape intensity (0.0 - 1.0)
         @param roughness    Surface texture */
     void scrape(float intensity, float roughness);
 
     /** Process modal bank
-        @returns    Summed output from all modes */
-    float processSample();
+        @param strikeExcitation  Exciter burst sample driving every mode
+        @returns                 Summed output from all modes */
+    float processSample(float strikeExcitation = 0.0f);
 
     void setParameters(const Parameters& p);
     Parameters getParameters() const { return params; }
@@ -136,9 +167,23 @@ public:
     /** Get total energy (for decay detection) */
     float getTotalEnergy() const;
 
+    /** Limit processing to the lowest N modes (CPU budget level of detail).
+        Trimmed modes are silenced so restoring the limit never pops. */
+    void setModeLimit(int limit);
+    int getModeLimit() const { return modeLimit; }
+
+    /** Number of modes below a frequency (level of detail air cutoff) */
+    int countModesBelow(float frequencyHz) const;
+
+    /** Drop top modes whose envelope has fallen below maskingRatio times the
+        loudest rendered mode (level of detail over the tail)
+        @returns    The new mode limit */
+    int trimMaskedModes(float maskingRatio);
+
 private:
     Parameters params;
     std::vector<ModalResonatorMode> modes;
+    int modeLimit = 0;
 
     double sr = 48000.0;
     float scrapeEnergy = 0.0f;
@@ -151,6 +196,7 @@ private:
     void initializeBowlModes();
 
     float calculateDecay(float baseDecay, float frequency, float size);
+    float strikeEnergy(const ModalResonatorMode& mode, float velocity, float force, float contactArea) const;
 };
 
 //==============================================================================
@@ -187,30 +233,37 @@ public:
     void prepare(double sampleRate);
     void reset();
 
-    /** Generate strike excitation
+    /** Use the process-wide mallet impulse library (may be nullptr: no burst) */
+    void setSharedTables(const GiantSharedTables* tables);
+
+    /** Start a strike: selects the precomputed burst for the mallet type,
+        hardness and velocity layer and sets its gains. No per-sample math.
         @param velocity    Strike velocity
         @param force       Strike force
-        @param contactArea Size of striking surface
-        @param roughness   Surface texture
-        @returns           Excitation signal */
-    float processSample(float velocity, float force, float contactArea, float roughness);
+        @param contactArea Size of striking surface (larger = darker layer)
+        @param roughness   Surface texture */
+    void trigger(float velocity, float force, float contactArea, float roughness);
+
+    /** Next excitation sample of the current burst (0 once it has finished) */
+    float processSample();
+
+    bool isActive() const { return burstPosition < burstLength; }
 
     void setParameters(const Parameters& p);
 
 private:
     Parameters params;
 
-    // Click transient
-    float clickPhase = 0.0f;
-    float clickDecay = 0.0f;
-
-    // Noise layer
-    FastRNG rng;
+    // Current burst (points into GiantSharedTables)
+    const GiantSharedTables* sharedTables = nullptr;
+    const float* contactBurst = nullptr;
+    const float* noiseBurst = nullptr;
+    float contactGain = 0.0f;
+    float noiseGain = 0.0f;
+    int burstLength = 0;
+    int burstPosition = 0;
 
     double sr = 48000.0;
-
-    float generateClick();
-    float generateNoise(float roughness);
 };
 
 //==============================================================================
@@ -307,6 +360,11 @@ struct GiantPercussionVoice
     int midiNote = -1;
     float velocity = 0.0f;
     bool active = false;
+    bool prepared = false;      // Adopted by the audio thread (lazy, see GiantVoiceWarmUp)
+    std::atomic<bool> ready { false };     // Modes/filters built and published
+    int detailModes = 0;        // Level-of-detail mode count (GiantModeDetail)
+    int detailCountdown = 0;    // Samples until the next tail trim
+    bool trimTail = true;       // Tail level of detail (off for offline renders)
 
     // DSP components
     ModalResonatorBank resonator;
@@ -321,7 +379,10 @@ struct GiantPercussionVoice
     void prepare(double sampleRate);
     void reset();
     void trigger(int note, float vel, const GiantGestureParameters& gesture,
-                 const GiantScaleParameters& scale);
+                 const GiantScaleParameters& scale, const GiantModeDetail::Context& detail);
+    void reExcite(float vel, const GiantGestureParameters& gesture,
+                  const GiantModeDetail::Context& detail);
+    int modesForHit(const GiantModeDetail::Context& detail) const;
     float processSample(float& left, float& right);
     bool isActive() const;
 };
@@ -352,20 +413,69 @@ public:
     void processSample(float& left, float& right);
     int getActiveVoiceCount() const;
 
+    /** Per-voice level for the meter feed (see GiantMeterSource) */
+    int getVoiceEnergies(float* energies, int maxVoices) const;
+
     void setResonatorParameters(const ModalResonatorBank::Parameters& params);
     void setExciterParameters(const StrikeExciter::Parameters& params);
+
+    /** Shared tables handed to every voice (owned by the engine) */
+    void setSharedTables(const GiantSharedTables* tables);
+
+    /** Same-note policy: re-excite the ringing voice (rolls cost one voice)
+        instead of allocating a new one per hit */
+    void setReExcite(bool enabled) { reExciteEnabled = enabled; }
+
+    /** Listener distance for the level-of-detail air cutoff (meters) */
+    void setListenerDistance(float meters) { listenerDistance = meters; }
+
+    /** Offline profile: new hits keep every mode for their whole tail */
+    void setFullDetail(bool enabled) { fullDetail = enabled; }
+
+    /** Modulation matrix the voices follow (owned by the engine, nullptr = none) */
+    void setModMatrix(GiantModMatrix* matrix) { modulation = matrix; }
+
     void setRadiationParameters(const StereoRadiationPattern::Parameters& params);
 
+    /** Apply CPU budget quality: trim modes on quiet voices, retire the quietest */
+    void applyQuality(const GiantCpuBudget& budget);
+
+    /** Prepare up to maxVoices cold voices
+        @returns    Number of voices still cold */
+    int warmUp(int maxVoices);
+    int getPreparedVoiceCount() const;
+
 private:
     std::vector<std::unique_ptr<GiantPercussionVoice>> voices;
     double currentSampleRate = 48000.0;
+
+    // Voices prepared eagerly in prepare(); the rest only through warmUp()
+    static constexpr int eagerVoices = 4;
+
+    // Current settings, applied to each voice as it is prepared
+    ModalResonatorBank::Parameters resonatorParams;
+    StrikeExciter::Parameters exciterParams;
+    StereoRadiationPattern::Parameters radiationParams;
+    const GiantSharedTables* sharedTables = nullptr;
+    bool reExciteEnabled = true;
+    float listenerDistance = 10.0f;
+    bool fullDetail = false;
+    GiantModMatrix* modulation = nullptr;
+
+    void prepareVoice(GiantPercussionVoice& voice);
+    void adoptVoice(GiantPercussionVoice& voice);
+    int indexOf(const GiantPercussionVoice* voice) const;
 };
 
 //==============================================================================
 /**
  * Main Aether Giant Percussion Pure DSP Instrument
  */
-class AetherGiantPercussionPureDSP : public InstrumentDSP
+class AetherGiantPercussionPureDSP : public InstrumentDSP,
+                                     public GiantVoiceWarmUp,
+                                     public GiantMeterSource,
+                                     public GiantRenderProfileTarget,
+                                     public GiantModulationTarget
 {
 public:
     AetherGiantPercussionPureDSP();
@@ -387,12 +497,41 @@ public:
     int getActiveVoiceCount() const override;
     int getMaxPolyphony() const override { return maxVoices_; }
 
+    const GiantCpuBudget& getCpuBudget() const { return cpuBudget_; }
+
+    //==============================================================================
+    // GiantVoiceWarmUp interface
+    int warmUpVoices(int maxVoices) override { return voiceManager_.warmUp(maxVoices); }
+    int getPreparedVoiceCount() const override { return voiceManager_.getPreparedVoiceCount(); }
+
+    //==============================================================================
+    // GiantMeterSource interface
+    int getVoiceEnergies(float* energies, int maxVoices) const override
+    {
+        return voiceManager_.getVoiceEnergies(energies, maxVoices);
+    }
+
+    //==============================================================================
+    // GiantRenderProfileTarget interface
+    void setRenderProfile(GiantRenderProfile profile) override;
+
+    //==============================================================================
+    // GiantModulationTarget interface (level only: mode frequencies are set per strike)
+    bool supportsModDestination(GiantModDestination destination) const override
+    {
+        return destination == GiantModDestination::Level;
+    }
+    GiantModMatrix& getModMatrix() override { return modMatrix_; }
+
     const char* getInstrumentName() const override { return "AetherGiantPercussion"; }
     const char* getInstrumentVersion() const override { return "1.0.0"; }
 
 private:
     //==============================================================================
     GiantPercussionVoiceManager voiceManager_;
+    GiantCpuBudget cpuBudget_;
+    GiantModMatrix modMatrix_;
+    std::shared_ptr<const GiantSharedTables> sharedTables_;
 
     struct Parameters
     {
@@ -425,6 +564,7 @@ private:
         float massBias = 0.5f;
         float airLoss = 0.3f;
         float transientSlowing = 0.4f;
+        float distanceMeters = 10.0f;   // Listener distance: air hides high modes (1 - 100)
 
         // Gesture
         float force = 0.7f;
@@ -434,6 +574,8 @@ private:
 
         // Global
         float masterVolume = 0.8f;
+        float reExcite = 1.0f;          // 1 = same-note hits re-strike the ringing voice
+        float cpuBudget = 0.3f;         // Fraction of block deadline (not saved in presets)
 
     } params_;
 
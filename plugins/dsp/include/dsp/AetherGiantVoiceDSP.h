@@ -27,10 +27,20 @@
 #include "AetherGiantBase.h"
 #include "dsp/FastRNG.h"
 #include "dsp/InstrumentDSP.h"
+#include "dsp/GiantAdaa.h"
+#include "dsp/GiantCpuBudget.h"
+#include "dsp/GiantFormantTrajectory.h"
+#include "dsp/GiantMeterFeed.h"
+#include "dsp/GiantModMatrix.h"
+#include "dsp/GiantRenderProfile.h"
+#include "dsp/GiantSpatialEncoder.h"
+#include "dsp/GiantTuningTable.h"
+#include "dsp/GiantVoiceWarmUp.h"
 #include <juce_dsp/juce_dsp.h>
 #include <vector>
 #include <array>
 #include <memory>
+#include <atomic>
 #include <cmath>
 
 namespace DSP {
@@ -107,6 +117,7 @@ public:
     void setParameters(const Parameters& p);
 
     bool isActive() const { return active; }
+    bool isReleasing() const { return envelopePhase >= 2.0f; }
 
 private:
     Parameters params;
@@ -309,10 +320,25 @@ public:
     /** Set vowel shape directly */
     void setVowelShape(VowelShape shape, float openness = 0.5f);
 
+    /** Drive the formants from an analyzed performance (GiantFormantTrajectory)
+        Frequencies are scaled down and bandwidths widened by giantScale, as
+        for the vowel tables; drift still applies on top. setParameters()
+        and setVowelShape() return to vowel mode.
+        @param frequencies    Formant frequencies (Hz, count values)
+        @param bandwidths     Formant bandwidths (Hz, count values)
+        @param count          Formants in the frame (up to 4) */
+    void setFormantFrame(const float* frequencies, const float* bandwidths, int count);
+
+    /** Limit processing to the first N formants (CPU budget level of detail) */
+    void setFormantLimit(int limit);
+    int getFormantLimit() const { return formantLimit; }
+    int getFormantCount() const { return static_cast<int>(formants.size()); }
+
 private:
     Parameters params;
 
     std::vector<GiantFormantFilter> formants;
+    int formantLimit = 4;
 
     // Formant drift state
     float driftPhase = 0.0f;
@@ -321,6 +347,10 @@ private:
     float baseF3 = 2500.0f;
     float baseF4 = 3500.0f;
 
+    // Analyzed performance bandwidths (used instead of the vowel table)
+    bool useFrameBandwidths = false;
+    std::array<float, 4> frameBandwidths {};
+
     double sr = 48000.0;
 
     void updateFormantFrequencies();
@@ -476,6 +506,8 @@ struct GiantVoice
     int midiNote = -1;
     float velocity = 0.0f;
     bool active = false;
+    bool prepared = false;      // Adopted by the audio thread (lazy, see GiantVoiceWarmUp)
+    std::atomic<bool> ready { false };     // Components prepared and published
 
     // DSP components
     BreathPressureGenerator breath;
@@ -488,13 +520,41 @@ struct GiantVoice
     GiantScaleParameters scale;
     GiantVoiceGesture gesture;
 
+    // Analyzed performance (nullptr = vowel presets), followed at control rate
+    static constexpr int trajectoryControlInterval = 64;  // Samples per update (realtime)
+    int controlInterval = trajectoryControlInterval;       // 1 in the offline profile
+    const GiantFormantTrajectory* trajectory = nullptr;
+    double trajectoryTime = 0.0;        // Seconds into the phrase
+    int trajectoryCountdown = 0;
+    float trajectoryLevel = 1.0f;
+    float trajectoryLevelStep = 0.0f;   // Per-sample ramp to the next frame's level
+    float fundamental = 100.0f;         // Note pitch the phrase is transposed to
+    double sampleRate = 48000.0;
+
+    // Note pitch from the tuning table, before scale (glides when retuned)
+    GiantPitchGlide pitch;
+
+    // Modulation matrix values (GiantModMatrix), set per sample while it runs
+    float modGain = 1.0f;
+    float modPressure = 1.0f;
+    float modSemitones = 0.0f;
+    float modPitchRatio = 1.0f;
+    float appliedPitchRatio = 1.0f;     // Ratio the vocal folds' frequency already carries
+
     void prepare(double sampleRate);
     void reset();
-    void trigger(int note, float vel, const GiantVoiceGesture& gesture,
+    void trigger(int note, float noteFrequency, float vel, const GiantVoiceGesture& gesture,
                  const GiantScaleParameters& scale);
+    void retune(float noteFrequency);
+
+    /** Matrix destinations: Level, Pitch (semitones) and Breath */
+    void setModulation(float level, float semitones, float breath);
     void release(bool damping = false);
     float processSample();
     bool isActive() const;
+
+private:
+    void updateTrajectory();
 };
 
 //==============================================================================
@@ -520,23 +580,85 @@ public:
     void handleNoteOff(int note, bool damping = false);
     void allNotesOff();
 
-    float processSample();
+    /** One output sample: every voice summed and soft clipped
+        @param voiceOutputs  nullptr, or one value per voice slot receiving that
+                             voice's share of the clipped sample (they sum to it) */
+    float processSample(float* voiceOutputs = nullptr);
     int getActiveVoiceCount() const;
 
+    /** Voice slots (spatial stems) and the note sounding in one, or -1 if idle */
+    int getNumVoices() const { return static_cast<int>(voices.size()); }
+    int getVoiceNote(int index) const;
+
+    /** Per-voice level for the meter feed (see GiantMeterSource) */
+    int getVoiceEnergies(float* energies, int maxVoices) const;
+
     void setFormantParameters(const FormantStack::Parameters& params);
     void setSubharmonicParameters(const SubharmonicGenerator::Parameters& params);
     void setChestParameters(const ChestResonator::Parameters& params);
 
+    /** Performance for new notes and the sounding ones (nullptr = vowel presets)
+        Sounding voices keep their phrase position; with nullptr they hold
+        their last frame until retriggered. */
+    void setTrajectory(const GiantFormantTrajectory* trajectory);
+    const GiantFormantTrajectory* getTrajectory() const { return trajectory; }
+
+    /** Tuning for new notes; sounding voices glide to their new pitch */
+    void setTuningTable(const GiantTuningTable& table);
+
+    /** Samples between performance (trajectory) updates on every voice */
+    void setControlInterval(int samples);
+
+    /** Modulation matrix the voices follow (owned by the engine, nullptr = none) */
+    void setModMatrix(GiantModMatrix* matrix) { modulation = matrix; }
+
+    /** Apply CPU budget quality: trim formants on quiet voices, retire the quietest */
+    void applyQuality(const GiantCpuBudget& budget);
+
+    /** Prepare up to maxVoices cold voices
+        @returns    Number of voices still cold */
+    int warmUp(int maxVoices);
+    int getPreparedVoiceCount() const;
+
 private:
     std::vector<std::unique_ptr<GiantVoice>> voices;
     double currentSampleRate = 48000.0;
+
+    // Voices prepared eagerly in prepare(); the rest only through warmUp()
+    static constexpr int eagerVoices = 2;
+
+    // Current settings, applied to each voice as it is prepared
+    FormantStack::Parameters formantParams;
+    SubharmonicGenerator::Parameters subharmonicParams;
+    ChestResonator::Parameters chestParams;
+    bool hasFormantParams = false;
+    bool hasSubharmonicParams = false;
+    bool hasChestParams = false;
+
+    const GiantFormantTrajectory* trajectory = nullptr;
+    const GiantTuningTable* tuning = &GiantTuningTable::equalTemperament();
+    int controlInterval = GiantVoice::trajectoryControlInterval;
+    GiantModMatrix* modulation = nullptr;
+
+    // Output exponential soft clip, antiderivative anti-aliased
+    GiantAdaa<GiantAdaaShapes::Exponential> outputClip;
+
+    void prepareVoice(GiantVoice& voice);
+    void adoptVoice(GiantVoice& voice);
+    int indexOf(const GiantVoice* voice) const;
 };
 
 //==============================================================================
 /**
  * Main Aether Giant Voice Pure DSP Instrument
  */
-class AetherGiantVoicePureDSP : public InstrumentDSP
+class AetherGiantVoicePureDSP : public InstrumentDSP,
+                                public GiantVoiceWarmUp,
+                                public GiantTunable,
+                                public GiantMeterSource,
+                                public GiantRenderProfileTarget,
+                                public GiantSpatialSource,
+                                public GiantModulationTarget
 {
 public:
     AetherGiantVoicePureDSP();
@@ -558,12 +680,60 @@ public:
     int getActiveVoiceCount() const override;
     int getMaxPolyphony() const override { return maxVoices_; }
 
+    const GiantCpuBudget& getCpuBudget() const { return cpuBudget_; }
+
+    /** Follow an analyzed vocal performance (GiantFormantTrajectory::load)
+        Each note plays the phrase from its start, transposed so the phrase's
+        median pitch lands on the note. nullptr returns to the vowel presets.
+        Not realtime safe: call with processing suspended or before prepare(). */
+    void setFormantTrajectory(std::shared_ptr<const GiantFormantTrajectory> trajectory);
+
+    /** Same, for a phrase the caller owns and keeps alive until the next call
+        Realtime safe (nothing is freed): the plugin hands phrases over on the
+        audio thread between blocks this way. */
+    void setFormantTrajectory(const GiantFormantTrajectory* trajectory);
+    const GiantFormantTrajectory* getFormantTrajectory() const { return voiceManager_.getTrajectory(); }
+
+    //==============================================================================
+    // GiantVoiceWarmUp interface
+    int warmUpVoices(int maxVoices) override { return voiceManager_.warmUp(maxVoices); }
+    int getPreparedVoiceCount() const override { return voiceManager_.getPreparedVoiceCount(); }
+
+    //==============================================================================
+    // GiantMeterSource interface
+    int getVoiceEnergies(float* energies, int maxVoices) const override
+    {
+        return voiceManager_.getVoiceEnergies(energies, maxVoices);
+    }
+
+    //==============================================================================
+    // GiantRenderProfileTarget interface
+    void setRenderProfile(GiantRenderProfile profile) override;
+
+    //==============================================================================
+    // GiantTunable interface
+    void setTuningTable(const GiantTuningTable* table) override;
+
+    //==============================================================================
+    // GiantSpatialSource interface
+    int getNumStems() const override { return voiceManager_.getNumVoices(); }
+    void processStems(float* const* stems, GiantStemPosition* positions, int numSamples) override;
+
+    //==============================================================================
+    // GiantModulationTarget interface (every destination: level, pitch, breath)
+    bool supportsModDestination(GiantModDestination) const override { return true; }
+    GiantModMatrix& getModMatrix() override { return modMatrix_; }
+
     const char* getInstrumentName() const override { return "AetherGiantVoice"; }
     const char* getInstrumentVersion() const override { return "1.0.0"; }
 
 private:
     //==============================================================================
     GiantVoiceManager voiceManager_;
+    GiantCpuBudget cpuBudget_;
+    GiantModMatrix modMatrix_;
+    std::shared_ptr<const GiantFormantTrajectory> trajectory_;
+    const GiantTuningTable* tuning_ = &GiantTuningTable::equalTemperament();
 
     struct Parameters
     {
@@ -608,6 +778,7 @@ private:
 
         // Global
         float masterVolume = 0.8f;
+        float cpuBudget = 0.3f;         // Fraction of block deadline (not saved in presets)
 
     } params_;
 
@@ -619,6 +790,15 @@ private:
     GiantScaleParameters currentScale_;
     GiantVoiceGesture currentGesture_;
 
+    // Spatial stems: per-voice samples and the note each slot held last block
+    std::vector<float> voiceSamples_;
+    std::vector<int> stemNotes_;
+
+    /** Shared per-sample loop of process() and processStems()
+        @param mono     numSamples output samples (nullptr when rendering stems)
+        @param stems    One buffer per voice slot (nullptr when rendering mono) */
+    void renderBlock(float* mono, float* const* stems, int numSamples);
+
     void applyParameters();
     void processStereoSample(float& left, float& right);
     float calculateFrequency(int midiNote) const;
@@ -0,0 +1,141 @@
+/*
+  ==============================================================================
+
+   GiantAdaa.h
+   First-order antiderivative anti-aliasing (ADAA) for memoryless soft clippers
+
+   A static nonlinearity f driven hard creates harmonics above Nyquist that
+   fold back as inharmonic aliases. Instead of oversampling the whole voice,
+   first-order ADAA outputs the average of f over the segment between two
+   consecutive input samples:
+
+       y[n] = (F(x[n]) - F(x[n-1])) / (x[n] - x[n-1]),   F' = f
+
+   which suppresses most aliasing (close to 2x oversampling) for one extra
+   closed-form evaluation per sample. When the two inputs are nearly equal
+   the quotient is ill-conditioned and f at the midpoint is used instead.
+   The price is a half-sample delay and a gentle high-frequency roll-off.
+
+   Shapes provide f and F in closed form; differences are taken in double
+   so F's magnitude does not eat the precision of small steps.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Shapes: f (function) and its antiderivative F, both odd/even as expected
+ */
+namespace GiantAdaaShapes
+{
+    /** Cubic soft clip: x - x^3/3 inside |x| < 1, +-2/3 outside */
+    struct Cubic
+    {
+        static double function(double x)
+        {
+            if (std::abs(x) < 1.0)
+                return x - (x * x * x) / 3.0;
+            return x > 0.0 ? 2.0 / 3.0 : -2.0 / 3.0;
+        }
+
+        static double antiderivative(double x)
+        {
+            const double ax = std::abs(x);
+            if (ax < 1.0)
+            {
+                const double x2 = x * x;
+                return x2 * 0.5 - x2 * x2 / 12.0;
+            }
+            return (2.0 / 3.0) * ax - 0.25;
+        }
+    };
+
+    /** Hyperbolic tangent; F = log(cosh(x)) in an overflow-free form */
+    struct Tanh
+    {
+        static double function(double x)
+        {
+            return std::tanh(x);
+        }
+
+        static double antiderivative(double x)
+        {
+            const double ax = std::abs(x);
+            return ax + std::log1p(std::exp(-2.0 * ax)) - 0.69314718055994531;
+        }
+    };
+
+    /** Exponential soft clip: linear up to the knee, then an exponential
+        approach to +-1 with matching slope (C1 at the knee) */
+    struct Exponential
+    {
+        static constexpr double knee = 0.5;
+
+        static double function(double x)
+        {
+            const double ax = std::abs(x);
+            if (ax <= knee)
+                return x;
+
+            const double y = 1.0 - (1.0 - knee) * std::exp(-(ax - knee) / (1.0 - knee));
+            return x > 0.0 ? y : -y;
+        }
+
+        static double antiderivative(double x)
+        {
+            const double ax = std::abs(x);
+            if (ax <= knee)
+                return x * x * 0.5;
+
+            const double span = 1.0 - knee;
+            return knee * knee * 0.5 + (ax - knee)
+                 - span * span * (1.0 - std::exp(-(ax - knee) / span));
+        }
+    };
+}
+
+//==============================================================================
+/**
+ * First-order ADAA wrapper around a shape
+ */
+template <typename Shape>
+class GiantAdaa
+{
+public:
+    /** Below this input step the midpoint fallback is used */
+    static constexpr double illConditionedStep = 1.0e-5;
+
+    void reset()
+    {
+        previousInput = 0.0;
+        previousAntiderivative = Shape::antiderivative(0.0);
+    }
+
+    /** Process one sample (half-sample latency) */
+    float processSample(float input)
+    {
+        const double x = input;
+        const double antiderivative = Shape::antiderivative(x);
+        const double step = x - previousInput;
+
+        const double y = (std::abs(step) < illConditionedStep)
+            ? Shape::function(0.5 * (x + previousInput))
+            : (antiderivative - previousAntiderivative) / step;
+
+        previousInput = x;
+        previousAntiderivative = antiderivative;
+        return static_cast<float>(y);
+    }
+
+private:
+    double previousInput = 0.0;
+    double previousAntiderivative = Shape::antiderivative(0.0);
+};
+
+}  // namespace DSP
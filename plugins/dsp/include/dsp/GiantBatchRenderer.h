@@ -0,0 +1,84 @@
+/*
+  ==============================================================================
+
+   GiantBatchRenderer.h
+   Batch rendering of isolated notes for sample-library export
+
+   A library export renders one preset at 8-16 velocities, or 8-16 notes,
+   each in isolation. renderBatch() takes the whole set at once and runs
+   one fresh engine instance per job across worker threads
+   (GiantWorkerPool.h, shared with GiantChunkRenderer), so the export
+   scales with core count instead of running jobs one after another.
+   The parallelism is per job: each engine renders its note with the
+   same scalar code as a realtime voice.
+
+   Every job gets its own engine in the offline render profile: results
+   do not depend on job order or on which worker ran the job, and match
+   rendering the note alone through the same engine bit for bit.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "dsp/GiantChunkRenderer.h"
+#include <cstdint>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * One isolated note to render
+ */
+struct GiantBatchJob
+{
+    int midiNote = 60;
+    float velocity = 1.0f;
+    int noteOffSample = -1;             // Note-off position (-1 = never, one-shot engines)
+
+    int numSamples = 0;                 // Capacity of outputs
+    float* outputs[2] = {};             // Caller-owned, numSamples each (right may be nullptr for mono)
+};
+
+//==============================================================================
+struct GiantBatchResult
+{
+    int renderedSamples = 0;            // Stopped early once the tail fell silent
+    float peak = 0.0f;
+};
+
+//==============================================================================
+struct GiantBatchSettings
+{
+    double sampleRate = 48000.0;
+    int blockSize = 512;
+    int numThreads = 0;                 // 0 = one per hardware thread
+
+    float silenceThreshold = 0.0f;      // Stop once sounded, released and every sample stays below (0 = full length)
+    double silenceSeconds = 0.5;        // ... for this long
+};
+
+//==============================================================================
+/**
+ * Renders many independent single-note engine instances in parallel
+ */
+class GiantBatchRenderer
+{
+public:
+    using EngineFactory = GiantChunkRenderer::EngineFactory;
+
+    GiantBatchRenderer(EngineFactory createEngine, const GiantBatchSettings& settings);
+
+    /** Render every job (blocks until all are done)
+        @param jobs     numJobs jobs; their output buffers must not overlap
+        @param results  numJobs results (nullptr if not needed) */
+    void renderBatch(const GiantBatchJob* jobs, int numJobs, GiantBatchResult* results = nullptr) const;
+
+private:
+    GiantBatchResult renderJob(const GiantBatchJob& job) const;
+
+    EngineFactory createEngine;
+    GiantBatchSettings settings;
+};
+
+}  // namespace DSP
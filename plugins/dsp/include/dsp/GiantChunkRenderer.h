@@ -0,0 +1,151 @@
+/*
+  ==============================================================================
+
+   GiantChunkRenderer.h
+   Chunk-parallel offline rendering for the Giant Instruments engines
+
+   A long bounce (a 20 minute film cue) is split into chunks that render
+   on separate engine instances, one per worker thread. Each chunk starts
+   its engine a pre-roll earlier than the chunk itself:
+   - a pre-roll never starts inside held notes; it moves back to the
+     note-on that began them (self-oscillating horns and voices only
+     match a serial render when played from the start of the note)
+   - a chunk whose pre-roll would reach back further than
+     maxHeldPrerollSeconds (a drone, a long legato line) joins the chunk
+     before it instead, so held-note chains render serially once rather
+     than once per chunk
+   - events before the pre-roll are chased: parameter changes in order
+     and the last pitch bend / controller / pressure values are applied
+     at the pre-roll start
+   - events inside the pre-roll replay at their original positions
+   - after the pre-roll the engine state has converged with a serial
+     render as far as the giant tails allow, and the chunk is kept
+
+   Neighbouring chunks overlap by a short crossfade. The difference
+   between the two renders over each overlap is reported as the seam
+   error; the verification mode also renders serially and reports the
+   maximum difference over the whole timeline.
+
+   Chunk and pre-roll lengths are rounded up to whole blocks so every
+   chunk sees the same block grid (and event offsets) as a serial render.
+   Engines run in the offline render profile with all voices prepared,
+   so nothing in a chunk depends on wall-clock timing. State that never
+   decays (per-voice noise streams, voice rotation) restarts with each
+   chunk's engine: Drums and Percussion match a serial render to
+   rounding error, while Horns and Voice notes can differ in noise and
+   phase detail. The verification mode shows which case a cue is in.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "dsp/InstrumentDSP.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * An engine event at an absolute position on the render timeline
+ */
+struct GiantTimelineEvent
+{
+    int64_t samplePosition = 0;
+    ScheduledEvent event;       // sampleOffset is filled in per block
+};
+
+//==============================================================================
+struct GiantChunkRenderSettings
+{
+    double sampleRate = 48000.0;
+    int blockSize = 512;
+    int numChannels = 2;
+
+    double chunkSeconds = 30.0;
+    double prerollSeconds = 20.0;       // Longer than the longest tail in the cue
+    double maxHeldPrerollSeconds = 60.0;   // Longer held-note pre-rolls merge chunks
+    double crossfadeSeconds = 0.05;     // Clamped to the chunk length
+    int numThreads = 0;                 // 0 = one per hardware thread
+
+    bool verify = false;                // Also render serially and compare
+};
+
+//==============================================================================
+struct GiantChunkRenderReport
+{
+    int numChunks = 0;
+    int numThreads = 0;
+    double renderSeconds = 0.0;         // Wall clock, parallel render
+
+    float maxSeamDifference = 0.0f;     // Largest chunk vs. previous chunk difference over an overlap
+
+    // Verification mode only
+    bool verified = false;
+    double serialRenderSeconds = 0.0;
+    float maxDifference = 0.0f;         // Largest |parallel - serial| sample
+    int64_t maxDifferencePosition = 0;
+};
+
+//==============================================================================
+/**
+ * Offline renderer that spreads one timeline across all cores
+ */
+class GiantChunkRenderer
+{
+public:
+    /** Creates a prepared engine with the cue's preset applied
+        (called once per chunk, from worker threads) */
+    using EngineFactory = std::function<std::unique_ptr<InstrumentDSP>(double sampleRate, int blockSize)>;
+
+    GiantChunkRenderer(EngineFactory createEngine, const GiantChunkRenderSettings& settings);
+
+    /** Render numSamples of the timeline
+        @param events   Sorted by samplePosition; PARAM_CHANGE ids must outlive the call
+                        (applied through setParameter() at the start of their block)
+        @param output   Resized to numChannels x numSamples
+        @returns        Timing, seam error and (verify) the serial comparison */
+    GiantChunkRenderReport render(const std::vector<GiantTimelineEvent>& events, int64_t numSamples,
+                                  std::vector<std::vector<float>>& output) const;
+
+private:
+    /** Timeline positions of one chunk (all block aligned except the ends) */
+    struct ChunkPlan
+    {
+        int64_t warmStart = 0;          // Engine starts here (chunkStart - preroll)
+        int64_t chunkStart = 0;         // First sample kept
+        int64_t writeStart = 0;         // First sample written straight to the output
+        int64_t chunkEnd = 0;           // Next chunk's start
+        int64_t renderEnd = 0;          // Engine stops here (chunkEnd + crossfade)
+    };
+
+    /** Where a chunk's kept samples go */
+    struct ChunkTarget
+    {
+        std::vector<std::vector<float>>* output = nullptr;
+        std::vector<std::vector<float>>* head = nullptr;    // [chunkStart, writeStart)
+        std::vector<std::vector<float>>* tail = nullptr;    // [chunkEnd, renderEnd)
+    };
+
+    void renderChunk(const std::vector<GiantTimelineEvent>& events, const ChunkPlan& plan,
+                     const ChunkTarget& target) const;
+
+    /** Pre-roll start for a nominal position: moved back to the first
+        note-on of any notes still held there */
+    int64_t findWarmStart(const std::vector<GiantTimelineEvent>& events, int64_t position) const;
+
+    /** Apply the state left by events before position (see file comment) */
+    static void chaseEvents(InstrumentDSP& engine, const std::vector<GiantTimelineEvent>& events,
+                            int64_t position);
+
+    /** Hand one event to the engine (PARAM_CHANGE through setParameter()) */
+    static void applyEvent(InstrumentDSP& engine, const ScheduledEvent& event);
+
+    EngineFactory createEngine;
+    GiantChunkRenderSettings settings;
+};
+
+}  // namespace DSP
@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+   GiantCpuBudget.h
+   CPU budget governor for the Giant Instruments engines
+
+   Each engine measures its own render time per block and compares it to a
+   fraction of the block deadline (numSamples / sampleRate). When over budget
+   the governor steps quality down one level; when headroom returns it steps
+   back up. Engines translate the quality level into inaudible-first savings:
+   fewer modes/formants on quiet voices, fewer room taps, and early
+   retirement of the quietest voices.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <chrono>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Per-engine render time governor
+ *
+ * Degrades fast (a single over-budget block is enough once the hold time has
+ * elapsed) and restores slowly (smoothed load must stay under the headroom
+ * threshold for many consecutive blocks), so quality never oscillates
+ * audibly around the budget.
+ */
+class GiantCpuBudget
+{
+public:
+    enum class Quality
+    {
+        Full = 0,      // No savings
+        Reduced,       // Trim detail on quiet voices
+        Low,           // Trim detail on all but the loudest voices, cap polyphony
+        Minimal        // Emergency: bare minimum per voice, heavy polyphony cap
+    };
+
+    struct Parameters
+    {
+        float budgetFraction = 0.3f;     // Fraction of block deadline allowed (0.05 - 1.0)
+        float restoreHeadroom = 0.6f;    // Restore when load < budget * headroom
+        int restoreHoldBlocks = 64;      // Consecutive good blocks before stepping up
+        int degradeHoldBlocks = 4;       // Minimum blocks between step-downs
+    };
+
+    GiantCpuBudget() = default;
+    ~GiantCpuBudget() = default;
+
+    void prepare(double sampleRate, int blockSize);
+    void reset();
+
+    /** Mark the start of a render block */
+    void beginBlock();
+
+    /** Mark the end of a render block and update the quality level
+        @param numSamples   Samples rendered since beginBlock() */
+    void endBlock(int numSamples);
+
+    Quality getQuality() const { return quality; }
+    int getQualityLevel() const { return static_cast<int>(quality); }
+    bool isDegraded() const { return quality != Quality::Full; }
+
+    /** Smoothed render load (1.0 = whole block deadline) */
+    float getLoad() const { return smoothedLoad; }
+
+    /** Offline rendering has no deadline: a disabled governor stays at Full
+        and stops measuring */
+    void setEnabled(bool shouldBeEnabled);
+    bool isEnabled() const { return enabled; }
+
+    /** Budget as fraction of the block deadline */
+    void setBudget(float fraction);
+    float getBudget() const { return params.budgetFraction; }
+
+    void setParameters(const Parameters& p);
+    const Parameters& getParameters() const { return params; }
+
+    /** Scale a resource count by the current quality level
+        @param fullCount    Count used at Full quality
+        @param minCount     Floor that is never undercut
+        @returns            Count for the current quality level */
+    int scaleCount(int fullCount, int minCount = 1) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    Parameters params;
+    Quality quality = Quality::Full;
+    bool enabled = true;
+
+    Clock::time_point blockStart;
+    bool blockOpen = false;
+
+    float smoothedLoad = 0.0f;
+    int blocksSinceChange = 0;
+    int goodBlocks = 0;
+
+    double sr = 48000.0;
+
+    void stepDown();
+    void stepUp();
+};
+
+}  // namespace DSP
@@ -0,0 +1,105 @@
+/*
+  ==============================================================================
+
+   GiantFormantTrajectory.h
+   Pre-analyzed vocal performances for the Giant Voice engine
+
+   GiantFormantAnalyzer (tools/) runs LPC analysis on a recorded phrase
+   offline and writes a .gftraj file: a fixed header followed by one frame
+   per analysis hop (pitch, level, four formant frequencies and
+   bandwidths). At runtime the file is memory-mapped and read in place;
+   voices sample it at control rate and drive FormantStack and
+   VocalFoldOscillator directly, so a realistic performance costs nothing
+   beyond the existing synthesis.
+
+   File layout (little-endian, 4-byte fields):
+       FileHeader
+       Frame[numFrames]
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace juce { class File; class MemoryMappedFile; }
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Read-only formant/pitch trajectory (memory-mapped)
+ */
+class GiantFormantTrajectory
+{
+public:
+    static constexpr int numFormants = 4;        // FormantStack's formants
+    static constexpr uint32_t fileVersion = 1;
+    static constexpr float maxFormantHz = 8000.0f;  // GiantFormantFilter's ceiling
+    static constexpr float maxPitchHz = 2000.0f;
+
+    struct FileHeader
+    {
+        char magic[4];                  // "GFTR"
+        uint32_t version;               // fileVersion
+        float frameRate;                // Frames per second
+        uint32_t numFrames;
+        uint32_t numFormants;           // numFormants
+        float referenceF0;              // Median voiced pitch (Hz)
+    };
+
+    struct Frame
+    {
+        float f0;                       // Pitch (Hz, 0 = unvoiced)
+        float level;                    // Frame level (0.0 - 1.0, phrase peak = 1)
+        float formantHz[numFormants];
+        float bandwidthHz[numFormants];
+    };
+
+    static_assert(sizeof(FileHeader) == 24, "FileHeader layout is part of the file format");
+    static_assert(sizeof(Frame) == 40, "Frame layout is part of the file format");
+
+    ~GiantFormantTrajectory();
+
+    /** Map a trajectory file
+        Opens and validates the file: call from the message thread, never
+        from process(). Every frame is checked, since the voices feed them
+        straight into their resonators: a NaN, a formant or bandwidth
+        outside (0, maxFormantHz), a pitch outside [0, maxPitchHz) or a
+        level outside [0, 1] rejects the file.
+        @param file     .gftraj file written by GiantFormantAnalyzer
+        @returns        Trajectory, or nullptr if missing or malformed */
+    static std::shared_ptr<const GiantFormantTrajectory> load(const juce::File& file);
+
+    /** Write a trajectory file (analysis tool)
+        @returns        false if the file could not be written */
+    static bool write(const juce::File& file, float frameRate, float referenceF0,
+                      const std::vector<Frame>& frames);
+
+    int getNumFrames() const { return static_cast<int>(numFrames); }
+    float getFrameRate() const { return frameRate; }
+    float getReferenceF0() const { return referenceF0; }
+    double getDurationSeconds() const { return numFrames / static_cast<double>(frameRate); }
+
+    /** Frame at a time, linearly interpolated; holds the last frame past the end
+        Pitch is not interpolated into or out of unvoiced frames.
+        @param timeSeconds  Time from the start of the phrase */
+    Frame getFrame(double timeSeconds) const;
+
+private:
+    GiantFormantTrajectory() = default;
+
+    static bool isValidFrame(const Frame& frame);
+
+    std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+    const Frame* frames = nullptr;      // Points into the mapping
+    uint32_t numFrames = 0;
+    float frameRate = 0.0f;
+    float referenceF0 = 0.0f;
+};
+
+}  // namespace DSP
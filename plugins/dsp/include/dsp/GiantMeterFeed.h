@@ -0,0 +1,183 @@
+/*
+  ==============================================================================
+
+   GiantMeterFeed.h
+   Lock-free metering and scope feed from the audio thread to the editor
+
+   After each block the audio thread measures the output (peak/RMS per
+   channel), asks the engine for its voice levels, appends a downsampled
+   scope and publishes the result through a triple buffer. The editor
+   polls the newest frame on a timer. Neither side ever waits for the
+   other, and the editor never touches the engine.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * One block's worth of meter data
+ */
+struct GiantMeterFrame
+{
+    static constexpr int maxChannels = 2;
+    static constexpr int maxVoices = 32;
+    static constexpr int scopeSize = 256;
+
+    float peak[maxChannels] = {};
+    float rms[maxChannels] = {};
+    int numChannels = 0;
+
+    int activeVoices = 0;
+    int numVoices = 0;                              // Slots filled in voiceEnergy
+    std::array<float, maxVoices> voiceEnergy {};    // Engine-specific level per voice slot (0 = idle)
+
+    bool hasScope = false;
+    std::array<float, scopeSize> scope {};          // Mono, oldest first
+
+    uint32_t sequence = 0;                          // Incremented per published block
+};
+
+//==============================================================================
+/**
+ * Engines that can report per-voice levels to the meter feed
+ */
+class GiantMeterSource
+{
+public:
+    virtual ~GiantMeterSource() = default;
+
+    /** Audio thread, after process(): write one level per voice slot
+        Drums report membrane energy, Percussion modal energy, Horns and
+        Voice breath pressure; idle voices report 0.
+        @returns    Number of slots written (at most maxVoices) */
+    virtual int getVoiceEnergies(float* energies, int maxVoices) const = 0;
+};
+
+//==============================================================================
+/**
+ * Audio thread writer / message thread reader of GiantMeterFrame
+ */
+class GiantMeterFeed
+{
+public:
+    static constexpr int scopeDecimation = 8;       // Samples per scope point
+
+    //==========================================================================
+    // Audio thread
+
+    /** Measure a rendered block and publish it with the engine's voice levels
+        @param source   Engine voice levels (nullptr if the engine has none) */
+    void publish(const float* const* channels, int numChannels, int numSamples,
+                 int activeVoices, const GiantMeterSource* source)
+    {
+        GiantMeterFrame& frame = frames[static_cast<size_t>(back)];
+
+        frame.numChannels = std::min(numChannels, GiantMeterFrame::maxChannels);
+        for (int ch = 0; ch < frame.numChannels; ++ch)
+        {
+            float peak = 0.0f;
+            float sumSquares = 0.0f;
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const float x = channels[ch][i];
+                peak = std::max(peak, std::abs(x));
+                sumSquares += x * x;
+            }
+
+            frame.peak[ch] = peak;
+            frame.rms[ch] = (numSamples > 0) ? std::sqrt(sumSquares / static_cast<float>(numSamples)) : 0.0f;
+        }
+
+        frame.activeVoices = activeVoices;
+        frame.numVoices = (source != nullptr)
+                        ? source->getVoiceEnergies(frame.voiceEnergy.data(), GiantMeterFrame::maxVoices)
+                        : 0;
+
+        frame.hasScope = scopeEnabled.load(std::memory_order_relaxed);
+        if (frame.hasScope && frame.numChannels > 0)
+        {
+            appendScope(channels, frame.numChannels, numSamples);
+
+            // Unroll the ring oldest-first
+            const auto split = scopeRing.begin() + scopeWrite;
+            std::copy(split, scopeRing.end(), frame.scope.begin());
+            std::copy(scopeRing.begin(), split, frame.scope.begin() + (GiantMeterFrame::scopeSize - scopeWrite));
+        }
+
+        frame.sequence = ++sequence;
+
+        back = middle.exchange(back | freshBit, std::memory_order_acq_rel) & indexMask;
+    }
+
+    //==========================================================================
+    // Message thread
+
+    /** Editor toggles the (slightly more expensive) scope */
+    void setScopeEnabled(bool enabled) { scopeEnabled.store(enabled, std::memory_order_relaxed); }
+
+    /** Newest published frame
+        @returns    nullptr if nothing was published since the last poll */
+    const GiantMeterFrame* poll()
+    {
+        if ((middle.load(std::memory_order_relaxed) & freshBit) == 0)
+            return nullptr;
+
+        front = middle.exchange(front, std::memory_order_acq_rel) & indexMask;
+        return &frames[static_cast<size_t>(front)];
+    }
+
+private:
+    void appendScope(const float* const* channels, int numChannels, int numSamples)
+    {
+        const float channelGain = 1.0f / static_cast<float>(numChannels);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float mono = 0.0f;
+            for (int ch = 0; ch < numChannels; ++ch)
+                mono += channels[ch][i];
+            mono *= channelGain;
+
+            // Keep each bucket's largest excursion so transients survive decimation
+            if (std::abs(mono) > std::abs(scopeBucket))
+                scopeBucket = mono;
+
+            if (++scopeCount == scopeDecimation)
+            {
+                scopeRing[static_cast<size_t>(scopeWrite)] = scopeBucket;
+                scopeWrite = (scopeWrite + 1) % GiantMeterFrame::scopeSize;
+                scopeBucket = 0.0f;
+                scopeCount = 0;
+            }
+        }
+    }
+
+    static constexpr int indexMask = 3;
+    static constexpr int freshBit = 4;
+
+    std::array<GiantMeterFrame, 3> frames {};
+    int back = 0;                                   // Audio thread
+    int front = 1;                                  // Message thread
+    std::atomic<int> middle { 2 };                  // Index | freshBit when unread
+
+    std::atomic<bool> scopeEnabled { false };
+
+    // Audio thread scope state
+    std::array<float, GiantMeterFrame::scopeSize> scopeRing {};
+    int scopeWrite = 0;
+    int scopeCount = 0;
+    float scopeBucket = 0.0f;
+    uint32_t sequence = 0;
+};
+
+}  // namespace DSP
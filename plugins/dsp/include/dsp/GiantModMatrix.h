@@ -0,0 +1,246 @@
+/*
+  ==============================================================================
+
+   GiantModMatrix.h
+   Control-rate modulation matrix for the Giant Instruments engines
+
+   Routes connect a source to a per-voice destination with a depth:
+   - Sources: two free-running LFOs, a per-voice ADSR envelope, velocity,
+     key tracking, per-note pressure, timbre and pitch bend (MPE), the mod
+     wheel and a per-note random value
+   - Destinations are integer IDs (GiantModDestination) shared by every
+     engine; each engine applies the ones its voices have a cheap per-sample
+     hook for (GiantModulationTarget::supportsModDestination)
+
+   The matrix is evaluated at a fixed control rate (controlRate, about 32
+   samples at 48 kHz) rather than per sample, so its cost does not depend
+   on the audio sample rate. Between control ticks every destination ramps
+   linearly, so voices read a smooth per-sample value with one multiply-add.
+   A new note is evaluated at once and starts at its target instead of
+   ramping from the previous note in its slot.
+
+   Settings change on the audio thread between blocks, like setParameter;
+   the matrix never allocates after prepare().
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "dsp/GiantNoise.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace DSP {
+
+//==============================================================================
+enum class GiantModSource : int
+{
+    Lfo1 = 0,           // -1 - 1, free running
+    Lfo2,
+    Envelope,           // 0 - 1, per voice ADSR
+    Velocity,           // 0 - 1
+    KeyTrack,           // Distance from middle C, -1 - 1 at +-5 octaves
+    Pressure,           // 0 - 1, per note (MPE) or channel aftertouch
+    Timbre,             // 0 - 1, per note CC74 (MPE)
+    Bend,               // -1 - 1, per note pitch bend (MPE)
+    ModWheel,           // 0 - 1, CC1
+    Random,             // -1 - 1, drawn per note
+    numSources
+};
+
+//==============================================================================
+/**
+ * Per-voice destination IDs; a route's depth is in the destination's unit
+ */
+enum class GiantModDestination : int
+{
+    Level = 0,          // Voice gain, 1 + value (depth 1 = double, -1 = silent)
+    Pitch,              // Semitones
+    Breath,             // Excitation pressure, 1 + value
+    numDestinations
+};
+
+//==============================================================================
+enum class GiantLfoShape : int
+{
+    Sine = 0,
+    Triangle,
+    Saw,
+    Square,
+    SampleAndHold
+};
+
+//==============================================================================
+struct GiantModRoute
+{
+    GiantModSource source = GiantModSource::Lfo1;
+    int destination = -1;       // GiantModDestination ID (-1 = unused slot)
+    float depth = 0.0f;
+
+    bool isActive() const
+    {
+        return destination >= 0 && destination < static_cast<int>(GiantModDestination::numDestinations)
+            && depth != 0.0f;
+    }
+};
+
+struct GiantModLfo
+{
+    float rateHz = 5.0f;
+    GiantLfoShape shape = GiantLfoShape::Sine;
+};
+
+struct GiantModEnvelope
+{
+    float attackSeconds = 0.5f;     // Linear rise
+    float decaySeconds = 1.0f;      // Exponential fall to sustain (time constant)
+    float sustain = 0.7f;
+    float releaseSeconds = 1.5f;    // Exponential fall after note-off (time constant)
+};
+
+//==============================================================================
+/**
+ * Everything the user edits: routes, LFOs and the envelope
+ */
+struct GiantModSettings
+{
+    static constexpr int maxRoutes = 16;
+    static constexpr int numLfos = 2;
+
+    std::array<GiantModRoute, maxRoutes> routes {};
+    std::array<GiantModLfo, numLfos> lfos {};
+    GiantModEnvelope envelope;
+};
+
+//==============================================================================
+/**
+ * Sources -> routes -> per-voice destinations, evaluated at control rate
+ */
+class GiantModMatrix
+{
+public:
+    static constexpr double controlRate = 1500.0;   // Evaluations per second
+    static constexpr int numNotes = 128;
+
+    GiantModMatrix();
+
+    /** Size the per-voice state (not realtime safe) */
+    void prepare(double sampleRate, int numVoices);
+
+    /** Silence every voice's modulation and restart the LFOs */
+    void reset();
+
+    void setSettings(const GiantModSettings& settings);
+    const GiantModSettings& getSettings() const { return settings; }
+
+    /** Something to evaluate: a route is set, or values are still ramping back to zero */
+    bool isRunning() const { return running; }
+
+    /** A voice slot starts a note: envelope restarts, values jump to their targets */
+    void noteOn(int voice, int note, float velocity);
+
+    /** The voice's envelope enters its release */
+    void noteOff(int voice);
+
+    /** Per-note expression (MPE); note < 0 sets every note (channel-wide message) */
+    void setNotePressure(int note, float pressure);
+    void setNoteTimbre(int note, float timbre);
+    void setNoteBend(int note, float bend);
+
+    void setModWheel(float value) { modWheel = value; }
+
+    /** Step one sample; call once per sample before reading values */
+    void advance()
+    {
+        if (rampPosition == controlInterval)
+            tick();
+        ++rampPosition;
+    }
+
+    /** Current value of a destination on a voice (ramped per sample) */
+    float getValue(int voice, GiantModDestination destination) const
+    {
+        const size_t slot = static_cast<size_t>(voice * numDestinations + static_cast<int>(destination));
+        return rampStart[slot] + rampStep[slot] * static_cast<float>(rampPosition);
+    }
+
+private:
+    static constexpr int numDestinations = static_cast<int>(GiantModDestination::numDestinations);
+
+    enum class EnvelopeStage
+    {
+        Idle,
+        Attack,
+        Decay,
+        Release
+    };
+
+    struct VoiceState
+    {
+        int note = -1;
+        float velocity = 0.0f;
+        float random = 0.0f;
+        EnvelopeStage stage = EnvelopeStage::Idle;
+        float envelope = 0.0f;
+    };
+
+    /** One control tick: advance the sources and ramp toward new targets */
+    void tick();
+
+    /** Sum the routes for one voice into numDestinations targets */
+    void evaluateVoice(int voice, float* targets) const;
+
+    void advanceEnvelope(VoiceState& state) const;
+    void updateCoefficients();
+
+    GiantModSettings settings;
+    std::array<int, GiantModSettings::maxRoutes> activeRoutes {};
+    int numActiveRoutes = 0;
+    bool running = false;
+
+    double sampleRate = 48000.0;
+    int controlInterval = 32;   // Samples per tick
+    int rampPosition = 32;      // Samples into the current ramp (controlInterval = tick due)
+
+    // Global sources
+    std::array<float, GiantModSettings::numLfos> lfoPhase {};
+    std::array<float, GiantModSettings::numLfos> lfoValue {};
+    std::array<float, GiantModSettings::numLfos> lfoHeld {};
+    float modWheel = 0.0f;
+    GiantNoise noise;
+
+    // Per-note expression
+    std::array<float, numNotes> notePressure {};
+    std::array<float, numNotes> noteTimbre {};
+    std::array<float, numNotes> noteBend {};
+
+    // Envelope, per tick
+    float attackStep = 1.0f;
+    float decayCoefficient = 0.0f;
+    float releaseCoefficient = 0.0f;
+
+    std::vector<VoiceState> voices;
+    std::vector<float> rampStart;       // [voice * numDestinations + destination]
+    std::vector<float> rampStep;
+    std::vector<float> rampTarget;      // Value each ramp ends on (exact, so zero settles)
+};
+
+//==============================================================================
+/**
+ * Engines whose voices follow a GiantModMatrix
+ */
+class GiantModulationTarget
+{
+public:
+    virtual ~GiantModulationTarget() = default;
+
+    /** Whether the engine's voices apply a destination (routes to others are ignored) */
+    virtual bool supportsModDestination(GiantModDestination destination) const = 0;
+
+    /** The engine's matrix (audio thread, between blocks) */
+    virtual GiantModMatrix& getModMatrix() = 0;
+};
+
+}  // namespace DSP
@@ -0,0 +1,96 @@
+/*
+  ==============================================================================
+
+   GiantModeDetail.h
+   Level-of-detail policy for modal voices (percussion modes, drum membranes)
+
+   A soft, distant hit in a dense passage does not need every mode: air
+   absorption has already removed its upper partials and louder voices
+   mask the rest. The policy picks a voice's mode count at trigger time
+   from velocity, air loss / listener distance and the number of voices
+   already sounding, and the voice keeps shrinking it over the tail as
+   high modes fall below the masking threshold. Loud foreground hits keep
+   full detail, so dense passages scale sub-linearly with the hit count.
+
+   Deterministic and allocation free: safe to call on the audio thread.
+   Runs underneath GiantCpuBudget, which trims further only when over
+   budget.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Trigger-time and tail mode-count policy
+ */
+class GiantModeDetail
+{
+public:
+    struct Context
+    {
+        float velocity = 1.0f;          // Strike velocity (0.0 - 1.0)
+        float airLoss = 0.3f;           // GiantScaleParameters::airLoss
+        float distanceMeters = 10.0f;   // Listener distance (1.0 - 100.0)
+        int activeVoices = 0;           // Voices already sounding
+        bool fullDetail = false;        // Offline render: every mode, no tail trimming
+    };
+
+    static constexpr float foregroundVelocity = 0.8f;  // At or above: loudness never trims
+    static constexpr int denseVoiceCount = 4;          // Density trimming starts above this
+    static constexpr float maskingRatio = 1.0e-3f;     // -60 dB below the voice's loudest mode
+    static constexpr int tailCheckInterval = 256;      // Samples between tail trims
+
+    /** Highest mode frequency still audible after air absorption
+        Classical absorption grows with f^2; a mode is dropped once it has
+        lost 40 dB on its way to the listener. airLoss = 1.0 corresponds to
+        0.1 dB/m at 1 kHz.
+        @param airLoss          High-frequency air absorption (0.0 - 1.0)
+        @param distanceMeters   Listener distance
+        @returns                Cutoff in Hz (effectively unbounded with no air loss) */
+    static float audibleBandwidth(float airLoss, float distanceMeters)
+    {
+        const float lossPerKHz2 = 0.1f * std::max(0.0f, airLoss) * std::max(1.0f, distanceMeters);
+        if (lossPerKHz2 <= 0.0f)
+            return 1.0e9f;
+
+        return 1000.0f * std::sqrt(40.0f / lossPerKHz2);
+    }
+
+    /** Mode count for a new hit
+        @param fullModes        Modes the resonator is configured for
+        @param audibleModes     Modes below audibleBandwidth() (lowest first)
+        @param minModes         Floor that is never undercut
+        @param context          Hit velocity, air and voice density
+        @returns                Modes to render (minModes..fullModes) */
+    static int modesAtTrigger(int fullModes, int audibleModes, int minModes, const Context& context)
+    {
+        if (context.fullDetail)
+            return fullModes;
+
+        float detail = 1.0f;
+
+        // Quiet hits: fewer modes (upper partials sit at the noise floor)
+        if (context.velocity < foregroundVelocity)
+        {
+            detail = 0.25f + 0.75f * std::max(0.0f, context.velocity) / foregroundVelocity;
+
+            // Dense passages: each background hit gets 1/sqrt(N) of the detail,
+            // so total mode count grows with sqrt of the number of hits
+            if (context.activeVoices > denseVoiceCount)
+                detail *= std::sqrt(static_cast<float>(denseVoiceCount) / context.activeVoices);
+        }
+
+        const int ceiling = std::min(fullModes, std::max(audibleModes, minModes));
+        const int count = static_cast<int>(std::ceil(static_cast<float>(ceiling) * detail));
+        return std::clamp(count, std::min(minModes, fullModes), fullModes);
+    }
+};
+
+}  // namespace DSP
@@ -0,0 +1,136 @@
+/*
+  ==============================================================================
+
+   GiantMovingSource.h
+   Doppler, distance gain and air absorption for a moving giant
+
+   One stage on the mixed output of an engine, so a fly-by or an
+   approaching giant costs one delay line rather than per-voice work.
+   The source distance is automatable:
+   - Every controlInterval samples the source glides toward the target
+     distance, at most at Mach 0.5, so automation jumps bend the pitch
+     instead of tearing the signal
+   - The sound arriving now left the source when it was at r(t - delay),
+     with delay = r(t - delay) / c. That is solved exactly on the
+     piecewise-linear position history, which gives the moving-source
+     Doppler shift c / (c + v) rather than the moving-listener 1 - v / c
+   - The delay line is read with cubic Hermite interpolation, the read
+     position ramped per sample between control points
+   - 1/r gain (unity at referenceDistance) and air absorption follow the
+     path the arriving sound travelled. Absorption grows with f^2 per meter;
+     a one-pole low-pass sits where the path beyond referenceDistance
+     costs 3 dB
+
+   The engines are voiced for a listener at the reference distance
+   (GiantEnvironmentParameters::distanceMeters default), so a stationary
+   source there changes nothing but the propagation delay. The host is
+   told that delay as latency (referenceDelaySeconds()), so a giant at the
+   reference distance lines up with the timeline and a nearer one arrives
+   early. Speed of sound follows the air temperature, absorption the
+   humidity.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Moving point source: propagation delay, 1/r gain and air absorption
+ */
+class GiantMovingSource
+{
+public:
+    static constexpr int maxChannels = 16;
+    static constexpr float referenceDistance = 10.0f;   // Meters: unity gain, no extra absorption
+    static constexpr float minDistance = 1.0f;
+    static constexpr float maxDistance = 400.0f;        // ~1.2 s of delay
+    static constexpr float glideSeconds = 0.1f;         // Distance smoothing time constant
+    static constexpr float maxMach = 0.5f;              // Fastest approach/recession
+    static constexpr int controlInterval = 64;          // Samples between position updates
+
+    GiantMovingSource() = default;
+    ~GiantMovingSource() = default;
+
+    /** Allocate the delay lines (not realtime safe)
+        @param numChannels  Channels process() will be given (1 - maxChannels) */
+    void prepare(double sampleRate, int numChannels);
+
+    /** Silence the delay lines and jump to the target distance. Realtime
+        safe: nothing is cleared, samples written before the reset read as 0 */
+    void reset();
+
+    /** Target distance in meters (minDistance - maxDistance); the source glides there */
+    void setDistance(float meters);
+
+    /** Air the sound travels through (a change glides the delay over one control interval)
+        @param temperatureCelsius   Sets the speed of sound
+        @param humidity             0.0 (dry: more high-frequency loss) - 1.0 */
+    void setAir(float temperatureCelsius, float humidity);
+
+    /** Speed of sound (m/s) at temperatureCelsius (-40 - 50) */
+    static float speedOfSoundAt(float temperatureCelsius);
+
+    /** Propagation delay of a source at rest at referenceDistance: the
+        latency to report to the host */
+    static double referenceDelaySeconds(float temperatureCelsius)
+    {
+        return referenceDistance / speedOfSoundAt(temperatureCelsius);
+    }
+
+    /** Where the source is now (not where the arriving sound left it) */
+    float getDistance() const { return sourceDistance; }
+    float getSpeedOfSound() const { return speedOfSound; }
+
+    /** Process in place
+        @param channels     numChannels buffers of numSamples (same motion on each) */
+    void process(float* const* channels, int numChannels, int numSamples);
+
+private:
+    static constexpr int subBlockSize = 256;
+
+    /** Fill delayTrack/gainTrack for the next numSamples samples */
+    void advanceMotion(int numSamples);
+
+    /** Delay (samples) of the sound arriving at time (samples since reset) */
+    double arrivalDelay(double time);
+
+    float historyAt(int64_t tick) const;
+    float absorptionCoefficient(float pathMeters) const;
+
+    double sampleRate = 48000.0;
+    int preparedChannels = 0;
+
+    float targetDistance = referenceDistance;
+    float sourceDistance = referenceDistance;
+    float speedOfSound = 343.2f;
+    float absorptionPerMeter = 0.0011f;     // dB per meter at 1 kHz (scales with f^2)
+
+    // Source distance at every control tick (tick k at k * controlInterval samples)
+    std::vector<float> distanceHistory;
+    int64_t latestTick = 0;                 // History holds ticks up to this one
+    int64_t emissionTick = 0;               // Segment the arriving sound left from (search cursor)
+    int64_t clock = 0;                      // Samples since reset (older line samples read as 0)
+    double currentDelay = 0.0;              // Samples, at clock
+
+    // Per channel ring buffer; size is a power of two
+    std::vector<float> delayLines;
+    int delayLineSize = 0;
+    int writePosition = 0;
+
+    // Per channel one-pole absorption filter
+    std::array<float, maxChannels> absorptionState {};
+    float currentAbsorption = 1.0f;         // One-pole coefficient (1 = open)
+
+    // Per-sample read delay and gain, shared by every channel of a sub-block
+    std::array<double, subBlockSize> delayTrack {};
+    std::array<float, subBlockSize> gainTrack {};
+};
+
+}  // namespace DSP
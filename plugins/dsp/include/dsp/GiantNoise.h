@@ -0,0 +1,126 @@
+/*
+  ==============================================================================
+
+   GiantNoise.h
+   Deterministic, realtime-safe noise for the Giant Instruments engines
+
+   Four interleaved xoshiro128+ streams generate uniform noise a block at a
+   time (the lane loop is plain 32-bit adds, xors and rotates, which the
+   compiler vectorizes); callers read single samples from the block.
+   Seeding is a few splitmix64 steps: no syscalls, no allocation, safe to
+   construct or reseed on any thread.
+
+   Per-voice streams come from deriveSeed(engineSeed, voiceIndex), so an
+   engine seed reproduces every voice's noise in offline renders.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Block-generated uniform noise (xoshiro128+, 4 lanes)
+ */
+class GiantNoise
+{
+public:
+    static constexpr int lanes = 4;
+    static constexpr int blockSize = 64;  // Samples generated per refill
+
+    explicit GiantNoise(uint64_t seedValue = 0x9E3779B97F4A7C15ull)
+    {
+        seed(seedValue);
+    }
+
+    /** Restart the sequence from a seed (same seed, same noise) */
+    void seed(uint64_t seedValue)
+    {
+        uint64_t mix = seedValue;
+        for (int lane = 0; lane < lanes; ++lane)
+        {
+            const uint64_t a = splitMix64(mix);
+            const uint64_t b = splitMix64(mix);
+            s0[lane] = static_cast<uint32_t>(a);
+            s1[lane] = static_cast<uint32_t>(a >> 32);
+            s2[lane] = static_cast<uint32_t>(b);
+            s3[lane] = static_cast<uint32_t>(b >> 32) | 1u;  // Never all zero
+        }
+        position = blockSize;
+    }
+
+    /** Seed for one stream (voice) of an engine
+        @param engineSeed   Engine-wide seed (preset / render setting)
+        @param stream       Stream index, e.g. the voice number
+        @returns            Decorrelated seed for that stream */
+    static uint64_t deriveSeed(uint64_t engineSeed, uint64_t stream)
+    {
+        uint64_t mix = engineSeed ^ (0xD1B54A32D192ED03ull * (stream + 1));
+        return splitMix64(mix);
+    }
+
+    /** Next uniform sample in [0, 1) */
+    float nextUniform()
+    {
+        if (position == blockSize)
+        {
+            generate(buffer.data());
+            position = 0;
+        }
+        return buffer[static_cast<size_t>(position++)];
+    }
+
+    /** Next uniform sample in [-1, 1) */
+    float nextBipolar()
+    {
+        return nextUniform() * 2.0f - 1.0f;
+    }
+
+private:
+    alignas(16) uint32_t s0[lanes];
+    alignas(16) uint32_t s1[lanes];
+    alignas(16) uint32_t s2[lanes];
+    alignas(16) uint32_t s3[lanes];
+
+    alignas(16) std::array<float, blockSize> buffer {};
+    int position = blockSize;
+
+    static uint64_t splitMix64(uint64_t& state)
+    {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    /** One block: each lane advances blockSize / lanes steps */
+    void generate(float* dest)
+    {
+        for (int i = 0; i < blockSize; i += lanes)
+        {
+            for (int lane = 0; lane < lanes; ++lane)
+            {
+                const uint32_t result = s0[lane] + s3[lane];
+                const uint32_t t = s1[lane] << 9;
+
+                s2[lane] ^= s0[lane];
+                s3[lane] ^= s1[lane];
+                s1[lane] ^= s2[lane];
+                s0[lane] ^= s3[lane];
+                s2[lane] ^= t;
+                s3[lane] = (s3[lane] << 11) | (s3[lane] >> 21);
+
+                // Top 24 bits (the strongest in xoshiro128+) to [0, 1)
+                dest[i + lane] = static_cast<float>(result >> 8) * (1.0f / 16777216.0f);
+            }
+        }
+    }
+};
+
+}  // namespace DSP
@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+   GiantParameterQueue.h
+   Wait-free message thread -> audio thread parameter hand-off
+
+   Parameter writes from the editor and host-facing API are pushed here
+   instead of calling InstrumentDSP::setParameter while the audio thread
+   is inside process(). Each write carries a sample offset into the next
+   block: the audio thread splits the block at the offsets and applies the
+   writes in order through setParameter() at the start of each sub-block,
+   so engines only ever see parameter changes on the render thread.
+
+   Each write is also tagged with the generation of the engine it is meant
+   for. When the engine is switched out the audio thread drops its
+   leftover writes itself, so only the consumer ever moves the read index.
+
+   Single producer, single consumer: one thread pushes, one thread pops at
+   a time. Fixed capacity, no allocation after construction.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * One queued parameter write
+ */
+struct GiantParameterEvent
+{
+    static constexpr size_t maxParamIdLength = 47;
+
+    char paramId[maxParamIdLength + 1] = {};
+    float value = 0.0f;
+    int sampleOffset = 0;       // Into the block that picks the write up
+    uint32_t generation = 0;    // Engine the write is meant for
+};
+
+//==============================================================================
+/**
+ * Lock-free SPSC ring of parameter writes
+ */
+class GiantParameterQueue
+{
+public:
+    static constexpr size_t capacity = 1024;    // Power of two
+
+    /** Producer: queue a write
+        @returns    false if the queue is full or the ID is too long */
+    bool push(const char* paramId, float value, int sampleOffset = 0, uint32_t generation = 0)
+    {
+        const size_t length = std::strlen(paramId);
+        if (length > GiantParameterEvent::maxParamIdLength)
+            return false;
+
+        const size_t write = writeIndex.load(std::memory_order_relaxed);
+        if (write - readIndex.load(std::memory_order_acquire) == capacity)
+            return false;
+
+        auto& event = events[write & (capacity - 1)];
+        std::memcpy(event.paramId, paramId, length + 1);
+        event.value = value;
+        event.sampleOffset = sampleOffset;
+        event.generation = generation;
+
+        writeIndex.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Consumer: the oldest write meant for `generation`, without taking it
+        Writes for earlier generations (switched-out engines) are dropped on
+        the way; writes for a later one stay queued until it is current.
+        @returns    nullptr if there is none (valid until pop()) */
+    const GiantParameterEvent* front(uint32_t generation)
+    {
+        for (;;)
+        {
+            const size_t read = readIndex.load(std::memory_order_relaxed);
+            if (read == writeIndex.load(std::memory_order_acquire))
+                return nullptr;
+
+            const auto& event = events[read & (capacity - 1)];
+            const auto age = static_cast<int32_t>(event.generation - generation);   // Wraps
+            if (age > 0)
+                return nullptr;
+            if (age == 0)
+                return &event;
+
+            readIndex.store(read + 1, std::memory_order_release);
+        }
+    }
+
+    /** Consumer: take the write front() returned */
+    void pop()
+    {
+        readIndex.store(readIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+private:
+    static_assert((capacity & (capacity - 1)) == 0, "capacity must be a power of two");
+
+    std::array<GiantParameterEvent, capacity> events;
+    alignas(64) std::atomic<size_t> writeIndex { 0 };
+    alignas(64) std::atomic<size_t> readIndex { 0 };
+};
+
+}  // namespace DSP
@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+   GiantPublisher.h
+   Message thread -> audio thread hand-off of immutable snapshots
+
+   The message thread builds a new object (tuning table, modulation
+   settings, a prepared engine, ...) and publishes it with an atomic
+   pointer swap; the audio thread picks up the latest one at the start of
+   a block.
+
+   Publishing is a single-reader hazard pointer: the audio thread marks the
+   object it is using, and the message thread frees a retired object only
+   once the audio thread has moved past it. No locks, no allocation and no
+   frees on the audio thread.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Latest-value hand-off to one audio-thread reader
+ * T is usually const: the audio thread reads a snapshot, it never edits it.
+ */
+template <typename T>
+class GiantPublisher
+{
+public:
+    GiantPublisher() = default;
+
+    /** Message thread: make a new object current and free the retired ones
+        the audio thread is no longer reading (nullptr publishes "none") */
+    void publish(std::shared_ptr<T> object)
+    {
+        current.store(object.get());
+        if (object != nullptr)
+            owned.push_back(std::move(object));
+        collectGarbage();
+    }
+
+    /** Message thread: free retired objects (call again later if the audio
+        thread was still holding one during publish())
+        @returns    true once nothing retired is left */
+    bool collectGarbage()
+    {
+        T* live = current.load();
+        T* held = inUse.load();
+
+        owned.erase(std::remove_if(owned.begin(), owned.end(),
+                                   [live, held](const std::shared_ptr<T>& object)
+                                   {
+                                       return object.get() != live && object.get() != held;
+                                   }),
+                    owned.end());
+
+        return owned.size() <= ((live != nullptr) ? 1u : 0u);
+    }
+
+    /** Message thread: the latest published object (nullptr until published) */
+    T* getCurrent() const { return current.load(); }
+
+    /** Audio thread: current object for this block (nullptr until published)
+        Valid until the next acquire(). */
+    T* acquire()
+    {
+        // Re-check after marking, so publish() never frees what we just marked
+        T* object = current.load();
+        for (;;)
+        {
+            inUse.store(object);
+            T* latest = current.load();
+            if (latest == object)
+                return object;
+            object = latest;
+        }
+    }
+
+private:
+    std::atomic<T*> current { nullptr };
+    std::atomic<T*> inUse { nullptr };
+    std::vector<std::shared_ptr<T>> owned;      // Message thread only
+};
+
+}  // namespace DSP
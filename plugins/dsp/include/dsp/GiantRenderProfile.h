@@ -0,0 +1,43 @@
+/*
+  ==============================================================================
+
+   GiantRenderProfile.h
+   Realtime vs offline render quality for the Giant Instruments engines
+
+   Live playback runs the lean profile: mode level of detail, control-rate
+   updates and the CPU budget governor keep each block well inside its
+   deadline. A bounce has no deadline, so the processor switches engines
+   to the offline profile while the host reports non-realtime rendering:
+   every mode on every hit, anti-aliased nonlinearities, per-sample
+   control updates and no budget trimming.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace DSP {
+
+//==============================================================================
+enum class GiantRenderProfile
+{
+    Realtime = 0,      // Lean: tuned for low CPU
+    Offline            // High quality: bounce/export
+};
+
+//==============================================================================
+/**
+ * Engines with a separate offline quality profile
+ */
+class GiantRenderProfileTarget
+{
+public:
+    virtual ~GiantRenderProfileTarget() = default;
+
+    /** Switch profile (audio thread, between blocks)
+        Sounding notes keep the detail they were triggered with; new notes
+        and per-block settings follow immediately. */
+    virtual void setRenderProfile(GiantRenderProfile profile) = 0;
+};
+
+}  // namespace DSP
@@ -0,0 +1,71 @@
+/*
+  ==============================================================================
+
+   GiantResampler.h
+   Integer-factor polyphase upsampler (engine rate -> host rate)
+
+   Giant instruments have almost nothing above 20 kHz, yet the engines'
+   cost grows linearly with the host rate. Running an engine at
+   hostRate / factor and interpolating back up keeps the sound and divides
+   the cost by the factor (4x at 192 kHz with a 48 kHz engine).
+
+   The interpolator is a linear-phase Kaiser-windowed sinc, split into
+   `factor` phases of tapsPerPhase taps each, so every output sample is one
+   short dot product (SIMD) over the input history. At a 48 kHz engine
+   rate the passband is flat to 20 kHz; the stopband starts at the engine
+   Nyquist, so images of anything the engine renders are down > 80 dB.
+   The constant group delay is reported by getLatencySamples().
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Polyphase FIR interpolator for up to maxChannels channels
+ */
+class GiantUpsampler
+{
+public:
+    static constexpr int maxFactor = 4;
+    static constexpr int maxChannels = 2;
+    static constexpr int tapsPerPhase = 64;     // Multiple of 8 (two SIMD accumulators)
+
+    GiantUpsampler() = default;
+    ~GiantUpsampler() = default;
+
+    /** Design the filter and allocate history (not realtime safe)
+        @param factor   Output samples per input sample (1 - maxFactor; 1 = bypass) */
+    void prepare(int factor);
+    void reset();
+
+    int getFactor() const { return factor; }
+
+    /** Group delay in output (host rate) samples */
+    int getLatencySamples() const;
+
+    /** Interpolate numInputSamples per channel into numInputSamples * factor
+        @param input        Engine-rate channels
+        @param output       Host-rate channels (may not alias input)
+        @param numChannels  1 - maxChannels */
+    void process(const float* const* input, float* const* output, int numChannels, int numInputSamples);
+
+private:
+    int factor = 1;
+
+    // phaseCoefficients[p * tapsPerPhase + k] multiplies x[n - k] for output phase p
+    std::vector<float> phaseCoefficients;
+
+    // Per channel, history mirrored (2 * tapsPerPhase) so the newest
+    // tapsPerPhase inputs are always contiguous, newest first
+    std::array<std::vector<float>, maxChannels> history;
+    int historyPosition = 0;
+};
+
+}  // namespace DSP
@@ -0,0 +1,119 @@
+/*
+  ==============================================================================
+
+   GiantSharedTables.h
+   Process-wide read-only DSP tables for the Giant Instruments engines
+
+   Tables that every voice of every plugin instance would otherwise build
+   (horn formant coefficients, vowel formants, membrane mode ratios, mallet
+   impulse bursts) live here once per process and sample rate. Engines
+   acquire() a reference in prepare() and hand a plain pointer to their
+   voices; the last instance to release a sample rate frees its tables.
+   Nothing here is ever written after construction, so the audio thread
+   reads it without locking.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Reference-counted immutable tables, one instance per sample rate
+ */
+class GiantSharedTables
+{
+public:
+    static constexpr int numHornTypes = 6;       // HornFormantShaper::HornType
+    static constexpr int maxHornFormants = 4;
+    static constexpr int numVowels = 7;          // Ah, Eh, Ee, Oh, Oo, Uh, Ih
+    static constexpr int numMembraneModes = 6;
+    static constexpr int numMalletTypes = 4;     // StrikeExciter::MalletType
+    static constexpr int numMalletHardnessLayers = 3;
+    static constexpr int numMalletVelocityLayers = 3;
+
+    /** Horn formant resonator with its sample-rate dependent coefficients */
+    struct HornFormant
+    {
+        float frequency = 500.0f;
+        float amplitude = 1.0f;
+        float bandwidth = 1.5f;
+        float pole = 0.0f;              // Resonator radius r
+        float phaseIncrement = 0.0f;    // Radians per sample
+    };
+
+    struct HornFormantSet
+    {
+        int count = 0;
+        std::array<HornFormant, maxHornFormants> formants {};
+    };
+
+    /** Vowel formant frequencies and bandwidths (Hz) */
+    struct VowelFormants
+    {
+        const char* name;
+        float f1, f2, f3, f4;  // Formant frequencies
+        float b1, b2, b3, b4;  // Formant bandwidths (Hz)
+    };
+
+    // Circular membrane mode ratios (Bessel function J_n roots)
+    // (0,1)=1.0, (1,1)=1.59, (2,1)=2.14, (0,2)=2.30, (3,1)=2.65, (1,2)=2.92
+    static constexpr float membraneModeRatios[numMembraneModes] = { 1.0f, 1.59f, 2.14f, 2.30f, 2.65f, 2.92f };
+
+    // Q factors for realistic membrane decay (higher modes decay faster)
+    static constexpr float membraneModeQFactors[numMembraneModes] = { 50.0f, 40.0f, 30.0f, 25.0f, 20.0f, 15.0f };
+
+    /** Get the shared tables for a sample rate, building them on first use
+        Takes a lock and may allocate: call from prepare(), never from process().
+        @param sampleRate   Sample rate the tables are computed for
+        @returns            Shared reference; tables live while any holder remains */
+    static std::shared_ptr<const GiantSharedTables> acquire(double sampleRate);
+
+    /** Number of sample rates with live tables (diagnostics and tests) */
+    static int getLiveTableCount();
+
+    double getSampleRate() const { return sr; }
+
+    /** Precomputed formants for a horn type (clamped to a valid type) */
+    const HornFormantSet& getHornFormants(int hornType) const;
+
+    /** Build a horn formant set without the registry (used before prepare()) */
+    static HornFormantSet buildHornFormants(int hornType, double sampleRate);
+
+    /** Adult male reference vowel (index clamped to 0-6) */
+    static const VowelFormants& getStandardVowel(int vowelIndex);
+
+    /** Giant-scaled vowel: lower formants, wider bandwidths (index clamped to 0-6) */
+    static const VowelFormants& getGiantVowel(int vowelIndex);
+
+    /** Mallet contact burst: half-sine contact force plus the beater's tick,
+        band-limited and normalized to unit area (same low-frequency energy
+        as a unit impulse). getMalletBurstLength() samples long, zero padded.
+        Indices are clamped to the valid layer range. */
+    const float* getMalletContact(int malletType, int hardnessLayer, int velocityLayer) const;
+
+    /** Mallet surface noise burst, coloured per mallet type (unit area) */
+    const float* getMalletNoise(int malletType, int hardnessLayer) const;
+
+    int getMalletBurstLength() const { return malletBurstLength; }
+
+private:
+    explicit GiantSharedTables(double sampleRate);
+
+    double sr;
+    std::array<HornFormantSet, numHornTypes> hornFormants;
+
+    int malletBurstLength = 0;
+    std::vector<float> malletContact;   // [type][hardness][velocity][sample]
+    std::vector<float> malletNoise;     // [type][hardness][sample]
+
+    void buildMalletLibrary();
+};
+
+}  // namespace DSP
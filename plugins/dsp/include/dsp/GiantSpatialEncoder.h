@@ -0,0 +1,192 @@
+/*
+  ==============================================================================
+
+   GiantSpatialEncoder.h
+   Ambisonic and speaker-bed encoding for the Giant Instruments engines
+
+   Engines that implement GiantSpatialSource render each sounding voice as
+   a mono stem with a placement across the instrument; other engines give
+   a stereo pair. Every stem is a point source: GiantSpatialEncoder turns
+   its direction into one gain per output channel and GiantSpatialMixer
+   accumulates gain * stem straight into the host's channel buffers, once
+   per block, with the gains ramped across the block.
+
+   Formats:
+   - Ambisonics, order 1-3: ACN channel order, SN3D normalization (AmbiX)
+   - Speaker beds (5.1, 7.1.4, ...): pairwise amplitude panning on the
+     ear-level ring, crossfaded into the height ring with elevation; LFE
+     channels are left silent
+
+   Bed sources touch two to four speakers, so mixing cost follows the
+   number of sounding voices, not the channel count.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Placement of one stem, relative to the instrument
+ */
+struct GiantStemPosition
+{
+    bool active = false;        // Silent stems are skipped by the mixer
+    bool retriggered = false;   // New note in this slot: jump to the position instead of ramping
+    float lateral = 0.0f;       // -1 (left edge) .. +1 (right edge) of the instrument's spread
+};
+
+//==============================================================================
+/**
+ * Engines that can render per-voice stems for spatial encoding
+ */
+class GiantSpatialSource
+{
+public:
+    virtual ~GiantSpatialSource() = default;
+
+    /** Number of stem slots processStems() may fill (one per voice) */
+    virtual int getNumStems() const = 0;
+
+    /** Render a block as one mono stem per voice instead of the mixed output
+        Master gain and bus limiting are applied to the stems, so their sum
+        equals the mono output process() would have produced.
+        @param stems       getNumStems() buffers of numSamples (overwritten)
+        @param positions   getNumStems() placements, filled per block */
+    virtual void processStems(float* const* stems, GiantStemPosition* positions, int numSamples) = 0;
+};
+
+//==============================================================================
+/**
+ * Hand a bus stage's change to the voices that fed it
+ *
+ * voiceOutputs hold each voice's raw sample; processed is what the bus
+ * (clip, guard) made of their sum. The values are rewritten so they sum to
+ * processed:
+ * - Within full scale the difference is spread over the voices in
+ *   proportion to their magnitude, leaving unclipped voices untouched
+ * - Voices driven far past full scale (which the bus clip flattens, and
+ *   which may cancel each other in the sum) become bounded shares of the
+ *   processed sample instead, so no stem carries more than 3x the bus output
+ * The two blend smoothly between 1x and 4x full scale.
+ */
+inline void distributeBusSample(float* voiceOutputs, int numVoices, float processed)
+{
+    float sum = 0.0f;
+    float magnitude = 0.0f;
+    for (int v = 0; v < numVoices; ++v)
+    {
+        sum += voiceOutputs[v];
+        magnitude += std::abs(voiceOutputs[v]);
+    }
+
+    // Silent (or non-finite) voices: share the bus output evenly
+    if (!(magnitude > 1.0e-12f) || !std::isfinite(magnitude))
+    {
+        const float share = (numVoices > 0) ? processed / static_cast<float>(numVoices) : 0.0f;
+        for (int v = 0; v < numVoices; ++v)
+            voiceOutputs[v] = share;
+        return;
+    }
+
+    const float residualScale = (processed - sum) / magnitude;
+    const float boundedScale = processed / magnitude;
+    const float boundedResidual = 1.0f - sum / magnitude;
+    const float overload = std::min(1.0f, std::max(0.0f, (magnitude - 1.0f) / 3.0f));
+
+    for (int v = 0; v < numVoices; ++v)
+    {
+        const float voice = voiceOutputs[v];
+        const float share = voice + std::abs(voice) * residualScale;
+        const float bounded = boundedScale * (voice + std::abs(voice) * boundedResidual);
+        voiceOutputs[v] = (1.0f - overload) * share + overload * bounded;
+    }
+}
+
+//==============================================================================
+/**
+ * Speaker of a bed layout (azimuth: degrees, positive to the left)
+ */
+struct GiantSpeaker
+{
+    float azimuthDegrees = 0.0f;
+    float elevationDegrees = 0.0f;
+    bool lfe = false;
+};
+
+//==============================================================================
+/**
+ * Direction -> per-channel gains for an Ambisonic order or a speaker bed
+ */
+class GiantSpatialEncoder
+{
+public:
+    static constexpr int maxAmbisonicOrder = 3;
+    static constexpr int maxChannels = (maxAmbisonicOrder + 1) * (maxAmbisonicOrder + 1);
+
+    /** Ambisonic output: (order + 1)^2 channels, ACN/SN3D */
+    void configureAmbisonic(int order);
+
+    /** Speaker bed output: one channel per speaker, in the host's channel order
+        (speakers past maxChannels are ignored) */
+    void configureSpeakers(const std::vector<GiantSpeaker>& speakers);
+
+    int getNumChannels() const { return numChannels; }
+
+    /** Gains for a source direction
+        @param azimuthDegrees    0 = front, positive to the left
+        @param elevationDegrees  0 = ear level, positive up
+        @param gains             getNumChannels() values */
+    void computeGains(float azimuthDegrees, float elevationDegrees, float* gains) const;
+
+private:
+    struct Ring
+    {
+        std::vector<int> channels;          // Sorted by azimuth
+        std::vector<float> azimuths;        // Radians
+    };
+
+    void panOnRing(const Ring& ring, float azimuth, float gain, float* gains) const;
+
+    int ambisonicOrder = -1;                // -1 = speaker bed
+    int numChannels = 0;
+    Ring earLevel;
+    Ring height;
+};
+
+//==============================================================================
+/**
+ * Block-wise accumulation of mono sources into multichannel output
+ */
+class GiantSpatialMixer
+{
+public:
+    /** Allocate gain state (not realtime safe) */
+    void prepare(int numChannels, int maxSources);
+
+    /** Forget previous gains: every source starts from its target */
+    void reset();
+
+    int getNumChannels() const { return numChannels; }
+    int getMaxSources() const { return maxSources; }
+
+    /** outputs[c] += gain[c] * signal, gains ramped from the source's previous block
+        @param sourceId     0 .. maxSources - 1 (gain smoothing is per id)
+        @param targetGains  getNumChannels() gains for the end of the block
+        @param snap         Start at the target instead of ramping (new note) */
+    void addSource(int sourceId, const float* signal, const float* targetGains, bool snap,
+                   float* const* outputs, int numSamples);
+
+private:
+    int numChannels = 0;
+    int maxSources = 0;
+    std::vector<float> currentGains;        // [source * numChannels + channel]
+    std::vector<bool> started;
+};
+
+}  // namespace DSP
@@ -0,0 +1,129 @@
+/*
+  ==============================================================================
+
+   GiantTuningTable.h
+   Precomputed note frequencies for the Giant Instruments engines
+
+   The plugin's microtonal tuning is evaluated once per note into a
+   128-entry table whenever the tuning changes (message thread). The table
+   is published with an atomic pointer swap; the audio thread picks it up
+   at the start of a block and hands it to the engine, whose voices read
+   their pitch from it at trigger time (one load per note). Sounding
+   voices glide to their retuned pitch instead of jumping.
+
+   Publishing goes through GiantPublisher: the message thread frees a
+   retired table only once the audio thread has moved past it. No locks,
+   no allocation and no frees on the audio thread.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "dsp/GiantPublisher.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Immutable MIDI note -> frequency table
+ */
+class GiantTuningTable
+{
+public:
+    static constexpr int numNotes = 128;
+
+    /** 12-TET, A4 (note 69) = 440 Hz */
+    GiantTuningTable()
+    {
+        for (int note = 0; note < numNotes; ++note)
+            frequencies[static_cast<size_t>(note)] = static_cast<float>(440.0 * std::pow(2.0, (note - 69) / 12.0));
+    }
+
+    /** Tabulate any tuning
+        @param midiToFrequency  Callable int note -> frequency in Hz (not realtime safe is fine) */
+    template <typename MidiToFrequency>
+    explicit GiantTuningTable(MidiToFrequency&& midiToFrequency)
+    {
+        for (int note = 0; note < numNotes; ++note)
+            frequencies[static_cast<size_t>(note)] = static_cast<float>(midiToFrequency(note));
+    }
+
+    /** Shared 12-TET table (engines use it until a tuning is published) */
+    static const GiantTuningTable& equalTemperament()
+    {
+        static const GiantTuningTable table;
+        return table;
+    }
+
+    /** Frequency of a MIDI note (clamped to 0-127) */
+    float getFrequency(int note) const
+    {
+        return frequencies[static_cast<size_t>(std::clamp(note, 0, numNotes - 1))];
+    }
+
+private:
+    std::array<float, numNotes> frequencies {};
+};
+
+//==============================================================================
+/**
+ * Engines whose pitch follows the published tuning
+ */
+class GiantTunable
+{
+public:
+    virtual ~GiantTunable() = default;
+
+    /** Tuning for new notes; sounding notes glide to their new pitch
+        Called on the audio thread between blocks. The table stays valid
+        until the next call. nullptr = 12-TET. */
+    virtual void setTuningTable(const GiantTuningTable* table) = 0;
+};
+
+/** Message thread -> audio thread tuning hand-off (GiantPublisher.h) */
+using GiantTuningPublisher = GiantPublisher<const GiantTuningTable>;
+
+//==============================================================================
+/**
+ * Per-voice pitch that glides (geometrically) to a retuned target
+ */
+struct GiantPitchGlide
+{
+    static constexpr float glideSeconds = 0.05f;   // Retune time for sounding notes
+
+    float frequency = 440.0f;
+    float target = 440.0f;
+    float step = 1.0f;          // Per-sample ratio while gliding
+    int remaining = 0;
+
+    void set(float newFrequency)
+    {
+        frequency = target = newFrequency;
+        remaining = 0;
+    }
+
+    void glideTo(float newTarget, double sampleRate)
+    {
+        if (newTarget == target)
+            return;
+
+        target = newTarget;
+        remaining = std::max(1, static_cast<int>(glideSeconds * sampleRate));
+        step = std::pow(target / frequency, 1.0f / static_cast<float>(remaining));
+    }
+
+    bool isGliding() const { return remaining > 0; }
+
+    /** Advance one sample (only call while gliding) */
+    float advance()
+    {
+        frequency = (--remaining > 0) ? frequency * step : target;
+        return frequency;
+    }
+};
+
+}  // namespace DSP
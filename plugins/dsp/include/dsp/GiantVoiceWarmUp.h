@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+   GiantVoiceWarmUp.h
+   Lazy voice preparation for the Giant Instruments engines
+
+   prepare() only constructs voices and fully prepares a small eager pool so
+   the first notes never wait. The remaining voices are prepared by a
+   host-side warm-up (the plugin processor drives this from a message-thread
+   timer, offline renderers warm every voice up front). Preparing allocates,
+   so the audio thread never does it: until a voice is warm, note-ons that
+   would need it steal from the prepared voices instead.
+
+   The warm-up runs alongside the audio thread without a lock. It only
+   touches voices whose atomic `ready` flag is still clear, allocates their
+   buffers, then sets `ready` (release). findFreeVoice() on the audio thread
+   sees the flag (acquire), replays the current settings onto the voice and
+   sets the voice's plain `prepared` flag, which only the audio thread reads
+   from then on. Until a voice is adopted that way the audio thread reads
+   nothing of it but `active`, which the warm-up never writes.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Background warm-up interface for engines with lazily prepared voices
+ */
+class GiantVoiceWarmUp
+{
+public:
+    virtual ~GiantVoiceWarmUp() = default;
+
+    /** Prepare up to maxVoices cold voices. Safe to call while the audio
+        thread renders, but not concurrently with prepare() or another warm-up.
+        @param maxVoices    Work limit for this call
+        @returns            Number of voices still cold afterwards */
+    virtual int warmUpVoices(int maxVoices) = 0;
+
+    /** Number of voices warm (buffers allocated and published) */
+    virtual int getPreparedVoiceCount() const = 0;
+};
+
+}  // namespace DSP
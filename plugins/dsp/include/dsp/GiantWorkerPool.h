@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+   GiantWorkerPool.h
+   Fork-join worker threads for the offline renderers
+
+   GiantChunkRenderer (chunks of one timeline) and GiantBatchRenderer
+   (isolated notes) both split their work into independent tasks that
+   each own an engine instance. run() starts the workers, lets them take
+   task indices from a shared counter and joins them; the calling thread
+   works too. Tasks must write disjoint outputs: the counter is the only
+   state the workers share.
+
+   Offline only: threads are created per run() call.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Runs independent tasks on worker threads and waits for all of them
+ */
+class GiantWorkerPool
+{
+public:
+    /** Threads to use for numTasks tasks
+        @param requested    Thread count, 0 = one per hardware thread
+        @returns            Between 1 and numTasks */
+    static int threadCount(int requested, int numTasks)
+    {
+        const int hardwareThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        return std::max(1, std::min(numTasks, (requested > 0) ? requested : hardwareThreads));
+    }
+
+    /** Call task(i) for every i in [0, numTasks) across numThreads threads
+        (the caller included); returns once every task has finished */
+    template <typename Task>
+    static void run(int numTasks, int numThreads, Task&& task)
+    {
+        std::atomic<int> nextTask { 0 };
+        auto worker = [&]
+        {
+            for (int i = nextTask.fetch_add(1); i < numTasks; i = nextTask.fetch_add(1))
+                task(i);
+        };
+
+        std::vector<std::thread> threads;
+        for (int t = 1; t < numThreads; ++t)
+            threads.emplace_back(worker);
+        worker();
+        for (auto& thread : threads)
+            thread.join();
+    }
+};
+
+}  // namespace DSP
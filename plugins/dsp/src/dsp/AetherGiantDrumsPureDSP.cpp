@@ -19,12 +19,22 @@
 */
 
 #include "dsp/AetherGiantDrumsDSP.h"
+#include "dsp/GiantSharedTables.h"
 #include "dsp/InstrumentFactory.h"
 #include "../../../../include/dsp/LookupTables.h"
 #include <cmath>
 #include <algorithm>
 #include <random>
 
+// Platform-specific SIMD includes (room FDN runs 8 lanes as two 4-wide halves)
+#if defined(__ARM_NEON) || defined(__aarch64__)
+    #include <arm_neon.h>
+    #define DSP_SIMD_NEON_AVAILABLE 1
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define DSP_SIMD_SSE_AVAILABLE 1
+#endif
+
 namespace DSP {
 
 //==============================================================================
@@ -36,8 +46,8 @@ void SVFMembraneMode::prepare(double sr)
     sampleRate = sr;
 
     // Initialize SVF filter state
-    z1 = 0.0f;
-    z2 = 0.0f;
+    z1 = 0.0;
+    z2 = 0.0;
 
     // Calculate filter coefficients
     calculateCoefficients();
@@ -50,30 +60,32 @@ float SVFMembraneMode::processSample(float excitation)
     // State Variable Filter (TPT structure) for realistic membrane resonance
     // Based on Andy Simper's trapezoidal integrator design
 
-    // Apply excitation through filter
-    float hp = excitation - z1 * (resonance + 1.0f) - z2;
-    float bp = z1 + frequencyFactor * hp;
-    float lp = z2 + frequencyFactor * bp;
+    // Apply excitation through filter (double-precision state)
+    const double g = frequencyFactor;
+    double hp = excitation - z1 * (resonance + 1.0) - z2;
+    double bp = z1 + g * hp;
+    double lp = z2 + g * bp;
 
     // Update state
     z1 = bp;
     z2 = lp;
 
     // Output from bandpass (resonant mode)
-    float output = bp * amplitude;
+    double output = bp * amplitude;
 
-    // Apply energy decay (simulates air damping and membrane loss)
-    energy = energy * decay + excitation * amplitude;
+    // Apply energy decay (simulates air damping and membrane loss); any drive,
+    // including a sympathetic one of either sign, feeds the envelope
+    energy = energy * decay + std::abs(static_cast<double>(excitation)) * amplitude;
     output *= energy;
 
-    return output;
+    return static_cast<float>(output);
 }
 
 void SVFMembraneMode::reset()
 {
-    z1 = 0.0f;
-    z2 = 0.0f;
-    energy = 0.0f;
+    z1 = 0.0;
+    z2 = 0.0;
+    energy = 0.0;
     coefficientsDirty = true;
 }
 
@@ -105,9 +117,12 @@ void SVFMembraneMode::calculateCoefficients()
 // MembraneResonator Implementation
 //==============================================================================
 
+static_assert(MembraneResonator::maxModes == GiantSharedTables::numMembraneModes,
+              "Membrane setups hold one entry per shared mode ratio");
+
 MembraneResonator::MembraneResonator()
 {
-    svfModes.resize(6);  // Max 6 SVF modes
+    svfModes.resize(maxModes);  // Max 6 SVF modes
 }
 
 void MembraneResonator::prepare(double sampleRate)
@@ -118,8 +133,7 @@ void MembraneResonator::prepare(double sampleRate)
         mode.prepare(sampleRate);
     }
 
-    updateModeFrequencies();
-    updateModeDecays();
+    loadSetup(makeSetup(params, sr));
 }
 
 void MembraneResonator::reset()
@@ -140,7 +154,9 @@ void MembraneResonator::strike(float velocity, float force, float contactArea)
     // Distribute energy among SVF modes (fundamental gets most)
     float energySum = 0.0f;
 
-    for (size_t i = 0; i < svfModes.size() && i < static_cast<size_t>(params.numModes); ++i) {
+    // Only rendered modes take energy; trimmed ones would hold it undecayed
+    const size_t activeModes = static_cast<size_t>(std::min(params.numModes, modeLimit));
+    for (size_t i = 0; i < svfModes.size() && i < activeModes; ++i) {
         // Lower modes get more energy (modeled after circular membrane physics)
         float modeEnergy = strikePower / (1.0f + static_cast<float>(i) * 0.5f);
         svfModes[i].energy = modeEnergy;
@@ -155,14 +171,15 @@ void MembraneResonator::strike(float velocity, float force, float contactArea)
     strikeEnergy = strikePower;
 }
 
-float MembraneResonator::processSample()
+float MembraneResonator::processSample(float excitation)
 {
     float output = 0.0f;
     totalEnergy = 0.0f;
 
-    // Sum all active SVF modes
-    for (int i = 0; i < params.numModes && i < static_cast<int>(svfModes.size()); ++i) {
-        output += svfModes[i].processSample(0.0f);
+    // Sum all active SVF modes (modeLimit trims high modes under CPU pressure)
+    const int activeModes = std::min(params.numModes, modeLimit);
+    for (int i = 0; i < activeModes && i < static_cast<int>(svfModes.size()); ++i) {
+        output += svfModes[i].processSample(excitation);
         totalEnergy += svfModes[i].energy;
     }
 
@@ -171,69 +188,123 @@ float MembraneResonator::processSample()
 
 void MembraneResonator::setParameters(const Parameters& p)
 {
-    params = p;
-    updateModeFrequencies();
-    updateModeDecays();
+    loadSetup(makeSetup(p, sr));
 }
 
-float MembraneResonator::getEnergy() const
+MembraneResonator::Setup MembraneResonator::makeSetup(const Parameters& p, double sampleRate)
 {
-    return totalEnergy;
-}
+    Setup setup;
+    setup.params = p;
 
-void MembraneResonator::updateModeFrequencies()
-{
     // Calculate SVF mode frequencies based on circular membrane physics
     // Fundamental (0,1) mode + higher overtones using Bessel function roots
-    float fundamental = params.fundamentalFrequency;
+    float fundamental = p.fundamentalFrequency;
 
-    // Scale frequency by diameter (larger drums = lower pitch)
-    float diameterScale = 1.0f / std::sqrt(params.diameterMeters);
-    fundamental *= diameterScale;
+    // Scale frequency by diameter (larger drums = lower pitch) and tension
+    // (f ~ sqrt(T), nominal at 0.5)
+    fundamental *= 1.0f / std::sqrt(p.diameterMeters);
+    fundamental *= std::sqrt(std::max(0.05f, p.tension) / 0.5f);
 
-    // Mode ratios for circular membrane (Bessel function J_n roots)
-    // (0,1)=1.0, (1,1)=1.59, (2,1)=2.14, (0,2)=2.30, (3,1)=2.65, (1,2)=2.92
-    float modeRatios[] = {1.0f, 1.59f, 2.14f, 2.30f, 2.65f, 2.92f};
+    // Larger drums have longer sustain (slower decay, air mass effect)
+    const float diameterFactor = std::sqrt(p.diameterMeters);
+    const float modeDecay = p.damping * (0.995f + 0.004f * diameterFactor);
 
-    // Q factors for realistic membrane decay (higher modes decay faster)
-    float modeQFactors[] = {50.0f, 40.0f, 30.0f, 25.0f, 20.0f, 15.0f};
+    // Mode ratios (Bessel roots) and Q factors from the shared tables
+    const float* modeRatios = GiantSharedTables::membraneModeRatios;
+    const float* modeQFactors = GiantSharedTables::membraneModeQFactors;
+
+    for (int i = 0; i < maxModes; ++i) {
+        auto& mode = setup.modes[static_cast<size_t>(i)];
 
-    for (size_t i = 0; i < svfModes.size(); ++i) {
         // Apply inharmonicity to stretch modes (nonlinear membrane behavior)
-        float inharmonicStretch = 1.0f + static_cast<float>(i) * params.inharmonicity;
-        float newFrequency = fundamental * modeRatios[i] * inharmonicStretch;
-
-        // Set Q factor for realistic decay
-        float newQFactor = modeQFactors[i];
-
-        // Check if parameters changed
-        if (svfModes[i].frequency != newFrequency || svfModes[i].qFactor != newQFactor)
-        {
-            svfModes[i].frequency = newFrequency;
-            svfModes[i].qFactor = newQFactor;
-            svfModes[i].coefficientsDirty = true;
-        }
+        const float inharmonicStretch = 1.0f + static_cast<float>(i) * p.inharmonicity;
+        mode.frequency = fundamental * modeRatios[i] * inharmonicStretch;
+        mode.qFactor = modeQFactors[i];
 
         // Amplitude decreases for higher modes
-        svfModes[i].amplitude = 1.0f / (1.0f + static_cast<float>(i) * 0.3f);
+        mode.amplitude = 1.0f / (1.0f + static_cast<float>(i) * 0.3f);
+
+        // SVF coefficients (as SVFMembraneMode::calculateCoefficients)
+        const float omega = 2.0f * juce::MathConstants<float>::pi * mode.frequency;
+        mode.frequencyFactor = juce::jlimit(0.0f, 0.5f, omega / static_cast<float>(sampleRate));
+        mode.resonance = juce::jlimit(0.0f, 2.0f, mode.qFactor);
 
-        // Recalculate SVF coefficients with new frequency (only if dirty)
-        svfModes[i].calculateCoefficients();
+        mode.decay = std::min(0.9999, static_cast<double>(modeDecay));
     }
+
+    return setup;
 }
 
-void MembraneResonator::updateModeDecays()
+void MembraneResonator::loadSetup(const Setup& setup)
 {
-    // Larger drums have longer sustain (slower decay)
-    float diameterFactor = std::sqrt(params.diameterMeters);
+    params = setup.params;
 
-    for (auto& mode : svfModes) {
-        // Base decay modified by diameter
-        float modeDecay = params.damping;
-        // Slower decay for larger drums (air mass effect)
-        modeDecay = modeDecay * (0.995f + 0.004f * diameterFactor);
-        mode.decay = std::min(0.9999f, modeDecay);
+    for (size_t i = 0; i < svfModes.size(); ++i) {
+        const auto& source = setup.modes[i];
+        auto& mode = svfModes[i];
+
+        mode.frequency = source.frequency;
+        mode.qFactor = source.qFactor;
+        mode.amplitude = source.amplitude;
+        mode.frequencyFactor = source.frequencyFactor;
+        mode.resonance = source.resonance;
+        mode.decay = source.decay;
+
+        // Coefficients are current: keep the cache from recomputing them
+        mode.cachedFrequency = source.frequency;
+        mode.cachedQFactor = source.qFactor;
+        mode.coefficientsDirty = false;
+    }
+}
+
+float MembraneResonator::getEnergy() const
+{
+    return totalEnergy;
+}
+
+void MembraneResonator::setModeLimit(int limit)
+{
+    const int newLimit = juce::jlimit(1, static_cast<int>(svfModes.size()), limit);
+
+    // Silence modes that drop out so they don't ring back in when restored
+    for (int i = newLimit; i < modeLimit && i < static_cast<int>(svfModes.size()); ++i) {
+        svfModes[i].reset();
+    }
+
+    modeLimit = newLimit;
+}
+
+int MembraneResonator::countModesBelow(float frequencyHz) const
+{
+    // Bessel ratios ascend, so the level of detail keeps a prefix
+    const int activeModes = std::min(params.numModes, static_cast<int>(svfModes.size()));
+    int count = 0;
+    while (count < activeModes && svfModes[count].frequency < frequencyHz) {
+        ++count;
+    }
+    return count;
+}
+
+int MembraneResonator::trimMaskedModes(float maskingRatio)
+{
+    const int activeModes = std::min({ params.numModes, modeLimit, static_cast<int>(svfModes.size()) });
+
+    double strongest = 0.0;
+    for (int i = 0; i < activeModes; ++i) {
+        strongest = std::max(strongest, std::abs(svfModes[i].energy));
+    }
+
+    const double threshold = strongest * maskingRatio;
+    int newLimit = activeModes;
+    while (newLimit > 1 && std::abs(svfModes[newLimit - 1].energy) < threshold) {
+        --newLimit;
+    }
+
+    if (newLimit < activeModes) {
+        setModeLimit(newLimit);
     }
+
+    return std::min(modeLimit, activeModes);
 }
 
 //==============================================================================
@@ -253,7 +324,7 @@ void CoupledResonator::prepare(double sampleRate)
     shellVelocity = 0.0f;
 
     // Calculate coupling coefficients
-    calculateCouplingCoefficients();
+    deriveCoefficients(params);
 
     reset();
 }
@@ -302,10 +373,10 @@ void CoupledResonator::reset()
 void CoupledResonator::setParameters(const Parameters& p)
 {
     params = p;
-    calculateCouplingCoefficients();
+    deriveCoefficients(params);
 }
 
-void CoupledResonator::calculateCouplingCoefficients()
+void CoupledResonator::deriveCoefficients(Parameters& params)
 {
     // Calculate physical parameters from frequency and Q
     // Cavity acts as Helmholtz resonator
@@ -347,14 +418,7 @@ void ShellResonator::prepare(double sampleRate)
     coupledResonator.prepare(sampleRate);
 
     // Set initial parameters
-    CoupledResonator::Parameters coupledParams;
-    coupledParams.cavityFrequency = params.cavityFrequency;
-    coupledParams.shellFormant = params.shellFormant;
-    coupledParams.cavityQ = params.cavityQ;
-    coupledParams.shellQ = params.shellQ;
-    coupledParams.coupling = params.coupling;
-
-    coupledResonator.setParameters(coupledParams);
+    loadSetup(makeSetup(params));
 }
 
 void ShellResonator::reset()
@@ -377,16 +441,27 @@ float ShellResonator::processSample()
 
 void ShellResonator::setParameters(const Parameters& p)
 {
-    params = p;
+    loadSetup(makeSetup(p));
+}
 
-    CoupledResonator::Parameters coupledParams;
-    coupledParams.cavityFrequency = params.cavityFrequency;
-    coupledParams.shellFormant = params.shellFormant;
-    coupledParams.cavityQ = params.cavityQ;
-    coupledParams.shellQ = params.shellQ;
-    coupledParams.coupling = params.coupling;
+ShellResonator::Setup ShellResonator::makeSetup(const Parameters& p)
+{
+    Setup setup;
+    setup.params = p;
+    setup.coupled.cavityFrequency = p.cavityFrequency;
+    setup.coupled.shellFormant = p.shellFormant;
+    setup.coupled.cavityQ = p.cavityQ;
+    setup.coupled.shellQ = p.shellQ;
+    setup.coupled.coupling = p.coupling;
 
-    coupledResonator.setParameters(coupledParams);
+    CoupledResonator::deriveCoefficients(setup.coupled);
+    return setup;
+}
+
+void ShellResonator::loadSetup(const Setup& setup)
+{
+    params = setup.params;
+    coupledResonator.setDerivedParameters(setup.coupled);
 }
 
 //==============================================================================
@@ -404,12 +479,13 @@ void DrumNonlinearLoss::prepare(double sampleRate)
 
 void DrumNonlinearLoss::reset()
 {
+    softClip.reset();
 }
 
 float DrumNonlinearLoss::processSample(float input, float velocity)
 {
-    // Apply soft clipping saturation
-    float saturated = softClip(input * (1.0f + saturationAmount));
+    // Apply soft clipping saturation (ADAA: hard strikes don't alias)
+    float saturated = softClip.processSample(input * (1.0f + saturationAmount));
 
     // Apply dynamic damping based on level and velocity
     float damping = calculateDynamicDamping(std::abs(input), velocity);
@@ -430,15 +506,6 @@ void DrumNonlinearLoss::setMassEffect(float mass)
     massEffect = juce::jlimit(0.0f, 1.0f, mass);
 }
 
-float DrumNonlinearLoss::softClip(float x) const
-{
-    // Soft clipping function (tanh-like)
-    if (std::abs(x) < 1.0f) {
-        return x - (x * x * x) / 3.0f;
-    }
-    return (x > 0.0f) ? 0.6667f : -0.6667f;
-}
-
 float DrumNonlinearLoss::calculateDynamicDamping(float level, float velocity) const
 {
     // Higher levels and velocities get more damping
@@ -447,105 +514,222 @@ float DrumNonlinearLoss::calculateDynamicDamping(float level, float velocity) co
 }
 
 //==============================================================================
-// DrumRoomCoupling::ReverbTap Implementation
+// DrumRoomCoupling Implementation (8-line FDN)
 //==============================================================================
 
-void DrumRoomCoupling::ReverbTap::prepare(double sampleRate, float delayTime,
-                                          float feedbackGain, float tapGain)
+namespace {
+
+// Line lengths span the old 30-110 ms tap range; mutually prime in samples
+// (see prepare) so the modal density of the tail stays even
+constexpr float fdnLineMs[DrumRoomCoupling::numLines] =
+    { 31.3f, 37.9f, 43.7f, 53.1f, 61.7f, 73.3f, 89.9f, 107.3f };
+
+// Input/output sign patterns decorrelate the lines feeding and leaving the matrix
+constexpr float fdnInputSign[DrumRoomCoupling::numLines] =
+    { 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, 1.0f, -1.0f, -1.0f };
+constexpr float fdnOutputSign[DrumRoomCoupling::numLines] =
+    { 1.0f, 1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f };
+
+uint32_t nextPowerOfTwo(uint32_t n)
 {
-    int delaySamples = static_cast<int>(delayTime * sampleRate);
-    delay.resize(delaySamples + 1, 0.0f);
-    writeIndex = 0;
-    feedback = juce::jlimit(0.0f, 0.95f, feedbackGain);
-    gain = juce::jlimit(0.0f, 1.0f, tapGain);
+    uint32_t size = 1;
+    while (size < n) {
+        size <<= 1;
+    }
+    return size;
 }
 
-float DrumRoomCoupling::ReverbTap::processSample(float input)
+bool isCoprime(uint32_t a, uint32_t b)
 {
-    // Read from delay line
-    int readIndex = writeIndex - 1;
-    if (readIndex < 0) readIndex += static_cast<int>(delay.size());
-
-    float delayedSample = delay[readIndex];
+    while (b != 0) {
+        const uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a == 1;
+}
+
+/** Loop filter + 8x8 Hadamard mix + output tap, 8 lanes wide
+    @param delayed  Line outputs in, mixed feedback out
+    @returns        Sum of filtered lines weighted by the output signs */
+inline float processFdnLanes(float* delayed, const float* feed, const float* pole, float* state)
+{
+    constexpr float hadamardScale = 0.35355339f;  // 1 / sqrt(8)
+
+#if DSP_SIMD_NEON_AVAILABLE
+    float32x4_t lo = vmlaq_f32(vmulq_f32(vld1q_f32(feed), vld1q_f32(delayed)),
+                               vld1q_f32(pole), vld1q_f32(state));
+    float32x4_t hi = vmlaq_f32(vmulq_f32(vld1q_f32(feed + 4), vld1q_f32(delayed + 4)),
+                               vld1q_f32(pole + 4), vld1q_f32(state + 4));
+    vst1q_f32(state, lo);
+    vst1q_f32(state + 4, hi);
+
+    const float32x4_t outLo = vmulq_f32(lo, vld1q_f32(fdnOutputSign));
+    const float32x4_t outHi = vmulq_f32(hi, vld1q_f32(fdnOutputSign + 4));
+    const float32x4_t outSum = vaddq_f32(outLo, outHi);
+    const float32x2_t outPair = vadd_f32(vget_low_f32(outSum), vget_high_f32(outSum));
+    const float output = vget_lane_f32(vpadd_f32(outPair, outPair), 0);
+
+    // Fast Walsh-Hadamard transform: stride 4, then 2 and 1 inside each half
+    const float32x4_t sum = vaddq_f32(lo, hi);
+    const float32x4_t diff = vsubq_f32(lo, hi);
+    static const float stride2Sign[4] = { 1.0f, 1.0f, -1.0f, -1.0f };
+    static const float stride1Sign[4] = { 1.0f, -1.0f, 1.0f, -1.0f };
+    const float32x4_t s2 = vld1q_f32(stride2Sign);
+    const float32x4_t s1 = vld1q_f32(stride1Sign);
+
+    auto butterfly = [&](float32x4_t v) {
+        v = vmlaq_f32(vcombine_f32(vget_low_f32(v), vget_low_f32(v)),
+                      vcombine_f32(vget_high_f32(v), vget_high_f32(v)), s2);
+        const float32x4x2_t pairs = vtrnq_f32(v, v);
+        return vmulq_n_f32(vmlaq_f32(pairs.val[0], pairs.val[1], s1), hadamardScale);
+    };
+
+    vst1q_f32(delayed, butterfly(sum));
+    vst1q_f32(delayed + 4, butterfly(diff));
+    return output;
 
-    // Write input + feedback
-    delay[writeIndex] = input + delayedSample * feedback;
+#elif DSP_SIMD_SSE_AVAILABLE
+    __m128 lo = _mm_add_ps(_mm_mul_ps(_mm_load_ps(feed), _mm_loadu_ps(delayed)),
+                           _mm_mul_ps(_mm_load_ps(pole), _mm_load_ps(state)));
+    __m128 hi = _mm_add_ps(_mm_mul_ps(_mm_load_ps(feed + 4), _mm_loadu_ps(delayed + 4)),
+                           _mm_mul_ps(_mm_load_ps(pole + 4), _mm_load_ps(state + 4)));
+    _mm_store_ps(state, lo);
+    _mm_store_ps(state + 4, hi);
+
+    __m128 outSum = _mm_add_ps(_mm_mul_ps(lo, _mm_loadu_ps(fdnOutputSign)),
+                               _mm_mul_ps(hi, _mm_loadu_ps(fdnOutputSign + 4)));
+    outSum = _mm_add_ps(outSum, _mm_movehl_ps(outSum, outSum));
+    outSum = _mm_add_ss(outSum, _mm_shuffle_ps(outSum, outSum, _MM_SHUFFLE(1, 1, 1, 1)));
+    const float output = _mm_cvtss_f32(outSum);
+
+    // Fast Walsh-Hadamard transform: stride 4, then 2 and 1 inside each half
+    const __m128 s2 = _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f);
+    const __m128 s1 = _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f);
+    const __m128 scale = _mm_set1_ps(hadamardScale);
+
+    auto butterfly = [&](__m128 v) {
+        v = _mm_add_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 1, 0)),
+                       _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 2, 3, 2)), s2));
+        v = _mm_add_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0)),
+                       _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1)), s1));
+        return _mm_mul_ps(v, scale);
+    };
+
+    _mm_storeu_ps(delayed, butterfly(_mm_add_ps(lo, hi)));
+    _mm_storeu_ps(delayed + 4, butterfly(_mm_sub_ps(lo, hi)));
+    return output;
 
-    // Advance write index
-    writeIndex++;
-    if (writeIndex >= static_cast<int>(delay.size())) {
-        writeIndex = 0;
+#else
+    float output = 0.0f;
+    for (int i = 0; i < DrumRoomCoupling::numLines; ++i) {
+        state[i] = feed[i] * delayed[i] + pole[i] * state[i];
+        output += state[i] * fdnOutputSign[i];
+        delayed[i] = state[i];
     }
 
-    return delayedSample * gain;
-}
+    for (int stride = 1; stride < DrumRoomCoupling::numLines; stride <<= 1) {
+        for (int i = 0; i < DrumRoomCoupling::numLines; i += stride << 1) {
+            for (int j = i; j < i + stride; ++j) {
+                const float a = delayed[j];
+                const float b = delayed[j + stride];
+                delayed[j] = a + b;
+                delayed[j + stride] = a - b;
+            }
+        }
+    }
 
-void DrumRoomCoupling::ReverbTap::reset()
-{
-    std::fill(delay.begin(), delay.end(), 0.0f);
-    writeIndex = 0;
+    for (int i = 0; i < DrumRoomCoupling::numLines; ++i) {
+        delayed[i] *= hadamardScale;
+    }
+    return output;
+#endif
 }
 
-//==============================================================================
-// DrumRoomCoupling Implementation
-//==============================================================================
-
-DrumRoomCoupling::DrumRoomCoupling()
-{
-    reverbTaps.resize(4);  // 4 parallel reverb taps
-}
+} // namespace
 
 void DrumRoomCoupling::prepare(double sampleRate)
 {
     sr = sampleRate;
 
-    // Early reflections delay (short delay for room size)
-    float earlyDelayTime = params.preDelayMs / 1000.0f;
-    int earlyDelaySamples = static_cast<int>(earlyDelayTime * sampleRate);
-    earlyReflectionDelay.resize(earlyDelaySamples + 1, 0.0f);
-    writeIndex = 0;
-
-    // Setup reverb taps with different delays
-    float tapDelays[] = {0.03f, 0.05f, 0.07f, 0.11f};  // Seconds
-    float tapFeedbacks[] = {0.5f, 0.4f, 0.3f, 0.2f};
-    float tapGains[] = {0.3f, 0.2f, 0.15f, 0.1f};
+    // Early reflections: sized for the longest pre-delay so setParameters never allocates
+    const uint32_t maxEarly = static_cast<uint32_t>(maxPreDelayMs * 0.001 * sampleRate) + 1;
+    earlyBuffer.assign(nextPowerOfTwo(maxEarly), 0.0f);
+    earlyMask = static_cast<uint32_t>(earlyBuffer.size()) - 1;
+
+    // FDN lines: odd, pairwise coprime lengths, each in its own power-of-two ring
+    uint32_t totalSize = 0;
+    for (int i = 0; i < numLines; ++i) {
+        uint32_t length = static_cast<uint32_t>(fdnLineMs[i] * 0.001 * sampleRate) | 1u;
+        for (bool coprime = false; !coprime; ) {
+            coprime = true;
+            for (int j = 0; j < i; ++j) {
+                if (!isCoprime(length, lineDelay[j])) {
+                    coprime = false;
+                    length += 2;
+                    break;
+                }
+            }
+        }
 
-    for (size_t i = 0; i < reverbTaps.size(); ++i) {
-        reverbTaps[i].prepare(sampleRate, tapDelays[i],
-                              tapFeedbacks[i] * params.reverbTime / 2.0f,
-                              tapGains[i] * params.reflectionGain);
+        lineDelay[i] = length;
+        lineOffset[i] = totalSize;
+        lineMask[i] = nextPowerOfTwo(length + 1) - 1;
+        totalSize += lineMask[i] + 1;
     }
+    lineBuffer.assign(totalSize, 0.0f);
+
+    reset();
+    setParameters(params);
 }
 
 void DrumRoomCoupling::reset()
 {
-    std::fill(earlyReflectionDelay.begin(), earlyReflectionDelay.end(), 0.0f);
-    writeIndex = 0;
-
-    for (auto& tap : reverbTaps) {
-        tap.reset();
-    }
+    std::fill(earlyBuffer.begin(), earlyBuffer.end(), 0.0f);
+    std::fill(lineBuffer.begin(), lineBuffer.end(), 0.0f);
+    lineState.fill(0.0f);
+    writePosition = 0;
 }
 
 float DrumRoomCoupling::processSample(float input)
 {
+    if (lineBuffer.empty()) {
+        return input;
+    }
+
+    const uint32_t w = writePosition++;
+
     // Early reflections
-    int readIndex = writeIndex - 1;
-    if (readIndex < 0) readIndex += static_cast<int>(earlyReflectionDelay.size());
+    float earlyReflection = earlyBuffer[(w - earlyDelay) & earlyMask] * params.reflectionGain;
+    earlyBuffer[w & earlyMask] = input;
+
+    // Read all lines (gather), filter + mix 8 wide, write back (scatter)
+    alignas(32) float lanes[numLines];
+    float* lines = lineBuffer.data();
+    for (int i = 0; i < numLines; ++i) {
+        lanes[i] = lines[lineOffset[i] + ((w - lineDelay[i]) & lineMask[i])];
+    }
 
-    float earlyReflection = earlyReflectionDelay[readIndex] * params.reflectionGain;
-    earlyReflectionDelay[writeIndex] = input;
-    writeIndex++;
-    if (writeIndex >= static_cast<int>(earlyReflectionDelay.size())) {
-        writeIndex = 0;
+    float reverbTail;
+    if (activeLines == numLines) {
+        reverbTail = processFdnLanes(lanes, lineFeed.data(), linePole.data(), lineState.data());
+    } else {
+        reverbTail = 0.0f;
+        for (int i = 0; i < activeLines; ++i) {
+            lineState[i] = lineFeed[i] * lanes[i] + linePole[i] * lineState[i];
+            reverbTail += lineState[i] * fdnOutputSign[i];
+            lanes[i] = lineState[i];
+        }
+        mixReducedLines(lanes);
     }
 
-    // Reverb tail
-    float reverbTail = 0.0f;
-    for (auto& tap : reverbTaps) {
-        reverbTail += tap.processSample(input);
+    const float injected = input * lineInputGain;
+    for (int i = 0; i < activeLines; ++i) {
+        lines[lineOffset[i] + (w & lineMask[i])] = lanes[i] + injected * fdnInputSign[i];
     }
 
+    reverbTail *= params.reflectionGain * lineInputGain;
+
     // Mix dry, early reflections, and reverb
     float roomMix = params.roomSize;
     return input * (1.0f - roomMix * 0.5f) +
@@ -553,13 +737,127 @@ float DrumRoomCoupling::processSample(float input)
            reverbTail * roomMix * 0.5f;
 }
 
+void DrumRoomCoupling::mixReducedLines(float* lanes) const
+{
+    // Hadamard over the first activeLines lanes (CPU budget path, scalar)
+    for (int stride = 1; stride < activeLines; stride <<= 1) {
+        for (int i = 0; i < activeLines; i += stride << 1) {
+            for (int j = i; j < i + stride; ++j) {
+                const float a = lanes[j];
+                const float b = lanes[j + stride];
+                lanes[j] = a + b;
+                lanes[j + stride] = a - b;
+            }
+        }
+    }
+
+    const float scale = 1.0f / std::sqrt(static_cast<float>(activeLines));
+    for (int i = 0; i < activeLines; ++i) {
+        lanes[i] *= scale;
+    }
+}
+
 void DrumRoomCoupling::setParameters(const Parameters& p)
 {
     params = p;
-    // Re-initialize delays with new parameters
+
+    const float preDelay = juce::jlimit(0.0f, maxPreDelayMs, params.preDelayMs);
+    earlyDelay = std::max(1u, static_cast<uint32_t>(preDelay * 0.001 * sr));
+
+    updateDecay();
+}
+
+void DrumRoomCoupling::updateDecay()
+{
+    const double t60 = std::max(0.05, static_cast<double>(params.reverbTime));
+    const double t60High = t60 * juce::jlimit(0.05, 1.0, static_cast<double>(params.hfDecayRatio));
+
+    for (int i = 0; i < numLines; ++i) {
+        // Loop gain for exactly -60 dB after T60 seconds of round trips
+        const double delaySeconds = lineDelay[i] / sr;
+        const double gainLow = std::pow(10.0, -3.0 * delaySeconds / t60);
+        const double gainHigh = std::pow(10.0, -3.0 * delaySeconds / t60High);
+
+        // One-pole g(1-p)/(1-pz^-1): DC gain gainLow, Nyquist gain gainHigh
+        const double pole = (gainLow - gainHigh) / (gainLow + gainHigh);
+        linePole[i] = static_cast<float>(pole);
+        lineFeed[i] = static_cast<float>(gainLow * (1.0 - pole));
+    }
+}
+
+void DrumRoomCoupling::setActiveLines(int lines)
+{
+    int newLines = 1;
+    while (newLines * 2 <= juce::jlimit(1, numLines, lines)) {
+        newLines *= 2;
+    }
+
+    // Clear dropped lines so their stale tails don't return on restore
+    for (int i = newLines; i < activeLines; ++i) {
+        std::fill(lineBuffer.begin() + lineOffset[i],
+                  lineBuffer.begin() + lineOffset[i] + lineMask[i] + 1, 0.0f);
+        lineState[i] = 0.0f;
+    }
+
+    activeLines = newLines;
+    lineInputGain = 1.0f / std::sqrt(static_cast<float>(activeLines));
+}
+
+//==============================================================================
+// DrumKitMap Implementation
+//==============================================================================
+
+DrumKitMap::DrumKitMap()
+{
+    definitions.resize(numNotes);
+    setups.resize(numNotes);
     prepare(sr);
 }
 
+void DrumKitMap::prepare(double sampleRate)
+{
+    sr = sampleRate;
+    for (int note = 0; note < numNotes; ++note) {
+        setups[static_cast<size_t>(note)] = makeSetup(definitions[static_cast<size_t>(note)], sr);
+    }
+}
+
+void DrumKitMap::setDrum(int note, const DrumDefinition& drum)
+{
+    const auto index = static_cast<size_t>(juce::jlimit(0, numNotes - 1, note));
+    definitions[index] = drum;
+    setups[index] = makeSetup(drum, sr);
+}
+
+const DrumDefinition& DrumKitMap::getDrum(int note) const
+{
+    return definitions[static_cast<size_t>(juce::jlimit(0, numNotes - 1, note))];
+}
+
+const DrumKitMap::DrumSetup& DrumKitMap::getSetup(int note) const
+{
+    return setups[static_cast<size_t>(juce::jlimit(0, numNotes - 1, note))];
+}
+
+DrumKitMap::DrumSetup DrumKitMap::makeSetup(const DrumDefinition& drum, double sampleRate)
+{
+    MembraneResonator::Parameters membrane;
+    membrane.fundamentalFrequency = drum.fundamentalFrequency;
+    membrane.tension = drum.tension;
+    membrane.diameterMeters = std::max(0.05f, drum.diameterMeters);
+    membrane.damping = drum.damping;
+    membrane.inharmonicity = drum.inharmonicity;
+    membrane.numModes = juce::jlimit(2, MembraneResonator::maxModes, drum.numModes);
+
+    DrumSetup setup;
+    setup.membrane = MembraneResonator::makeSetup(membrane, sampleRate);
+    setup.shell = ShellResonator::makeSetup(drum.shell);
+    setup.saturationAmount = drum.saturationAmount;
+    setup.massEffect = drum.massEffect;
+    setup.chokeGroup = drum.chokeGroup;
+    return setup;
+}
+
 //==============================================================================
 // GiantDrumVoice Implementation
 //==============================================================================
@@ -569,7 +867,7 @@ void GiantDrumVoice::prepare(double sampleRate)
     membrane.prepare(sampleRate);
     shell.prepare(sampleRate);
     nonlinear.prepare(sampleRate);
-    room.prepare(sampleRate);
+    chokeDecay = static_cast<float>(std::exp(std::log(chokeFloor) / (chokeTimeSeconds * sampleRate)));
 }
 
 void GiantDrumVoice::reset()
@@ -577,63 +875,69 @@ void GiantDrumVoice::reset()
     membrane.reset();
     shell.reset();
     nonlinear.reset();
-    room.reset();
     active = false;
     velocity = 0.0f;
+    choking = false;
+    chokeGain = 1.0f;
+    membraneOutput = 0.0f;
+    sympatheticInput = 0.0f;
 }
 
 void GiantDrumVoice::trigger(int note, float vel, const GiantGestureParameters& gestureParam,
-                             const GiantScaleParameters& scaleParams)
+                             const DrumKitMap::DrumSetup& setup,
+                             const GiantModeDetail::Context& detail)
 {
     midiNote = note;
     velocity = vel;
     gesture = gestureParam;
-    scale = scaleParams;
     active = true;
-
-    // Set membrane parameters based on scale
-    MembraneResonator::Parameters memParams;
-    memParams.fundamentalFrequency = 80.0f + (note - 36) * 10.0f;  // Map MIDI to frequency
-    memParams.tension = 0.5f;
-    memParams.diameterMeters = scaleParams.scaleMeters;
-    memParams.damping = 0.995f + (1.0f - scaleParams.massBias) * 0.003f;
-    memParams.inharmonicity = 0.1f;
-    memParams.numModes = 4;
-    membrane.setParameters(memParams);
-
-    // Set shell parameters
-    ShellResonator::Parameters shellParams;
-    shellParams.cavityFrequency = 120.0f / scaleParams.scaleMeters;
-    shellParams.shellFormant = 300.0f / scaleParams.scaleMeters;
-    shellParams.cavityQ = 0.7f;
-    shellParams.shellQ = 0.5f;
-    shellParams.coupling = 0.3f;
-    shell.setParameters(shellParams);
-
-    // Set nonlinear parameters
-    nonlinear.setSaturationAmount(0.1f);
-    nonlinear.setMassEffect(scaleParams.massBias);
-
-    // Set room parameters
-    DrumRoomCoupling::Parameters roomParams;
-    roomParams.roomSize = 0.7f;
-    roomParams.reflectionGain = 0.3f;
-    roomParams.reverbTime = 2.0f;
-    roomParams.preDelayMs = 5.0f;
-    room.setParameters(roomParams);
+    chokeGroup = setup.chokeGroup;
+    choking = false;
+    chokeGain = 1.0f;
+
+    // Precomputed drum from the kit map: coefficient copies only
+    membrane.loadSetup(setup.membrane);
+    shell.loadSetup(setup.shell);
+    nonlinear.setSaturationAmount(setup.saturationAmount);
+    nonlinear.setMassEffect(setup.massEffect);
+
+    // Level of detail: soft, distant or crowded hits render fewer membrane modes
+    const float cutoff = GiantModeDetail::audibleBandwidth(detail.airLoss, detail.distanceMeters);
+    detailModes = GiantModeDetail::modesAtTrigger(setup.membrane.params.numModes,
+                                                  membrane.countModesBelow(cutoff), 2, detail);
+    detailCountdown = GiantModeDetail::tailCheckInterval;
+    trimTail = !detail.fullDetail;
+    membrane.setModeLimit(detailModes);
 
     // Strike the membrane
     membrane.strike(vel, gesture.force, gesture.contactArea);
 }
 
+void GiantDrumVoice::choke()
+{
+    if (active) {
+        choking = true;
+    }
+}
+
 float GiantDrumVoice::processSample()
 {
     if (!active) {
+        membraneOutput = 0.0f;
+        sympatheticInput = 0.0f;
         return 0.0f;
     }
 
-    // Process membrane
-    float membraneOut = membrane.processSample();
+    // Tail level of detail: high modes that fall under the masking threshold stop rendering
+    if (trimTail && --detailCountdown <= 0) {
+        detailCountdown = GiantModeDetail::tailCheckInterval;
+        detailModes = membrane.trimMaskedModes(GiantModeDetail::maskingRatio);
+    }
+
+    // Process membrane, driven by any sympathetic input from other voices
+    float membraneOut = membrane.processSample(sympatheticInput);
+    sympatheticInput = 0.0f;
+    membraneOutput = membraneOut;
 
     // Feed energy to shell
     shell.processMembraneEnergy(membrane.getEnergy());
@@ -644,11 +948,18 @@ float GiantDrumVoice::processSample()
     // Mix membrane and shell
     float mixed = membraneOut * 0.7f + shellOut * 0.3f;
 
-    // Apply nonlinear loss
-    float processed = nonlinear.processSample(mixed, velocity);
+    // Apply nonlinear loss (room coupling is shared, see GiantDrumVoiceManager)
+    float output = nonlinear.processSample(mixed, velocity);
 
-    // Apply room coupling
-    float output = room.processSample(processed);
+    // Choked: fade out fast instead of cutting (no click)
+    if (choking) {
+        chokeGain *= chokeDecay;
+        output *= chokeGain;
+        if (chokeGain < chokeFloor) {
+            reset();
+            return output;
+        }
+    }
 
     // Check if voice should deactivate
     if (membrane.getEnergy() < 0.0001f) {
@@ -675,35 +986,113 @@ void GiantDrumVoiceManager::prepare(double sampleRate, int maxVoices)
 {
     currentSampleRate = sampleRate;
 
-    // Allocate voices
+    // Shared room: the only delay lines, allocated once here
+    room.prepare(sampleRate);
+    room.setParameters(roomParams);
+
+    // Kit setups depend on the sample rate
+    kit.prepare(sampleRate);
+
+    // Coupling matrix never grows on the audio thread
+    couplings.clear();
+    couplings.reserve(static_cast<size_t>(maxVoices * maxCouplingsPerVoice));
+    couplingHistory.assign(static_cast<size_t>(maxVoices * couplingHop), 0.0f);
+    couplingDrive.assign(static_cast<size_t>(maxVoices * couplingHop), 0.0f);
+    couplingPosition = 0;
+    couplingDriveActive = false;
+
+    // Allocate voices (cheap); resonators are only built for the eager pool
+    // here, the rest via warmUp()
     voices.resize(maxVoices);
+    for (size_t i = 0; i < voices.size(); ++i) {
+        voices[i] = std::make_unique<GiantDrumVoice>();
+        if (static_cast<int>(i) < eagerVoices) {
+            prepareVoice(*voices[i]);
+            voices[i]->prepared = true;
+        }
+    }
+}
+
+void GiantDrumVoiceManager::prepareVoice(GiantDrumVoice& voice)
+{
+    // Drum coefficients come from the kit map on each trigger, so adopting
+    // a published voice (findFreeVoice) has no settings to replay
+    voice.prepare(currentSampleRate);
+    voice.ready.store(true, std::memory_order_release);
+}
+
+int GiantDrumVoiceManager::warmUp(int maxVoices)
+{
+    int cold = 0;
     for (auto& voice : voices) {
-        voice = std::make_unique<GiantDrumVoice>();
-        voice->prepare(sampleRate);
+        if (voice->ready.load(std::memory_order_acquire)) {
+            continue;
+        }
+
+        if (maxVoices > 0) {
+            prepareVoice(*voice);
+            --maxVoices;
+        } else {
+            ++cold;
+        }
+    }
+    return cold;
+}
+
+int GiantDrumVoiceManager::getPreparedVoiceCount() const
+{
+    int count = 0;
+    for (const auto& voice : voices) {
+        if (voice->ready.load(std::memory_order_acquire)) {
+            count++;
+        }
     }
+    return count;
 }
 
 void GiantDrumVoiceManager::reset()
 {
     for (auto& voice : voices) {
-        voice->reset();
+        if (voice->prepared) {
+            voice->reset();
+        }
     }
+    room.reset();
+
+    std::fill(couplingHistory.begin(), couplingHistory.end(), 0.0f);
+    std::fill(couplingDrive.begin(), couplingDrive.end(), 0.0f);
+    couplingPosition = 0;
+    couplingDriveActive = false;
 }
 
 GiantDrumVoice* GiantDrumVoiceManager::findFreeVoice()
 {
-    // First try to find completely inactive voice
+    // First try to find completely inactive, already prepared voice
     for (auto& voice : voices) {
-        if (!voice->isActive()) {
+        if (!voice->isActive() && voice->prepared) {
+            return voice.get();
+        }
+    }
+
+    // Then one the warm-up has published since
+    for (auto& voice : voices) {
+        if (!voice->prepared && voice->ready.load(std::memory_order_acquire)) {
+            voice->prepared = true;
             return voice.get();
         }
     }
 
-    // If all active, find the one with lowest energy (voice stealing)
+    // If all active, find the one with lowest energy (voice stealing).
+    // Cold voices are never prepared here (that allocates); the warm-up
+    // brings them in off the audio thread. voices[0] is in the eager pool.
     GiantDrumVoice* quietest = voices[0].get();
     float minEnergy = quietest->membrane.getEnergy();
 
     for (auto& voice : voices) {
+        if (!voice->prepared) {
+            continue;
+        }
+
         float energy = voice->membrane.getEnergy();
         if (energy < minEnergy) {
             minEnergy = energy;
@@ -729,9 +1118,31 @@ void GiantDrumVoiceManager::handleNoteOn(int note, float velocity,
                                          const GiantGestureParameters& gesture,
                                          const GiantScaleParameters& scale)
 {
+    const DrumKitMap::DrumSetup& setup = kit.getSetup(note);
+
+    // Choke group: this hit silences the group's ringing voices (open/closed hats)
+    if (setup.chokeGroup != 0) {
+        for (auto& voice : voices) {
+            if (voice->isActive() && voice->chokeGroup == setup.chokeGroup) {
+                voice->choke();
+            }
+        }
+    }
+
+    GiantModeDetail::Context detail;
+    detail.velocity = velocity;
+    detail.airLoss = scale.airLoss;
+    detail.distanceMeters = listenerDistance;
+    detail.activeVoices = getActiveVoiceCount();
+    detail.fullDetail = fullDetail;
+
     GiantDrumVoice* voice = findFreeVoice();
     if (voice) {
-        voice->trigger(note, velocity, gesture, scale);
+        voice->trigger(note, velocity, gesture, setup, detail);
+
+        if (modulation != nullptr) {
+            modulation->noteOn(indexOf(voice), note, velocity);
+        }
     }
 }
 
@@ -742,25 +1153,69 @@ void GiantDrumVoiceManager::handleNoteOff(int note)
     GiantDrumVoice* voice = findVoiceForNote(note);
     if (voice) {
         // Optionally reduce energy faster on note off
-        // But for now, let natural decay happen
+        // But for now, let natural decay happen; only the matrix envelope releases
+        if (modulation != nullptr) {
+            modulation->noteOff(indexOf(voice));
+        }
     }
 }
 
 void GiantDrumVoiceManager::allNotesOff()
 {
     for (auto& voice : voices) {
-        voice->reset();
+        if (voice->prepared) {
+            voice->reset();
+        }
     }
+    room.reset();
 }
 
 float GiantDrumVoiceManager::processSample()
 {
     float output = 0.0f;
 
-    for (auto& voice : voices) {
-        output += voice->processSample();
+    // Sympathetic coupling: per sample each voice only reads its drive and
+    // records its membrane; the voice-to-voice mixing is per hop
+    const bool coupled = couplingDriveActive || !couplings.empty();
+
+    const bool modulated = (modulation != nullptr && modulation->isRunning());
+    if (modulated) {
+        modulation->advance();
+    }
+
+    for (size_t v = 0; v < voices.size(); ++v) {
+        GiantDrumVoice& voice = *voices[v];
+        if (!voice.prepared) {
+            continue;
+        }
+
+        const size_t slot = v * couplingHop + static_cast<size_t>(couplingPosition);
+
+        if (coupled) {
+            voice.sympatheticInput = couplingDrive[slot];
+        }
+
+        float voiceOutput = voice.processSample();
+
+        if (coupled) {
+            couplingHistory[slot] = voice.membraneOutput;
+        }
+
+        // Matrix level shapes what the voice sends out, not its membrane physics
+        if (modulated) {
+            voiceOutput *= std::max(0.0f, 1.0f + modulation->getValue(static_cast<int>(v), GiantModDestination::Level));
+        }
+
+        output += voiceOutput;
     }
 
+    if (coupled && ++couplingPosition == couplingHop) {
+        advanceCouplingHop();
+    }
+
+    // Room tail keeps ringing after the voices that fed it have finished
+    output = room.processSample(output);
+
     // Soft limit to prevent clipping
     if (output > 1.0f) output = 1.0f;
     if (output < -1.0f) output = -1.0f;
@@ -768,6 +1223,16 @@ float GiantDrumVoiceManager::processSample()
     return output;
 }
 
+int GiantDrumVoiceManager::indexOf(const GiantDrumVoice* voice) const
+{
+    for (size_t v = 0; v < voices.size(); ++v) {
+        if (voices[v].get() == voice) {
+            return static_cast<int>(v);
+        }
+    }
+    return -1;
+}
+
 int GiantDrumVoiceManager::getActiveVoiceCount() const
 {
     int count = 0;
@@ -779,24 +1244,148 @@ int GiantDrumVoiceManager::getActiveVoiceCount() const
     return count;
 }
 
-void GiantDrumVoiceManager::setMembraneParameters(const MembraneResonator::Parameters& params)
+int GiantDrumVoiceManager::getVoiceEnergies(float* energies, int maxVoices) const
 {
-    for (auto& voice : voices) {
-        voice->membrane.setParameters(params);
+    const int count = std::min(maxVoices, static_cast<int>(voices.size()));
+    for (int i = 0; i < count; ++i) {
+        const auto& voice = voices[static_cast<size_t>(i)];
+        energies[i] = voice->isActive() ? voice->membrane.getEnergy() : 0.0f;
     }
+    return count;
 }
 
-void GiantDrumVoiceManager::setShellParameters(const ShellResonator::Parameters& params)
+void GiantDrumVoiceManager::setRoomParameters(const DrumRoomCoupling::Parameters& params)
 {
-    for (auto& voice : voices) {
-        voice->shell.setParameters(params);
+    roomParams = params;
+    room.setParameters(params);
+}
+
+void GiantDrumVoiceManager::updateCouplings()
+{
+    couplings.clear();
+    if (sympatheticAmount <= 0.0f) {
+        return;
+    }
+
+    const int numVoices = static_cast<int>(voices.size());
+    for (int target = 0; target < numVoices; ++target) {
+        const GiantDrumVoice& listener = *voices[static_cast<size_t>(target)];
+        if (!listener.isActive()) {
+            continue;
+        }
+
+        // Strongest few sources by pitch proximity (membranes tuned close
+        // together share modes and ring each other hardest)
+        std::array<Coupling, maxCouplingsPerVoice> strongest {};
+        int count = 0;
+
+        for (int source = 0; source < numVoices; ++source) {
+            const GiantDrumVoice& driver = *voices[static_cast<size_t>(source)];
+            if (source == target || !driver.isActive()) {
+                continue;
+            }
+
+            const float octaves = std::log2(std::max(1.0f, driver.membrane.getFundamental())
+                                            / std::max(1.0f, listener.membrane.getFundamental()));
+            const float weight = 1.0f / (1.0f + 16.0f * octaves * octaves);
+            if (weight < minCouplingWeight) {
+                continue;
+            }
+
+            const Coupling candidate { source, target, maxCouplingGain * sympatheticAmount * weight };
+            if (count < maxCouplingsPerVoice) {
+                strongest[static_cast<size_t>(count++)] = candidate;
+            } else {
+                auto weakest = std::min_element(strongest.begin(), strongest.end(),
+                    [](const Coupling& a, const Coupling& b) { return a.gain < b.gain; });
+                if (candidate.gain > weakest->gain) {
+                    *weakest = candidate;
+                }
+            }
+        }
+
+        couplings.insert(couplings.end(), strongest.begin(), strongest.begin() + count);
     }
 }
 
-void GiantDrumVoiceManager::setRoomParameters(const DrumRoomCoupling::Parameters& params)
+void GiantDrumVoiceManager::advanceCouplingHop()
+{
+    couplingPosition = 0;
+    std::fill(couplingDrive.begin(), couplingDrive.end(), 0.0f);
+
+    for (const auto& coupling : couplings) {
+        float* drive = couplingDrive.data() + static_cast<size_t>(coupling.target * couplingHop);
+        const float* history = couplingHistory.data() + static_cast<size_t>(coupling.source * couplingHop);
+
+        for (int i = 0; i < couplingHop; ++i) {
+            drive[i] += coupling.gain * history[i];
+        }
+    }
+
+    couplingDriveActive = !couplings.empty();
+}
+
+void GiantDrumVoiceManager::applyQuality(const GiantCpuBudget& budget)
 {
+    const auto quality = budget.getQuality();
+
+    // Loudest voice sets the reference for what counts as "quiet"
+    float loudest = 0.0f;
+    int activeCount = 0;
+    for (const auto& voice : voices) {
+        if (voice->isActive()) {
+            loudest = std::max(loudest, voice->membrane.getEnergy());
+            ++activeCount;
+        }
+    }
+
+    // Reduced trims only quiet tails; Low/Minimal trim everything but the loudest
+    const float quietThreshold = (quality == GiantCpuBudget::Quality::Reduced) ? 0.25f : 0.9f;
+    room.setActiveLines(budget.scaleCount(DrumRoomCoupling::numLines, 2));
+
     for (auto& voice : voices) {
-        voice->room.setParameters(params);
+        if (!voice->isActive()) {
+            continue;
+        }
+
+        // The budget trims on top of the voice's own level of detail, never above it
+        const int fullModes = voice->detailModes;
+        const bool quiet = voice->membrane.getEnergy() < loudest * quietThreshold;
+
+        if (quality == GiantCpuBudget::Quality::Full || !quiet) {
+            voice->membrane.setModeLimit(fullModes);
+        } else {
+            voice->membrane.setModeLimit(budget.scaleCount(fullModes, 2));
+        }
+    }
+
+    // Polyphony cap: retire the quietest voices first
+    if (quality < GiantCpuBudget::Quality::Low) {
+        return;
+    }
+
+    const int maxActive = budget.scaleCount(static_cast<int>(voices.size()), 2);
+    while (activeCount > maxActive) {
+        GiantDrumVoice* quietest = nullptr;
+        float minEnergy = 0.0f;
+
+        for (auto& voice : voices) {
+            if (!voice->isActive()) {
+                continue;
+            }
+            float energy = voice->membrane.getEnergy();
+            if (quietest == nullptr || energy < minEnergy) {
+                minEnergy = energy;
+                quietest = voice.get();
+            }
+        }
+
+        if (quietest == nullptr) {
+            break;
+        }
+
+        quietest->reset();
+        --activeCount;
     }
 }
 
@@ -804,8 +1393,57 @@ void GiantDrumVoiceManager::setRoomParameters(const DrumRoomCoupling::Parameters
 // AetherGiantDrumsPureDSP Implementation
 //==============================================================================
 
+namespace {
+
+// Giant kit on the General MIDI drum notes (kit_layout = 1). Sizes are
+// relative to scale_meters, damping is an offset on membrane_damping;
+// everything else comes from the engine parameters.
+struct GiantKitDrum
+{
+    int note;
+    float fundamental;      // (0,1) mode before size scaling (Hz)
+    float size;             // Diameter / scale_meters
+    float dampingOffset;
+    float inharmonicity;
+    int numModes;
+    int chokeGroup;
+};
+
+constexpr GiantKitDrum giantKit[] = {
+    { 35,  45.0f, 1.3f,  0.002f, 0.05f, 4, 0 },  // Acoustic bass drum
+    { 36,  55.0f, 1.2f,  0.002f, 0.05f, 4, 0 },  // Bass drum
+    { 37, 260.0f, 0.4f, -0.004f, 0.20f, 6, 0 },  // Side stick
+    { 38, 190.0f, 0.5f,  0.000f, 0.15f, 6, 0 },  // Snare
+    { 40, 210.0f, 0.5f,  0.000f, 0.18f, 6, 0 },  // Electric snare
+    { 41,  70.0f, 0.9f,  0.001f, 0.08f, 4, 0 },  // Low floor tom
+    { 43,  80.0f, 0.85f, 0.001f, 0.08f, 4, 0 },  // High floor tom
+    { 45,  95.0f, 0.75f, 0.001f, 0.08f, 4, 0 },  // Low tom
+    { 47, 110.0f, 0.7f,  0.001f, 0.08f, 4, 0 },  // Low-mid tom
+    { 48, 130.0f, 0.6f,  0.001f, 0.08f, 4, 0 },  // Hi-mid tom
+    { 50, 150.0f, 0.55f, 0.001f, 0.08f, 4, 0 },  // High tom
+    { 42, 420.0f, 0.3f, -0.006f, 0.45f, 6, 1 },  // Closed hi-hat
+    { 44, 400.0f, 0.3f, -0.005f, 0.45f, 6, 1 },  // Pedal hi-hat
+    { 46, 380.0f, 0.3f,  0.002f, 0.45f, 6, 1 },  // Open hi-hat
+    { 49, 330.0f, 0.6f,  0.003f, 0.50f, 6, 0 },  // Crash
+    { 51, 360.0f, 0.5f,  0.002f, 0.40f, 6, 0 },  // Ride
+    { 57, 310.0f, 0.65f, 0.003f, 0.50f, 6, 0 },  // Crash 2
+};
+
+const GiantKitDrum* findGiantKitDrum(int note)
+{
+    for (const auto& drum : giantKit) {
+        if (drum.note == note) {
+            return &drum;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
 AetherGiantDrumsPureDSP::AetherGiantDrumsPureDSP()
 {
+    voiceManager_.setModMatrix(&modMatrix_);
 }
 
 AetherGiantDrumsPureDSP::~AetherGiantDrumsPureDSP()
@@ -818,6 +1456,10 @@ bool AetherGiantDrumsPureDSP::prepare(double sampleRate, int blockSize)
     blockSize_ = blockSize;
 
     voiceManager_.prepare(sampleRate, maxVoices_);
+    modMatrix_.prepare(sampleRate, maxVoices_);
+    rebuildKit();
+    cpuBudget_.prepare(sampleRate, blockSize);
+    cpuBudget_.setBudget(params_.cpuBudget);
 
     // Initialize current scale and gesture parameters
     currentScale_.scaleMeters = params_.scaleMeters;
@@ -836,27 +1478,34 @@ bool AetherGiantDrumsPureDSP::prepare(double sampleRate, int blockSize)
 void AetherGiantDrumsPureDSP::reset()
 {
     voiceManager_.reset();
+    modMatrix_.reset();
+    cpuBudget_.reset();
 }
 
 void AetherGiantDrumsPureDSP::process(float** outputs, int numChannels, int numSamples)
 {
+    cpuBudget_.beginBlock();
+    updateKit();
+    voiceManager_.applyQuality(cpuBudget_);
+    voiceManager_.updateCouplings();
+
     // Process samples
     for (int sample = 0; sample < numSamples; ++sample) {
         float mono = voiceManager_.processSample() * params_.masterVolume;
 
-        // Process stereo
-        processStereoSample(outputs[0][sample], outputs[1][sample]);
-
-        // Mix in mono output
-        outputs[0][sample] += mono;
-        outputs[1][sample] += mono;
+        // Mix in mono output (mono hosts pass a single channel)
+        for (int ch = 0; ch < numChannels; ++ch)
+            outputs[ch][sample] += mono;
     }
+
+    cpuBudget_.endBlock(numSamples);
 }
 
 void AetherGiantDrumsPureDSP::handleEvent(const ScheduledEvent& event)
 {
     switch (event.type) {
         case ScheduledEvent::NOTE_ON: {
+            updateKit();
             voiceManager_.handleNoteOn(event.data.note.midiNote,
                                        event.data.note.velocity,
                                        currentGesture_,
@@ -923,6 +1572,10 @@ float AetherGiantDrumsPureDSP::getParameter(const char* paramId) const
         return params_.airLoss;
     if (std::strcmp(paramId, "transient_slowing") == 0)
         return params_.transientSlowing;
+    if (std::strcmp(paramId, "distance_meters") == 0)
+        return params_.distanceMeters;
+    if (std::strcmp(paramId, "sympathetic_coupling") == 0)
+        return params_.sympatheticCoupling;
 
     // Gesture parameters
     if (std::strcmp(paramId, "force") == 0)
@@ -937,6 +1590,12 @@ float AetherGiantDrumsPureDSP::getParameter(const char* paramId) const
     // Global parameters
     if (std::strcmp(paramId, "master_volume") == 0)
         return params_.masterVolume;
+    if (std::strcmp(paramId, "cpu_budget") == 0)
+        return params_.cpuBudget;
+
+    // Kit parameters
+    if (std::strcmp(paramId, "kit_layout") == 0)
+        return static_cast<float>(params_.kitLayout);
 
     return 0.0f;
 }
@@ -945,52 +1604,45 @@ void AetherGiantDrumsPureDSP::setParameter(const char* paramId, float value)
 {
     // Membrane parameters
     if (std::strcmp(paramId, "membrane_tension") == 0) {
-        params_.membraneTension = value;
-        applyParameters();
+        setKitParameter(params_.membraneTension, value);
     } else if (std::strcmp(paramId, "membrane_diameter") == 0) {
-        params_.membraneDiameter = value;
-        applyParameters();
+        setKitParameter(params_.membraneDiameter, value);
     } else if (std::strcmp(paramId, "membrane_damping") == 0) {
-        params_.membraneDamping = value;
-        applyParameters();
+        setKitParameter(params_.membraneDamping, value);
     } else if (std::strcmp(paramId, "membrane_inharmonicity") == 0) {
-        params_.membraneInharmonicity = value;
-        applyParameters();
+        setKitParameter(params_.membraneInharmonicity, value);
     }
     // Shell parameters
     else if (std::strcmp(paramId, "shell_cavity_freq") == 0) {
-        params_.shellCavityFreq = value;
-        applyParameters();
+        setKitParameter(params_.shellCavityFreq, value);
     } else if (std::strcmp(paramId, "shell_formant") == 0) {
-        params_.shellFormant = value;
-        applyParameters();
+        setKitParameter(params_.shellFormant, value);
     } else if (std::strcmp(paramId, "shell_coupling") == 0) {
-        params_.shellCoupling = value;
-        applyParameters();
+        setKitParameter(params_.shellCoupling, value);
     }
     // Nonlinear parameters
     else if (std::strcmp(paramId, "saturation_amount") == 0) {
-        params_.saturationAmount = value;
+        setKitParameter(params_.saturationAmount, value);
     } else if (std::strcmp(paramId, "mass_effect") == 0) {
-        params_.massEffect = value;
+        setKitParameter(params_.massEffect, value);
     }
     // Room parameters
     else if (std::strcmp(paramId, "room_size") == 0) {
         params_.roomSize = value;
-        applyParameters();
+        applyRoomParameters();
     } else if (std::strcmp(paramId, "reflection_gain") == 0) {
         params_.reflectionGain = value;
-        applyParameters();
+        applyRoomParameters();
     } else if (std::strcmp(paramId, "reverb_time") == 0) {
         params_.reverbTime = value;
-        applyParameters();
+        applyRoomParameters();
     }
     // Giant parameters
     else if (std::strcmp(paramId, "scale_meters") == 0) {
-        params_.scaleMeters = value;
+        setKitParameter(params_.scaleMeters, value);
         currentScale_.scaleMeters = value;
     } else if (std::strcmp(paramId, "mass_bias") == 0) {
-        params_.massBias = value;
+        setKitParameter(params_.massBias, value);
         currentScale_.massBias = value;
     } else if (std::strcmp(paramId, "air_loss") == 0) {
         params_.airLoss = value;
@@ -998,6 +1650,12 @@ void AetherGiantDrumsPureDSP::setParameter(const char* paramId, float value)
     } else if (std::strcmp(paramId, "transient_slowing") == 0) {
         params_.transientSlowing = value;
         currentScale_.transientSlowing = value;
+    } else if (std::strcmp(paramId, "distance_meters") == 0) {
+        params_.distanceMeters = value;
+        voiceManager_.setListenerDistance(juce::jlimit(1.0f, 100.0f, value));
+    } else if (std::strcmp(paramId, "sympathetic_coupling") == 0) {
+        params_.sympatheticCoupling = value;
+        voiceManager_.setSympatheticCoupling(value);
     }
     // Gesture parameters
     else if (std::strcmp(paramId, "force") == 0) {
@@ -1016,6 +1674,24 @@ void AetherGiantDrumsPureDSP::setParameter(const char* paramId, float value)
     // Global parameters
     else if (std::strcmp(paramId, "master_volume") == 0) {
         params_.masterVolume = value;
+    } else if (std::strcmp(paramId, "cpu_budget") == 0) {
+        params_.cpuBudget = value;
+        cpuBudget_.setBudget(value);
+    }
+    // Kit parameters
+    else if (std::strcmp(paramId, "kit_layout") == 0) {
+        const int layout = juce::jlimit(0, 1, static_cast<int>(value + 0.5f));
+        kitDirty_ = kitDirty_ || (layout != params_.kitLayout);
+        params_.kitLayout = layout;
+    }
+}
+
+void AetherGiantDrumsPureDSP::setKitParameter(float& field, float value)
+{
+    // Automation repeats values; only a real change costs a rebuild
+    if (field != value) {
+        field = value;
+        kitDirty_ = true;
     }
 }
 
@@ -1047,11 +1723,14 @@ bool AetherGiantDrumsPureDSP::savePreset(char* jsonBuffer, int jsonBufferSize) c
     writeJsonParameter("mass_bias", params_.massBias, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("air_loss", params_.airLoss, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("transient_slowing", params_.transientSlowing, jsonBuffer, offset, jsonBufferSize);
+    writeJsonParameter("distance_meters", params_.distanceMeters, jsonBuffer, offset, jsonBufferSize);
+    writeJsonParameter("sympathetic_coupling", params_.sympatheticCoupling, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("force", params_.force, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("speed", params_.speed, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("contact_area", params_.contactArea, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("roughness", params_.roughness, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("master_volume", params_.masterVolume, jsonBuffer, offset, jsonBufferSize);
+    writeJsonParameter("kit_layout", params_.kitLayout, jsonBuffer, offset, jsonBufferSize);
 
     // Write JSON closing (remove trailing comma)
     if (offset > 2) {
@@ -1101,6 +1780,10 @@ bool AetherGiantDrumsPureDSP::loadPreset(const char* jsonData)
         params_.airLoss = static_cast<float>(value);
     if (parseJsonParameter(jsonData, "transient_slowing", value))
         params_.transientSlowing = static_cast<float>(value);
+    if (parseJsonParameter(jsonData, "distance_meters", value))
+        params_.distanceMeters = static_cast<float>(value);
+    if (parseJsonParameter(jsonData, "sympathetic_coupling", value))
+        params_.sympatheticCoupling = static_cast<float>(value);
     if (parseJsonParameter(jsonData, "force", value))
         params_.force = static_cast<float>(value);
     if (parseJsonParameter(jsonData, "speed", value))
@@ -1111,12 +1794,21 @@ bool AetherGiantDrumsPureDSP::loadPreset(const char* jsonData)
         params_.roughness = static_cast<float>(value);
     if (parseJsonParameter(jsonData, "master_volume", value))
         params_.masterVolume = static_cast<float>(value);
+    if (parseJsonParameter(jsonData, "kit_layout", value))
+        params_.kitLayout = juce::jlimit(0, 1, static_cast<int>(value + 0.5));
 
     applyParameters();
 
     return true;
 }
 
+void AetherGiantDrumsPureDSP::setRenderProfile(GiantRenderProfile profile)
+{
+    const bool offline = (profile == GiantRenderProfile::Offline);
+    cpuBudget_.setEnabled(!offline);
+    voiceManager_.setFullDetail(offline);
+}
+
 int AetherGiantDrumsPureDSP::getActiveVoiceCount() const
 {
     return voiceManager_.getActiveVoiceCount();
@@ -1124,24 +1816,16 @@ int AetherGiantDrumsPureDSP::getActiveVoiceCount() const
 
 void AetherGiantDrumsPureDSP::applyParameters()
 {
-    // Apply membrane parameters
-    MembraneResonator::Parameters memParams;
-    memParams.fundamentalFrequency = 80.0f;
-    memParams.tension = params_.membraneTension;
-    memParams.diameterMeters = params_.membraneDiameter;
-    memParams.damping = params_.membraneDamping;
-    memParams.inharmonicity = params_.membraneInharmonicity;
-    memParams.numModes = params_.membraneNumModes;
-    voiceManager_.setMembraneParameters(memParams);
-
-    // Apply shell parameters
-    ShellResonator::Parameters shellParams;
-    shellParams.cavityFrequency = params_.shellCavityFreq;
-    shellParams.shellFormant = params_.shellFormant;
-    shellParams.coupling = params_.shellCoupling;
-    voiceManager_.setShellParameters(shellParams);
-
-    // Apply room parameters
+    // Membrane, shell and nonlinear settings live in the kit map
+    rebuildKit();
+    applyRoomParameters();
+
+    voiceManager_.setListenerDistance(juce::jlimit(1.0f, 100.0f, params_.distanceMeters));
+    voiceManager_.setSympatheticCoupling(params_.sympatheticCoupling);
+}
+
+void AetherGiantDrumsPureDSP::applyRoomParameters()
+{
     DrumRoomCoupling::Parameters roomParams;
     roomParams.roomSize = params_.roomSize;
     roomParams.reflectionGain = params_.reflectionGain;
@@ -1150,6 +1834,56 @@ void AetherGiantDrumsPureDSP::applyParameters()
     voiceManager_.setRoomParameters(roomParams);
 }
 
+void AetherGiantDrumsPureDSP::updateKit()
+{
+    if (kitDirty_)
+        rebuildKit();
+}
+
+void AetherGiantDrumsPureDSP::rebuildKit()
+{
+    // Every setup is derived here (128 notes), so note-ons only copy
+    // coefficients. Only kit-shaping parameter changes come through here.
+    kitDirty_ = false;
+
+    // membrane_diameter sizes every drum relative to its 1.5 m default, on
+    // top of the giant scale
+    constexpr float referenceDiameter = 1.5f;
+    const float sizeMeters = std::max(0.1f, params_.scaleMeters)
+                           * std::max(0.1f, params_.membraneDiameter) / referenceDiameter;
+
+    for (int note = 0; note < DrumKitMap::numNotes; ++note) {
+        // Chromatic: one pitched giant drum per key, all the same size
+        DrumDefinition drum;
+        drum.fundamentalFrequency = std::max(20.0f, 80.0f + (note - 36) * 10.0f);
+        drum.diameterMeters = sizeMeters;
+        drum.tension = params_.membraneTension;
+        drum.damping = params_.membraneDamping + (1.0f - params_.massBias) * 0.003f;
+        drum.inharmonicity = params_.membraneInharmonicity;
+        drum.numModes = params_.membraneNumModes;
+        drum.saturationAmount = params_.saturationAmount;
+        drum.massEffect = params_.massEffect;
+
+        if (params_.kitLayout == 1) {
+            if (const GiantKitDrum* kitDrum = findGiantKitDrum(note)) {
+                drum.fundamentalFrequency = kitDrum->fundamental;
+                drum.diameterMeters = sizeMeters * kitDrum->size;
+                drum.damping += kitDrum->dampingOffset;
+                drum.inharmonicity = kitDrum->inharmonicity;
+                drum.numModes = kitDrum->numModes;
+                drum.chokeGroup = kitDrum->chokeGroup;
+            }
+        }
+
+        // Shell and cavity scale down with the drum's size
+        drum.shell.cavityFrequency = params_.shellCavityFreq / drum.diameterMeters;
+        drum.shell.shellFormant = params_.shellFormant / drum.diameterMeters;
+        drum.shell.coupling = params_.shellCoupling;
+
+        voiceManager_.setDrum(note, drum);
+    }
+}
+
 void AetherGiantDrumsPureDSP::processStereoSample(float& left, float& right)
 {
     // Currently mono output, but could add stereo enhancement here
@@ -20,7 +20,6 @@
 #include "../../../../include/dsp/LookupTables.h"
 #include <cmath>
 #include <algorithm>
-#include <random>
 
 namespace DSP {
 
@@ -29,14 +28,13 @@ namespace DSP {
 //==============================================================================
 
 LipReedExciter::LipReedExciter()
-    : rng(std::random_device{}())
-    , dist(0.0f, 1.0f)
 {
 }
 
 void LipReedExciter::prepare(double sampleRate)
 {
     sr = sampleRate;
+    controlSmoothing = 1.0f - std::exp(-1.0f / (controlSmoothingSeconds * static_cast<float>(sr)));
     reset();
 }
 
@@ -50,11 +48,20 @@ void LipReedExciter::reset()
     lipStiffness = 1.0f;
     oscillationStarted = false;
     attackTransient = 0.0f;
+    breath = breathTarget;
+    lipBend = lipBendTarget;
+    noise.seed(noiseSeed);
+    softClip.reset();
 }
 
 float LipReedExciter::processSample(float pressure, float frequency)
 {
-    currentPressure = pressure * params.mouthPressure;
+    // Controllers: one-pole at audio rate, so dense CC streams don't zipper
+    breath += (breathTarget - breath) * controlSmoothing;
+    lipBend += (lipBendTarget - lipBend) * controlSmoothing;
+    effectiveLipTension = juce::jlimit(0.0f, 1.0f, params.lipTension + lipBend);
+
+    currentPressure = pressure * params.mouthPressure * breath;
 
     // ENHANCED: Pressure-dependent oscillation threshold
     // Real brass instruments need minimum pressure to start oscillating
@@ -114,7 +121,7 @@ float LipReedExciter::processSample(float pressure, float frequency)
     {
         float chaosAmount = (currentPressure - params.chaosThreshold) *
                            params.growlAmount;
-        chaos = dist(rng) * chaosAmount * 0.5f;
+        chaos = noise.nextUniform() * chaosAmount * 0.5f;
     }
 
     // ENHANCED: Reed dynamics with mass and stiffness
@@ -146,7 +153,7 @@ float LipReedExciter::processSample(float pressure, float frequency)
     float output = reedPosition * amplitude * 2.0f;
 
     // Soft clipping
-    output = std::tanh(output);
+    output = antialiased ? softClip.processSample(output) : std::tanh(output);
 
     return output;
 }
@@ -156,10 +163,35 @@ void LipReedExciter::setParameters(const Parameters& p)
     params = p;
 }
 
+void LipReedExciter::setNoiseSeed(uint64_t seed)
+{
+    noiseSeed = seed;
+    noise.seed(seed);
+}
+
+void LipReedExciter::setAntialiased(bool enabled)
+{
+    if (enabled && !antialiased)
+        softClip.reset();
+    antialiased = enabled;
+}
+
+void LipReedExciter::setControlTargets(float newBreath, float newLipBend)
+{
+    breathTarget = juce::jlimit(0.0f, 1.0f, newBreath);
+    lipBendTarget = juce::jlimit(-0.5f, 0.5f, newLipBend);
+}
+
+void LipReedExciter::snapControls()
+{
+    breath = breathTarget;
+    lipBend = lipBendTarget;
+}
+
 float LipReedExciter::calculateReedFrequency(float targetFreq) const
 {
     // Lip tension shifts the reed's natural frequency
-    float tensionFactor = 1.0f + (params.lipTension - 0.5f) * 0.2f;
+    float tensionFactor = 1.0f + (effectiveLipTension - 0.5f) * 0.2f;
     return targetFreq * tensionFactor;
 }
 
@@ -170,7 +202,7 @@ float LipReedExciter::calculateOscillationThreshold(float frequency) const
     // Lip tension raises the threshold
     float baseThreshold = 0.2f;
     float frequencyEffect = (frequency / 1000.0f) * 0.1f;
-    float tensionEffect = params.lipTension * 0.15f;
+    float tensionEffect = effectiveLipTension * 0.15f;
     float stiffnessEffect = params.lipStiffness * 0.1f;
 
     return baseThreshold + frequencyEffect + tensionEffect + stiffnessEffect;
@@ -211,11 +243,9 @@ BoreWaveguide::BoreWaveguide()
     // At 96kHz: 0.002 * 96000 = 192 samples (use 128 for 48kHz safety)
     static constexpr int MAX_CAVITY_DELAY_SAMPLES = 128;
 
-    forwardDelay.resize(MAX_BORE_DELAY_SAMPLES);
-    backwardDelay.resize(MAX_BORE_DELAY_SAMPLES);
-    mouthpieceCavity.resize(MAX_CAVITY_DELAY_SAMPLES);
-
-    // Store buffer sizes for circular buffer operations
+    // Store buffer sizes for circular buffer operations. The buffers
+    // themselves are allocated in prepare() so that constructing a voice
+    // stays cheap (lazy voice preparation)
     maxDelaySize = MAX_BORE_DELAY_SAMPLES;
     maxCavitySize = MAX_CAVITY_DELAY_SAMPLES;
 }
@@ -223,6 +253,14 @@ BoreWaveguide::BoreWaveguide()
 void BoreWaveguide::prepare(double sampleRate)
 {
     sr = sampleRate;
+
+    if (static_cast<int>(forwardDelay.size()) != maxDelaySize)
+    {
+        forwardDelay.assign(maxDelaySize, 0.0f);
+        backwardDelay.assign(maxDelaySize, 0.0f);
+        mouthpieceCavity.assign(maxCavitySize, 0.0f);
+    }
+
     updateDelayLength();
     reset();
 }
@@ -684,16 +722,15 @@ float BellRadiationFilter::radiationFilter(float input, float cutoff)
 
 HornFormantShaper::HornFormantShaper()
 {
+    // Switching horn type later never reallocates
+    formants.reserve(GiantSharedTables::maxHornFormants);
     initializeHornType(HornType::Tuba);
 }
 
 void HornFormantShaper::prepare(double sampleRate)
 {
     sr = sampleRate;
-    for (auto& formant : formants)
-    {
-        formant.prepare(sampleRate);
-    }
+    initializeHornType(params.hornType);
     reset();
 }
 
@@ -711,11 +748,13 @@ void HornFormantShaper::reset()
 
 float HornFormantShaper::processSample(float input)
 {
-    // Process through formant filters
+    // Process through formant filters (formantLimit drops the upper formants
+    // under CPU pressure; the average still uses the full count so level holds)
     float formantOutput = 0.0f;
-    for (auto& formant : formants)
+    const size_t activeFormants = std::min(formants.size(), static_cast<size_t>(formantLimit));
+    for (size_t i = 0; i < activeFormants; ++i)
     {
-        formantOutput += formant.processSample(input);
+        formantOutput += formants[i].processSample(input);
     }
 
     // Average formants
@@ -737,7 +776,13 @@ float HornFormantShaper::processSample(float input)
 
 void HornFormantShaper::setParameters(const Parameters& p)
 {
+    const bool typeChanged = p.hornType != params.hornType;
     params = p;
+
+    if (typeChanged)
+    {
+        initializeHornType(params.hornType);
+    }
 }
 
 void HornFormantShaper::setHornType(HornType type)
@@ -746,6 +791,27 @@ void HornFormantShaper::setHornType(HornType type)
     initializeHornType(type);
 }
 
+void HornFormantShaper::setSharedTables(const GiantSharedTables* tables)
+{
+    sharedTables = tables;
+}
+
+void HornFormantShaper::setFormantLimit(int limit)
+{
+    if (formants.empty())
+        return;
+
+    const int newLimit = std::clamp(limit, 1, static_cast<int>(formants.size()));
+
+    // Clear dropped formants so they restart cleanly when restored
+    for (int i = newLimit; i < formantLimit && i < static_cast<int>(formants.size()); ++i)
+    {
+        formants[i].reset();
+    }
+
+    formantLimit = newLimit;
+}
+
 float HornFormantShaper::brightnessFilter(float input, float amount)
 {
     // High-frequency emphasis
@@ -766,184 +832,47 @@ float HornFormantShaper::warmthFilter(float input, float amount)
 
 void HornFormantShaper::initializeHornType(HornType type)
 {
-    formants.clear();
+    // OPTIMIZED: Coefficients come from the process-wide tables when they match
+    // our rate; before prepare() (or without tables) they are built locally
+    const int typeIndex = static_cast<int>(type);
 
-    switch (type)
-    {
-        case HornType::Trumpet:
-            // Bright, focused
-            {
-                HornFormantShaper::FormantFilter f1;
-                f1.frequency = 1200.0f;
-                f1.amplitude = 1.0f;
-                f1.bandwidth = 1.5f;
-                formants.push_back(f1);
-
-                HornFormantShaper::FormantFilter f2;
-                f2.frequency = 2500.0f;
-                f2.amplitude = 0.7f;
-                f2.bandwidth = 2.0f;
-                formants.push_back(f2);
-
-                HornFormantShaper::FormantFilter f3;
-                f3.frequency = 4000.0f;
-                f3.amplitude = 0.4f;
-                f3.bandwidth = 2.5f;
-                formants.push_back(f3);
-            }
-            break;
-
-        case HornType::Trombone:
-            // Warm, broad
-            {
-                HornFormantShaper::FormantFilter f1;
-                f1.frequency = 500.0f;
-                f1.amplitude = 1.0f;
-                f1.bandwidth = 1.2f;
-                formants.push_back(f1);
-
-                HornFormantShaper::FormantFilter f2;
-                f2.frequency = 1500.0f;
-                f2.amplitude = 0.8f;
-                f2.bandwidth = 1.8f;
-                formants.push_back(f2);
-
-                HornFormantShaper::FormantFilter f3;
-                f3.frequency = 3000.0f;
-                f3.amplitude = 0.5f;
-                f3.bandwidth = 2.2f;
-                formants.push_back(f3);
-            }
-            break;
-
-        case HornType::Tuba:
-            // Dark, massive
-            {
-                HornFormantShaper::FormantFilter f1;
-                f1.frequency = 80.0f;
-                f1.amplitude = 1.0f;
-                f1.bandwidth = 0.8f;
-                formants.push_back(f1);
-
-                HornFormantShaper::FormantFilter f2;
-                f2.frequency = 400.0f;
-                f2.amplitude = 0.9f;
-                f2.bandwidth = 1.2f;
-                formants.push_back(f2);
-
-                HornFormantShaper::FormantFilter f3;
-                f3.frequency = 1200.0f;
-                f3.amplitude = 0.6f;
-                f3.bandwidth = 1.8f;
-                formants.push_back(f3);
-
-                HornFormantShaper::FormantFilter f4;
-                f4.frequency = 2500.0f;
-                f4.amplitude = 0.3f;
-                f4.bandwidth = 2.5f;
-                formants.push_back(f4);
-            }
-            break;
-
-        case HornType::FrenchHorn:
-            // Mellow, complex
-            {
-                HornFormantShaper::FormantFilter f1;
-                f1.frequency = 200.0f;
-                f1.amplitude = 1.0f;
-                f1.bandwidth = 1.0f;
-                formants.push_back(f1);
-
-                HornFormantShaper::FormantFilter f2;
-                f2.frequency = 800.0f;
-                f2.amplitude = 0.8f;
-                f2.bandwidth = 1.5f;
-                formants.push_back(f2);
-
-                HornFormantShaper::FormantFilter f3;
-                f3.frequency = 2000.0f;
-                f3.amplitude = 0.6f;
-                f3.bandwidth = 2.0f;
-                formants.push_back(f3);
-
-                HornFormantShaper::FormantFilter f4;
-                f4.frequency = 3500.0f;
-                f4.amplitude = 0.4f;
-                f4.bandwidth = 2.8f;
-                formants.push_back(f4);
-            }
-            break;
-
-        case HornType::Saxophone:
-            // Reed character
-            {
-                HornFormantShaper::FormantFilter f1;
-                f1.frequency = 400.0f;
-                f1.amplitude = 1.0f;
-                f1.bandwidth = 1.3f;
-                formants.push_back(f1);
-
-                HornFormantShaper::FormantFilter f2;
-                f2.frequency = 1500.0f;
-                f2.amplitude = 0.7f;
-                f2.bandwidth = 1.8f;
-                formants.push_back(f2);
-
-                HornFormantShaper::FormantFilter f3;
-                f3.frequency = 3000.0f;
-                f3.amplitude = 0.5f;
-                f3.bandwidth = 2.2f;
-                formants.push_back(f3);
-            }
-            break;
+    GiantSharedTables::HornFormantSet localSet;
+    const GiantSharedTables::HornFormantSet* set = nullptr;
 
-        case HornType::Custom:
-        default:
-            // Neutral
-            {
-                HornFormantShaper::FormantFilter f1;
-                f1.frequency = 500.0f;
-                f1.amplitude = 1.0f;
-                f1.bandwidth = 1.5f;
-                formants.push_back(f1);
-
-                HornFormantShaper::FormantFilter f2;
-                f2.frequency = 1500.0f;
-                f2.amplitude = 0.7f;
-                f2.bandwidth = 2.0f;
-                formants.push_back(f2);
-
-                HornFormantShaper::FormantFilter f3;
-                f3.frequency = 3000.0f;
-                f3.amplitude = 0.4f;
-                f3.bandwidth = 2.5f;
-                formants.push_back(f3);
-            }
-            break;
+    if (sharedTables != nullptr && sharedTables->getSampleRate() == sr)
+    {
+        set = &sharedTables->getHornFormants(typeIndex);
+    }
+    else
+    {
+        localSet = GiantSharedTables::buildHornFormants(typeIndex, sr);
+        set = &localSet;
     }
 
-    // Prepare formants
-    for (auto& formant : formants)
+    formants.resize(static_cast<size_t>(set->count));
+
+    for (int i = 0; i < set->count; ++i)
     {
-        formant.prepare(sr);
+        const auto& source = set->formants[i];
+        auto& formant = formants[i];
+        formant.frequency = source.frequency;
+        formant.amplitude = source.amplitude;
+        formant.bandwidth = source.bandwidth;
+        formant.pole = source.pole;
+        formant.phaseIncrement = source.phaseIncrement;
+        formant.reset();
     }
-}
 
-// FormantFilter implementation
-void HornFormantShaper::FormantFilter::prepare(double sampleRate)
-{
-    sr = sampleRate;
+    formantLimit = static_cast<int>(formants.size());
 }
 
 float HornFormantShaper::FormantFilter::processSample(float input)
 {
-    // Simple resonant filter
-    float freq = frequency; // Frequency can be modulated by parent
-    float bw = bandwidth * 100.0f;
-    float r = std::exp(-bw / (freq + bw));
+    // Simple resonant filter (pole radius and phase step are precomputed)
+    float r = pole;
     float coeff = 2.0f * r * SchillingerEcosystem::DSP::fastCosineLookup(phase);
 
-    phase += freq * 2.0f * static_cast<float>(M_PI) / static_cast<float>(sr);
+    phase += phaseIncrement;
     if (phase >= 2.0f * static_cast<float>(M_PI))
         phase -= 2.0f * static_cast<float>(M_PI);
 
@@ -963,12 +892,14 @@ void HornFormantShaper::FormantFilter::reset()
 
 void GiantHornVoice::prepare(double sampleRate)
 {
+    // Components reset themselves; the voice's own state is left alone
+    // since the warm-up runs this beside the audio thread (a fresh voice is
+    // already idle)
     sr = sampleRate;
     lipReed.prepare(sampleRate);
     bore.prepare(sampleRate);
     bell.prepare(sampleRate);
     formants.prepare(sampleRate);
-    reset();
 }
 
 void GiantHornVoice::reset()
@@ -981,9 +912,12 @@ void GiantHornVoice::reset()
     targetPressure = 0.0f;
     envelopePhase = 0.0f;
     active = false;
+    setModulation(0.0f, 0.0f, 0.0f);
+    appliedPitchRatio = modPitchRatio;
 }
 
-void GiantHornVoice::trigger(int note, float vel, const GiantGestureParameters& gestureParam,
+void GiantHornVoice::trigger(int note, float noteFrequency, float vel,
+                             const GiantGestureParameters& gestureParam,
                              const GiantScaleParameters& scaleParam)
 {
     midiNote = note;
@@ -999,13 +933,31 @@ void GiantHornVoice::trigger(int note, float vel, const GiantGestureParameters&
     currentPressure = 0.0f;
 
     // Set bore length based on note
-    float freq = SchillingerEcosystem::DSP::LookupTables::getInstance().midiToFreq(static_cast<float>(note));
-    float boreLength = 343.0f / (2.0f * freq);
+    pitch.set(noteFrequency);
+    float boreLength = 343.0f / (2.0f * noteFrequency);
     bore.setLengthMeters(boreLength);
+    appliedPitchRatio = 1.0f;       // Modulation is reapplied from the next sample
 
     active = true;
 }
 
+void GiantHornVoice::retune(float noteFrequency)
+{
+    pitch.glideTo(noteFrequency, sr);
+}
+
+void GiantHornVoice::setModulation(float level, float semitones, float breath)
+{
+    modGain = std::max(0.0f, 1.0f + level);
+    modPressure = std::max(0.0f, 1.0f + breath);
+
+    if (semitones != modSemitones)
+    {
+        modSemitones = semitones;
+        modPitchRatio = std::exp2(semitones * (1.0f / 12.0f));
+    }
+}
+
 void GiantHornVoice::release(bool damping)
 {
     envelopePhase = 2.0f; // Release phase
@@ -1029,8 +981,17 @@ float GiantHornVoice::processSample()
         return 0.0f;
     }
 
-    // Calculate frequency
-    float frequency = SchillingerEcosystem::DSP::LookupTables::getInstance().midiToFreq(static_cast<float>(midiNote));
+    // Note frequency (bore follows while a retune glides or the matrix bends it)
+    const bool gliding = pitch.isGliding();
+    float frequency = (gliding ? pitch.advance() : pitch.frequency) * modPitchRatio;
+    if (gliding || modPitchRatio != appliedPitchRatio)
+    {
+        bore.setLengthMeters(343.0f / (2.0f * frequency));
+        appliedPitchRatio = modPitchRatio;
+    }
+
+    // Matrix breath scales the mouth pressure; the envelope itself runs on
+    pressure *= modPressure;
 
     // Apply scale-based frequency shift (giant instruments are lower)
     frequency *= 1.0f / (1.0f + scale.scaleMeters * 0.05f);
@@ -1048,7 +1009,7 @@ float GiantHornVoice::processSample()
     float output = formants.processSample(bellOutput);
 
     // Apply velocity and scale
-    output *= velocity;
+    output *= velocity * modGain;
     output *= 1.0f / (1.0f + scale.scaleMeters * 0.1f); // Giant = quieter
 
     return output;
@@ -1103,34 +1064,106 @@ void GiantHornVoiceManager::prepare(double sampleRate, int maxVoices)
     currentSampleRate = sampleRate;
     voices.clear();
 
+    // Voices are cheap to construct; the ~96 KB bore buffers are only
+    // allocated for the eager pool here, the rest via warmUp()
     for (int i = 0; i < maxVoices; ++i)
     {
         auto voice = std::make_unique<GiantHornVoice>();
-        voice->prepare(sampleRate);
+        if (i < eagerVoices)
+            prepareVoice(*voice);
         voices.push_back(std::move(voice));
     }
+
+    for (int i = 0; i < eagerVoices && i < maxVoices; ++i)
+        adoptVoice(static_cast<size_t>(i));
+}
+
+void GiantHornVoiceManager::prepareVoice(GiantHornVoice& voice)
+{
+    // Allocation only: settings the audio thread may be changing are
+    // replayed when it adopts the voice
+    voice.formants.setSharedTables(sharedTables);
+    voice.prepare(currentSampleRate);
+    voice.ready.store(true, std::memory_order_release);
+}
+
+void GiantHornVoiceManager::adoptVoice(size_t index)
+{
+    auto& voice = *voices[index];
+    voice.lipReed.setParameters(lipReedParams);
+    voice.bore.setParameters(boreParams);
+    voice.formants.setParameters(formantParams);
+    voice.lipReed.setAntialiased(antialiasedReed);
+    voice.lipReed.setNoiseSeed(GiantNoise::deriveSeed(noiseSeed, static_cast<uint64_t>(index)));
+    voice.prepared = true;
+}
+
+int GiantHornVoiceManager::warmUp(int maxVoices)
+{
+    int cold = 0;
+    for (auto& voice : voices)
+    {
+        if (voice->ready.load(std::memory_order_acquire))
+            continue;
+
+        if (maxVoices > 0)
+        {
+            prepareVoice(*voice);
+            --maxVoices;
+        }
+        else
+        {
+            ++cold;
+        }
+    }
+    return cold;
+}
+
+int GiantHornVoiceManager::getPreparedVoiceCount() const
+{
+    int count = 0;
+    for (const auto& voice : voices)
+    {
+        if (voice->ready.load(std::memory_order_acquire))
+            count++;
+    }
+    return count;
 }
 
 void GiantHornVoiceManager::reset()
 {
     for (auto& voice : voices)
     {
-        voice->reset();
+        if (voice->prepared)
+            voice->reset();
     }
+    outputClip.reset();
 }
 
 GiantHornVoice* GiantHornVoiceManager::findFreeVoice()
 {
-    // First try to find inactive voice
+    // First try to find inactive, already prepared voice
     for (auto& voice : voices)
     {
-        if (!voice->isActive())
+        if (!voice->isActive() && voice->prepared)
         {
             return voice.get();
         }
     }
 
+    // Then one the warm-up has published since
+    for (size_t v = 0; v < voices.size(); ++v)
+    {
+        if (!voices[v]->prepared && voices[v]->ready.load(std::memory_order_acquire))
+        {
+            adoptVoice(v);
+            return voices[v].get();
+        }
+    }
+
     // If all active, steal oldest (simple strategy)
+    // Cold voices are never prepared here (that allocates); the warm-up
+    // brings them in off the audio thread. voices[0] is in the eager pool.
     return voices[0].get();
 }
 
@@ -1154,16 +1187,26 @@ void GiantHornVoiceManager::handleNoteOn(int note, float velocity,
     if (voice != nullptr)
     {
         // Retrigger
-        voice->trigger(note, velocity, gesture, scale);
+        voice->trigger(note, tuning->getFrequency(note), velocity, gesture, scale);
     }
     else
     {
         voice = findFreeVoice();
         if (voice != nullptr)
         {
-            voice->trigger(note, velocity, gesture, scale);
+            voice->trigger(note, tuning->getFrequency(note), velocity, gesture, scale);
         }
     }
+
+    // Idle voices don't run their controller smoothing: start at the current value
+    if (voice != nullptr)
+    {
+        voice->lipReed.setControlTargets(breath * expression, lipBend);
+        voice->lipReed.snapControls();
+
+        if (modulation != nullptr)
+            modulation->noteOn(indexOf(voice), note, velocity);
+    }
 }
 
 void GiantHornVoiceManager::handleNoteOff(int note, bool damping)
@@ -1172,34 +1215,85 @@ void GiantHornVoiceManager::handleNoteOff(int note, bool damping)
     if (voice != nullptr)
     {
         voice->release(damping);
+
+        if (modulation != nullptr)
+            modulation->noteOff(indexOf(voice));
     }
 }
 
 void GiantHornVoiceManager::allNotesOff()
 {
-    for (auto& voice : voices)
+    for (size_t v = 0; v < voices.size(); ++v)
     {
-        if (voice->isActive())
+        if (voices[v]->isActive())
         {
-            voice->release();
+            voices[v]->release();
+
+            if (modulation != nullptr)
+                modulation->noteOff(static_cast<int>(v));
         }
     }
 }
 
-float GiantHornVoiceManager::processSample()
+float GiantHornVoiceManager::processSample(float* voiceOutputs)
 {
     float output = 0.0f;
-    for (auto& voice : voices)
+
+    const bool modulated = (modulation != nullptr && modulation->isRunning());
+    if (modulated)
+        modulation->advance();
+
+    for (size_t v = 0; v < voices.size(); ++v)
     {
-        output += voice->processSample();
+        if (!voices[v]->prepared)
+        {
+            if (voiceOutputs != nullptr)
+                voiceOutputs[v] = 0.0f;
+            continue;
+        }
+
+        if (modulated)
+        {
+            const int index = static_cast<int>(v);
+            voices[v]->setModulation(modulation->getValue(index, GiantModDestination::Level),
+                                     modulation->getValue(index, GiantModDestination::Pitch),
+                                     modulation->getValue(index, GiantModDestination::Breath));
+        }
+
+        const float voiceOutput = voices[v]->processSample();
+        if (voiceOutputs != nullptr)
+            voiceOutputs[v] = voiceOutput;
+        output += voiceOutput;
     }
 
-    // Soft clip to prevent overload
-    output = std::tanh(output);
+    // Soft clip to prevent overload (ADAA tanh: loud chords don't alias)
+    output = outputClip.processSample(output);
+
+    if (voiceOutputs != nullptr)
+        distributeBusSample(voiceOutputs, static_cast<int>(voices.size()), output);
 
     return output;
 }
 
+int GiantHornVoiceManager::indexOf(const GiantHornVoice* voice) const
+{
+    for (size_t v = 0; v < voices.size(); ++v)
+    {
+        if (voices[v].get() == voice)
+            return static_cast<int>(v);
+    }
+    return -1;
+}
+
+int GiantHornVoiceManager::getVoiceNote(int index) const
+{
+    if (index < 0 || index >= static_cast<int>(voices.size()))
+        return -1;
+
+    const auto& voice = voices[static_cast<size_t>(index)];
+    return voice->isActive() ? voice->midiNote : -1;
+}
+
 int GiantHornVoiceManager::getActiveVoiceCount() const
 {
     int count = 0;
@@ -1211,27 +1305,182 @@ int GiantHornVoiceManager::getActiveVoiceCount() const
     return count;
 }
 
+int GiantHornVoiceManager::getVoiceEnergies(float* energies, int maxVoices) const
+{
+    const int count = std::min(maxVoices, static_cast<int>(voices.size()));
+    for (int i = 0; i < count; ++i)
+    {
+        const auto& voice = voices[static_cast<size_t>(i)];
+        energies[i] = voice->isActive() ? voice->currentPressure * voice->velocity : 0.0f;
+    }
+    return count;
+}
+
 void GiantHornVoiceManager::setLipReedParameters(const LipReedExciter::Parameters& params)
 {
+    lipReedParams = params;
     for (auto& voice : voices)
     {
-        voice->lipReed.setParameters(params);
+        if (voice->prepared)
+            voice->lipReed.setParameters(params);
     }
 }
 
 void GiantHornVoiceManager::setBoreParameters(const BoreWaveguide::Parameters& params)
 {
+    boreParams = params;
     for (auto& voice : voices)
     {
-        voice->bore.setParameters(params);
+        if (voice->prepared)
+            voice->bore.setParameters(params);
     }
 }
 
 void GiantHornVoiceManager::setFormantParameters(const HornFormantShaper::Parameters& params)
 {
+    formantParams = params;
+    for (auto& voice : voices)
+    {
+        if (voice->prepared)
+            voice->formants.setParameters(params);
+    }
+}
+
+void GiantHornVoiceManager::setSharedTables(const GiantSharedTables* tables)
+{
+    sharedTables = tables;
+}
+
+void GiantHornVoiceManager::setNoiseSeed(uint64_t seed)
+{
+    if (seed == noiseSeed)
+        return;
+
+    noiseSeed = seed;
+    for (size_t i = 0; i < voices.size(); ++i)
+    {
+        if (voices[i]->prepared)
+            voices[i]->lipReed.setNoiseSeed(GiantNoise::deriveSeed(seed, static_cast<uint64_t>(i)));
+    }
+}
+
+void GiantHornVoiceManager::setBreath(float newBreath)
+{
+    breath = newBreath;
+    for (auto& voice : voices)
+    {
+        if (voice->prepared)
+            voice->lipReed.setControlTargets(breath * expression, lipBend);
+    }
+}
+
+void GiantHornVoiceManager::setExpression(float newExpression)
+{
+    expression = newExpression;
     for (auto& voice : voices)
     {
-        voice->formants.setParameters(params);
+        if (voice->prepared)
+            voice->lipReed.setControlTargets(breath * expression, lipBend);
+    }
+}
+
+void GiantHornVoiceManager::setLipBend(float newLipBend)
+{
+    lipBend = newLipBend;
+    for (auto& voice : voices)
+    {
+        if (voice->prepared)
+            voice->lipReed.setControlTargets(breath * expression, lipBend);
+    }
+}
+
+void GiantHornVoiceManager::setAntialiasedReed(bool enabled)
+{
+    antialiasedReed = enabled;
+    for (auto& voice : voices)
+    {
+        if (voice->prepared)
+            voice->lipReed.setAntialiased(antialiasedReed);
+    }
+}
+
+void GiantHornVoiceManager::setTuningTable(const GiantTuningTable& table)
+{
+    tuning = &table;
+
+    for (auto& voice : voices)
+    {
+        if (voice->isActive())
+            voice->retune(tuning->getFrequency(voice->midiNote));
+    }
+}
+
+void GiantHornVoiceManager::applyQuality(const GiantCpuBudget& budget)
+{
+    const auto quality = budget.getQuality();
+
+    // Voice level ~ breath pressure * velocity
+    auto levelOf = [](const GiantHornVoice& voice)
+    {
+        return voice.currentPressure * voice.velocity;
+    };
+
+    float loudest = 0.0f;
+    int sustainingCount = 0;
+    for (const auto& voice : voices)
+    {
+        if (voice->isActive())
+        {
+            loudest = std::max(loudest, levelOf(*voice));
+            if (voice->envelopePhase < 2.0f)
+                ++sustainingCount;
+        }
+    }
+
+    // Reduced trims only quiet voices; Low/Minimal trim everything but the loudest
+    const float quietThreshold = (quality == GiantCpuBudget::Quality::Reduced) ? 0.25f : 0.9f;
+
+    for (auto& voice : voices)
+    {
+        if (!voice->isActive())
+            continue;
+
+        const int fullFormants = voice->formants.getFormantCount();
+        const bool quiet = levelOf(*voice) < loudest * quietThreshold;
+
+        if (quality == GiantCpuBudget::Quality::Full || !quiet)
+            voice->formants.setFormantLimit(fullFormants);
+        else
+            voice->formants.setFormantLimit(budget.scaleCount(fullFormants, 1));
+    }
+
+    // Polyphony cap: release the quietest sustaining voices early
+    if (quality < GiantCpuBudget::Quality::Low)
+        return;
+
+    const int maxActive = budget.scaleCount(static_cast<int>(voices.size()), 2);
+    while (sustainingCount > maxActive)
+    {
+        GiantHornVoice* quietest = nullptr;
+        float quietestLevel = 0.0f;
+        for (auto& voice : voices)
+        {
+            if (!voice->isActive() || voice->envelopePhase >= 2.0f)
+                continue;
+
+            const float level = levelOf(*voice);
+            if (quietest == nullptr || level < quietestLevel)
+            {
+                quietest = voice.get();
+                quietestLevel = level;
+            }
+        }
+
+        if (quietest == nullptr)
+            break;
+
+        quietest->release(true);
+        --sustainingCount;
     }
 }
 
@@ -1251,6 +1500,8 @@ AetherGiantHornsPureDSP::AetherGiantHornsPureDSP()
     currentGesture_.speed = params_.speed;
     currentGesture_.contactArea = params_.contactArea;
     currentGesture_.roughness = params_.roughness;
+
+    voiceManager_.setModMatrix(&modMatrix_);
 }
 
 AetherGiantHornsPureDSP::~AetherGiantHornsPureDSP() = default;
@@ -1260,7 +1511,16 @@ bool AetherGiantHornsPureDSP::prepare(double sampleRate, int blockSize)
     sampleRate_ = sampleRate;
     blockSize_ = blockSize;
 
+    // One set of tables per sample rate, shared by every instance in the process
+    sharedTables_ = GiantSharedTables::acquire(sampleRate);
+    voiceManager_.setSharedTables(sharedTables_.get());
+
     voiceManager_.prepare(sampleRate, maxVoices_);
+    modMatrix_.prepare(sampleRate, maxVoices_);
+    cpuBudget_.prepare(sampleRate, blockSize);
+
+    voiceSamples_.assign(static_cast<size_t>(maxVoices_), 0.0f);
+    stemNotes_.assign(static_cast<size_t>(maxVoices_), -1);
 
     applyParameters();
 
@@ -1270,26 +1530,133 @@ bool AetherGiantHornsPureDSP::prepare(double sampleRate, int blockSize)
 void AetherGiantHornsPureDSP::reset()
 {
     voiceManager_.reset();
+    modMatrix_.reset();
+    numControllerEvents_ = 0;
+    cpuBudget_.reset();
 }
 
 void AetherGiantHornsPureDSP::process(float** outputs, int numChannels, int numSamples)
 {
-    // Clear outputs
-    for (int ch = 0; ch < numChannels; ++ch)
+    if (numChannels <= 0)
+        return;
+
+    cpuBudget_.beginBlock();
+    voiceManager_.applyQuality(cpuBudget_);
+
+    renderBlock(outputs[0], nullptr, numSamples);
+
+    // Stereo output (mono source)
+    for (int ch = 1; ch < numChannels; ++ch)
+    {
+        std::copy(outputs[0], outputs[0] + numSamples, outputs[ch]);
+    }
+
+    cpuBudget_.endBlock(numSamples);
+}
+
+void AetherGiantHornsPureDSP::processStems(float* const* stems, GiantStemPosition* positions, int numSamples)
+{
+    cpuBudget_.beginBlock();
+    voiceManager_.applyQuality(cpuBudget_);
+
+    const int numStems = voiceManager_.getNumVoices();
+
+    // Voices that finish during the block still sounded in it
+    for (int v = 0; v < numStems; ++v)
+        positions[v].active = (voiceManager_.getVoiceNote(v) >= 0);
+
+    renderBlock(nullptr, stems, numSamples);
+
+    for (int v = 0; v < numStems; ++v)
     {
-        std::fill(outputs[ch], outputs[ch] + numSamples, 0.0f);
+        const int note = voiceManager_.getVoiceNote(v);
+        GiantStemPosition& position = positions[v];
+
+        // A slot that was idle or changed note is a new source, not a moving one
+        position.retriggered = (note >= 0 && note != stemNotes_[static_cast<size_t>(v)]);
+        position.active = position.active || note >= 0;
+        if (note >= 0)
+            position.lateral = std::clamp((static_cast<float>(note) - 60.0f) / 30.0f, -1.0f, 1.0f);
+
+        stemNotes_[static_cast<size_t>(v)] = note;
     }
 
-    // Process samples
+    cpuBudget_.endBlock(numSamples);
+}
+
+void AetherGiantHornsPureDSP::renderBlock(float* mono, float* const* stems, int numSamples)
+{
+    const int numStems = voiceManager_.getNumVoices();
+
+    int nextControllerEvent = 0;
     for (int i = 0; i < numSamples; ++i)
     {
-        float sample = voiceManager_.processSample() * params_.masterVolume;
+        // Controller changes land on their own sample
+        while (nextControllerEvent < numControllerEvents_
+               && controllerEvents_[static_cast<size_t>(nextControllerEvent)].sampleOffset <= i)
+        {
+            applyControllerEvent(controllerEvents_[static_cast<size_t>(nextControllerEvent++)]);
+        }
 
-        // Stereo output (mono source)
-        for (int ch = 0; ch < numChannels; ++ch)
+        if (stems == nullptr)
         {
-            outputs[ch][i] = sample;
+            mono[i] = voiceManager_.processSample() * params_.masterVolume;
+            continue;
         }
+
+        voiceManager_.processSample(voiceSamples_.data());
+        for (int v = 0; v < numStems; ++v)
+            stems[v][i] = voiceSamples_[static_cast<size_t>(v)] * params_.masterVolume;
+    }
+
+    // Offsets past the end of the block still take effect
+    while (nextControllerEvent < numControllerEvents_)
+        applyControllerEvent(controllerEvents_[static_cast<size_t>(nextControllerEvent++)]);
+    numControllerEvents_ = 0;
+}
+
+void AetherGiantHornsPureDSP::queueControllerEvent(int sampleOffset, ControllerTarget target, float value)
+{
+    const ControllerEvent event { std::max(0, sampleOffset), target, value };
+
+    // Queue full (dense controller input): the newest value replaces the last
+    // queued one for its target, a little early but never overwritten by an
+    // older value later in the block
+    if (numControllerEvents_ == maxControllerEvents)
+    {
+        for (int e = numControllerEvents_ - 1; e >= 0; --e)
+        {
+            ControllerEvent& queued = controllerEvents_[static_cast<size_t>(e)];
+            if (queued.target == target)
+            {
+                queued.value = value;
+                return;
+            }
+        }
+
+        // Nothing queued for this target, so nothing can overwrite it
+        applyControllerEvent(event);
+        return;
+    }
+
+    controllerEvents_[static_cast<size_t>(numControllerEvents_++)] = event;
+}
+
+void AetherGiantHornsPureDSP::applyControllerEvent(const ControllerEvent& event)
+{
+    switch (event.target)
+    {
+        case ControllerTarget::Breath:
+            voiceManager_.setBreath(event.value);
+            break;
+
+        case ControllerTarget::Expression:
+            voiceManager_.setExpression(event.value);
+            break;
+
+        case ControllerTarget::LipBend:
+            voiceManager_.setLipBend(event.value);
+            break;
     }
 }
 
@@ -1312,17 +1679,16 @@ void AetherGiantHornsPureDSP::handleEvent(const ScheduledEvent& event)
             break;
 
         case ScheduledEvent::PITCH_BEND:
-            // Could apply to bore length modification
+            // Pitch bend -> lip tension (players bend brass with their lips)
+            queueControllerEvent(event.sampleOffset, ControllerTarget::LipBend,
+                                 event.data.pitchBend.bendValue * 0.5f);
             break;
 
         case ScheduledEvent::CHANNEL_PRESSURE:
-        {
-            // Channel pressure -> force
-            GiantGestureParameters gesture = currentGesture_;
-            gesture.force = event.data.channelPressure.pressure;
-            currentGesture_ = gesture;
+            // Aftertouch -> breath pressure on the sounding voices
+            queueControllerEvent(event.sampleOffset, ControllerTarget::Breath,
+                                 event.data.channelPressure.pressure);
             break;
-        }
 
         case ScheduledEvent::PARAM_CHANGE:
             // Handle parameter changes
@@ -1330,7 +1696,17 @@ void AetherGiantHornsPureDSP::handleEvent(const ScheduledEvent& event)
             break;
 
         case ScheduledEvent::CONTROL_CHANGE:
-            // Handle CC messages
+            // Breath (CC2) drives the reed pressure, expression (CC11) scales it
+            if (event.data.controlChange.controllerNumber == 2)
+            {
+                queueControllerEvent(event.sampleOffset, ControllerTarget::Breath,
+                                     event.data.controlChange.value);
+            }
+            else if (event.data.controlChange.controllerNumber == 11)
+            {
+                queueControllerEvent(event.sampleOffset, ControllerTarget::Expression,
+                                     event.data.controlChange.value);
+            }
             break;
 
         case ScheduledEvent::RESET:
@@ -1382,6 +1758,8 @@ float AetherGiantHornsPureDSP::getParameter(const char* paramId) const
 
     // Global
     if (std::strcmp(paramId, "masterVolume") == 0) return params_.masterVolume;
+    if (std::strcmp(paramId, "cpuBudget") == 0) return params_.cpuBudget;
+    if (std::strcmp(paramId, "noiseSeed") == 0) return params_.noiseSeed;
 
     return 0.0f;
 }
@@ -1426,6 +1804,8 @@ void AetherGiantHornsPureDSP::setParameter(const char* paramId, float value)
 
     // Global
     else if (std::strcmp(paramId, "masterVolume") == 0) params_.masterVolume = value;
+    else if (std::strcmp(paramId, "cpuBudget") == 0) params_.cpuBudget = value;
+    else if (std::strcmp(paramId, "noiseSeed") == 0) params_.noiseSeed = value;
 
     applyParameters();
 }
@@ -1465,6 +1845,7 @@ bool AetherGiantHornsPureDSP::savePreset(char* jsonBuffer, int jsonBufferSize) c
     writeJsonParameter("contactArea", params_.contactArea, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("roughness", params_.roughness, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("masterVolume", params_.masterVolume, jsonBuffer, offset, jsonBufferSize);
+    writeJsonParameter("noiseSeed", params_.noiseSeed, jsonBuffer, offset, jsonBufferSize);
 
     // Remove trailing comma
     if (offset > 0 && jsonBuffer[offset - 1] == ',')
@@ -1534,6 +1915,8 @@ bool AetherGiantHornsPureDSP::loadPreset(const char* jsonData)
         params_.roughness = static_cast<float>(value);
     if (parseJsonParameter(jsonData, "masterVolume", value))
         params_.masterVolume = static_cast<float>(value);
+    if (parseJsonParameter(jsonData, "noiseSeed", value))
+        params_.noiseSeed = static_cast<float>(value);
 
     applyParameters();
     return true;
@@ -1581,6 +1964,9 @@ void AetherGiantHornsPureDSP::applyParameters()
     formantParams.warmth = params_.warmth;
     formantParams.metalness = params_.metalness;
     voiceManager_.setFormantParameters(formantParams);
+    voiceManager_.setNoiseSeed(static_cast<uint64_t>(std::max(0.0f, params_.noiseSeed)));
+
+    cpuBudget_.setBudget(params_.cpuBudget);
 }
 
 void AetherGiantHornsPureDSP::processStereoSample(float& left, float& right)
@@ -1592,7 +1978,20 @@ void AetherGiantHornsPureDSP::processStereoSample(float& left, float& right)
 
 float AetherGiantHornsPureDSP::calculateFrequency(int midiNote) const
 {
-    return SchillingerEcosystem::DSP::LookupTables::getInstance().midiToFreq(static_cast<float>(midiNote));
+    return tuning_->getFrequency(midiNote);
+}
+
+void AetherGiantHornsPureDSP::setRenderProfile(GiantRenderProfile profile)
+{
+    const bool offline = (profile == GiantRenderProfile::Offline);
+    cpuBudget_.setEnabled(!offline);
+    voiceManager_.setAntialiasedReed(offline);
+}
+
+void AetherGiantHornsPureDSP::setTuningTable(const GiantTuningTable* table)
+{
+    tuning_ = (table != nullptr) ? table : &GiantTuningTable::equalTemperament();
+    voiceManager_.setTuningTable(*tuning_);
 }
 
 bool AetherGiantHornsPureDSP::writeJsonParameter(const char* name, double value,
@@ -228,7 +228,8 @@ float ModalResonatorMode::processSample(float input)
 
     // Process input through SVF resonator
     // The SVF naturally resonates at its center frequency when excited
-    float output = svf.processSample(0, input);
+    double output = svf.processSample(0, static_cast<double>(input) * inputGain + pendingImpulse);
+    pendingImpulse = 0.0;
 
     // Apply amplitude envelope
     output *= amplitude;
@@ -236,21 +237,45 @@ float ModalResonatorMode::processSample(float input)
     // Apply decay
     amplitude *= decay;
 
-    return output;
+    return static_cast<float>(output);
 }
 
 void ModalResonatorMode::excite(float energy)
 {
     amplitude = initialAmplitude * energy;
+    inputGain = 1.0;
+    peakGain = 1.0;
 
     // Give SVF an initial impulse to start resonance
     // This simulates the initial strike impulse
-    svf.processSample(0, energy * 0.5f);  // Drive the SVF to start it ringing
+    pendingImpulse = energy * 0.5;  // Drives the SVF with the next sample
+}
+
+void ModalResonatorMode::reExcite(float energy)
+{
+    const double target = initialAmplitude * energy;
+
+    // A tail that far under the new hit is masked by it: strike afresh
+    if (!(amplitude * maxRestrikeGain > target))
+    {
+        svf.reset();
+        excite(energy);
+        return;
+    }
+
+    // The object is already moving: the tail rings on under the current
+    // envelope and the new input is scaled so it sounds as loud as a fresh hit
+    inputGain = target / amplitude;
+    peakGain = std::max(peakGain, inputGain);
+    pendingImpulse += energy * 0.5 * inputGain;
 }
 
 void ModalResonatorMode::reset()
 {
-    amplitude = 0.0f;
+    amplitude = 0.0;
+    inputGain = 1.0;
+    peakGain = 1.0;
+    pendingImpulse = 0.0;
     svf.reset();
 }
 
@@ -278,25 +303,37 @@ void ModalResonatorBank::reset()
 
 void ModalResonatorBank::strike(float velocity, float force, float contactArea)
 {
-    for (auto& mode : modes)
-    {
-        // Different modes get different energy based on contact area
-        // Small contact area = excites more high modes
-        // Large contact area = excites more low modes
-        float modeExcitation = velocity * force;
-
-        // Frequency-based energy distribution
-        float normalizedFreq = mode.frequency / 440.0f;
-        float frequencyWeight = 1.0f / (1.0f + normalizedFreq * normalizedFreq);
-
-        // Contact area affects brightness
-        float brightnessWeight = (contactArea < 0.5f) ?
-            (1.0f - contactArea * 0.5f) :  // Small = bright
-            (0.5f + contactArea * 0.5f);   // Large = dark
-
-        float energy = modeExcitation * frequencyWeight * brightnessWeight;
-        mode.excite(energy);
-    }
+    // Only rendered modes take energy; trimmed ones would hold it undecayed
+    const size_t activeCount = std::min(modes.size(), static_cast<size_t>(modeLimit));
+    for (size_t i = 0; i < activeCount; ++i)
+        modes[i].excite(strikeEnergy(modes[i], velocity, force, contactArea));
+}
+
+void ModalResonatorBank::restrike(float velocity, float force, float contactArea)
+{
+    const size_t activeCount = std::min(modes.size(), static_cast<size_t>(modeLimit));
+    for (size_t i = 0; i < activeCount; ++i)
+        modes[i].reExcite(strikeEnergy(modes[i], velocity, force, contactArea));
+}
+
+float ModalResonatorBank::strikeEnergy(const ModalResonatorMode& mode, float velocity,
+                                       float force, float contactArea) const
+{
+    // Different modes get different energy based on contact area
+    // Small contact area = excites more high modes
+    // Large contact area = excites more low modes
+    float modeExcitation = velocity * force;
+
+    // Frequency-based energy distribution
+    float normalizedFreq = mode.frequency / 440.0f;
+    float frequencyWeight = 1.0f / (1.0f + normalizedFreq * normalizedFreq);
+
+    // Contact area affects brightness
+    float brightnessWeight = (contactArea < 0.5f) ?
+        (1.0f - contactArea * 0.5f) :  // Small = bright
+        (0.5f + contactArea * 0.5f);   // Large = dark
+
+    return modeExcitation * frequencyWeight * brightnessWeight;
 }
 
 void ModalResonatorBank::scrape(float intensity, float roughness)
@@ -304,28 +341,31 @@ void ModalResonatorBank::scrape(float intensity, float roughness)
     scrapeEnergy = intensity * roughness;
 }
 
-float ModalResonatorBank::processSample()
+float ModalResonatorBank::processSample(float strikeExcitation)
 {
-    // Generate excitation signal (noise burst for SVFs to resonate)
-    float excitation = 0.0f;
+    // Excitation: the exciter's strike burst plus any scrape noise
+    float excitation = strikeExcitation;
     if (scrapeEnergy > 0.001f)
     {
         static FastRNG rng(42);  // Fixed seed for determinism
-        excitation = rng.next() * scrapeEnergy * 0.1f;
+        excitation += rng.next() * scrapeEnergy * 0.1f;
         scrapeEnergy *= 0.99f; // Decay scrape
     }
 
+    // Only the lowest modeLimit modes are rendered (CPU budget level of detail)
+    const size_t activeCount = std::min(modes.size(), static_cast<size_t>(modeLimit));
+
     // Process modes using SIMD when available
 #if DSP_SIMD_NEON_AVAILABLE
-    return SIMD::processModesNEON(excitation, modes.data(), modes.size());
+    return SIMD::processModesNEON(excitation, modes.data(), activeCount);
 #elif DSP_SIMD_AVX_AVAILABLE
-    return SIMD::processModesAVX(excitation, modes.data(), modes.size());
+    return SIMD::processModesAVX(excitation, modes.data(), activeCount);
 #elif DSP_SIMD_SSE_AVAILABLE
-    return SIMD::processModesSSE(excitation, modes.data(), modes.size());
+    return SIMD::processModesSSE(excitation, modes.data(), activeCount);
 #else
     // Scalar fallback - batch process all modes
     float output = 0.0f;
-    for (size_t i = 0; i < modes.size(); ++i)
+    for (size_t i = 0; i < activeCount; ++i)
     {
         output += modes[i].processSample(excitation);
     }
@@ -343,10 +383,56 @@ float ModalResonatorBank::getTotalEnergy() const
 {
     float energy = 0.0f;
     for (const auto& mode : modes)
-        energy += mode.amplitude;
+        energy += static_cast<float>(mode.getEnergy());
     return energy;
 }
 
+void ModalResonatorBank::setModeLimit(int limit)
+{
+    if (modes.empty())
+        return;
+
+    const int newLimit = std::clamp(limit, 1, static_cast<int>(modes.size()));
+
+    // Silence modes that drop out so they neither hold energy nor pop back in
+    for (int i = newLimit; i < modeLimit && i < static_cast<int>(modes.size()); ++i)
+        modes[i].reset();
+
+    modeLimit = newLimit;
+}
+
+int ModalResonatorBank::countModesBelow(float frequencyHz) const
+{
+    // Modes are ordered lowest first, so the level of detail keeps a prefix
+    int count = 0;
+    for (const auto& mode : modes)
+    {
+        if (mode.frequency >= frequencyHz)
+            break;
+        ++count;
+    }
+    return count;
+}
+
+int ModalResonatorBank::trimMaskedModes(float maskingRatio)
+{
+    const int active = std::min(modeLimit, static_cast<int>(modes.size()));
+
+    double loudest = 0.0;
+    for (int i = 0; i < active; ++i)
+        loudest = std::max(loudest, modes[i].getEnergy());
+
+    const double threshold = loudest * maskingRatio;
+    int newLimit = active;
+    while (newLimit > 1 && modes[newLimit - 1].getEnergy() < threshold)
+        --newLimit;
+
+    if (newLimit < active)
+        setModeLimit(newLimit);
+
+    return modeLimit;
+}
+
 void ModalResonatorBank::initializeModes()
 {
     modes.clear();
@@ -377,6 +463,8 @@ void ModalResonatorBank::initializeModes()
     // Prepare all modes
     for (auto& mode : modes)
         mode.prepare(sr);
+
+    modeLimit = static_cast<int>(modes.size());
 }
 
 void ModalResonatorBank::initializeGongModes()
@@ -538,10 +626,7 @@ float ModalResonatorBank::calculateDecay(float baseDecay, float frequency, float
 // StrikeExciter Implementation
 //==============================================================================
 
-StrikeExciter::StrikeExciter()
-    : rng(42)  // Fixed seed for determinism
-{
-}
+StrikeExciter::StrikeExciter() = default;
 
 void StrikeExciter::prepare(double sampleRate)
 {
@@ -551,75 +636,55 @@ void StrikeExciter::prepare(double sampleRate)
 
 void StrikeExciter::reset()
 {
-    clickPhase = 0.0f;
-    clickDecay = 0.0f;
+    burstLength = 0;
+    burstPosition = 0;
 }
 
-float StrikeExciter::processSample(float velocity, float force, float contactArea, float roughness)
+void StrikeExciter::setSharedTables(const GiantSharedTables* tables)
 {
-    float output = 0.0f;
+    sharedTables = tables;
+}
 
-    // Generate click transient
-    if (clickDecay > 0.001f)
-    {
-        output += generateClick() * params.clickAmount;
-        clickDecay *= 0.95f;
-    }
+void StrikeExciter::trigger(float velocity, float force, float contactArea, float roughness)
+{
+    burstPosition = 0;
+    burstLength = 0;
 
-    // Generate mallet noise
-    if (force > 0.0f)
-    {
-        output += generateNoise(roughness) * params.noiseAmount * force;
-    }
+    if (sharedTables == nullptr)
+        return;
 
-    // Apply brightness filter (simple highpass/lowpass balance)
-    float brightness = params.brightness;
-    float brightComponent = output * brightness;
-    float darkComponent = output * (1.0f - brightness) * 0.5f;
-    output = brightComponent + darkComponent;
+    // OPTIMIZED: The mallet transient is a precomputed band-limited burst;
+    // a strike only picks its layers and gains (see GiantSharedTables)
+    const float vel = std::clamp(velocity, 0.0f, 1.0f);
+    const float hardness = std::clamp(params.brightness * (1.25f - 0.5f * contactArea), 0.0f, 1.0f);
 
-    return output * velocity;
-}
+    const int malletType = static_cast<int>(params.malletType);
+    const int hardnessLayer = static_cast<int>(
+        hardness * (GiantSharedTables::numMalletHardnessLayers - 1) + 0.5f);
+    const int velocityLayer = static_cast<int>(
+        vel * (GiantSharedTables::numMalletVelocityLayers - 1) + 0.5f);
 
-void StrikeExciter::setParameters(const Parameters& p)
-{
-    params = p;
+    contactBurst = sharedTables->getMalletContact(malletType, hardnessLayer, velocityLayer);
+    noiseBurst = sharedTables->getMalletNoise(malletType, hardnessLayer);
+    contactGain = params.clickAmount * velocity;
+    noiseGain = params.noiseAmount * force * (0.5f + roughness * 0.5f) * velocity;
+    burstLength = sharedTables->getMalletBurstLength();
 }
 
-float StrikeExciter::generateClick()
+float StrikeExciter::processSample()
 {
-    // Sharp exponential click
-    clickPhase += 0.3f;
-    float click = std::exp(-clickPhase * 3.0f) * SchillingerEcosystem::DSP::fastSineLookup(clickPhase * 20.0f);
-    return click * clickDecay;
+    if (burstPosition >= burstLength)
+        return 0.0f;
+
+    const float output = contactBurst[burstPosition] * contactGain
+                       + noiseBurst[burstPosition] * noiseGain;
+    ++burstPosition;
+    return output;
 }
 
-float StrikeExciter::generateNoise(float roughness)
+void StrikeExciter::setParameters(const Parameters& p)
 {
-    // Filtered noise based on mallet type
-    float noise = rng.next();
-
-    // Mallet type affects noise color
-    switch (params.malletType)
-    {
-        case MalletType::Soft:
-            // More low frequency noise
-            noise *= 0.3f;
-            break;
-        case MalletType::Medium:
-            noise *= 0.5f;
-            break;
-        case MalletType::Hard:
-            // More high frequency noise
-            noise *= 0.7f;
-            break;
-        case MalletType::Metal:
-            // Very bright, harsh noise
-            noise *= 1.0f;
-            break;
-    }
-
-    return noise * (0.5f + roughness * 0.5f);
+    params = p;
 }
 
 //==============================================================================
@@ -784,15 +849,22 @@ void GiantPercussionVoice::reset()
 }
 
 void GiantPercussionVoice::trigger(int note, float vel, const GiantGestureParameters& gesture,
-                                   const GiantScaleParameters& scaleParams)
+                                   const GiantScaleParameters& scaleParams,
+                                   const GiantModeDetail::Context& detail)
 {
     midiNote = note;
     velocity = vel;
     this->gesture = gesture;
     this->scale = scaleParams;
 
-    // Trigger exciter
-    float excitation = exciter.processSample(vel, gesture.force, gesture.contactArea, gesture.roughness);
+    // Start the mallet burst; it drives the modes over the next few ms
+    exciter.trigger(vel, gesture.force, gesture.contactArea, gesture.roughness);
+
+    // Level of detail: soft, distant or crowded hits render fewer modes
+    detailModes = modesForHit(detail);
+    detailCountdown = GiantModeDetail::tailCheckInterval;
+    trimTail = !detail.fullDetail;
+    resonator.setModeLimit(detailModes);
 
     // Strike resonator
     resonator.strike(vel, gesture.force, gesture.contactArea);
@@ -800,13 +872,44 @@ void GiantPercussionVoice::trigger(int note, float vel, const GiantGestureParame
     active = true;
 }
 
+void GiantPercussionVoice::reExcite(float vel, const GiantGestureParameters& gesture,
+                                    const GiantModeDetail::Context& detail)
+{
+    velocity = std::max(velocity, vel);
+    this->gesture = gesture;
+
+    exciter.trigger(vel, gesture.force, gesture.contactArea, gesture.roughness);
+
+    // Never lose detail the ringing tail still has; a louder hit adds modes
+    detailModes = std::max(resonator.getModeLimit(), modesForHit(detail));
+    detailCountdown = GiantModeDetail::tailCheckInterval;
+    trimTail = !detail.fullDetail;
+    resonator.setModeLimit(detailModes);
+    resonator.restrike(vel, gesture.force, gesture.contactArea);
+}
+
+int GiantPercussionVoice::modesForHit(const GiantModeDetail::Context& detail) const
+{
+    const float cutoff = GiantModeDetail::audibleBandwidth(detail.airLoss, detail.distanceMeters);
+    return GiantModeDetail::modesAtTrigger(resonator.getParameters().numModes,
+                                           resonator.countModesBelow(cutoff), 4, detail);
+}
+
 float GiantPercussionVoice::processSample(float& left, float& right)
 {
     if (!active)
         return 0.0f;
 
-    // Process resonator
-    float mono = resonator.processSample();
+    // Tail level of detail: high modes that fall under the masking threshold stop rendering
+    if (trimTail && --detailCountdown <= 0)
+    {
+        detailCountdown = GiantModeDetail::tailCheckInterval;
+        detailModes = resonator.trimMaskedModes(GiantModeDetail::maskingRatio);
+    }
+
+    // Process resonator, driven by the mallet burst while it lasts
+    const float excitation = exciter.isActive() ? exciter.processSample() : 0.0f;
+    float mono = resonator.processSample(excitation);
 
     // Apply dispersion
     mono = dispersion.processSample(mono, 0.3f);
@@ -839,30 +942,96 @@ void GiantPercussionVoiceManager::prepare(double sampleRate, int maxVoices)
     currentSampleRate = sampleRate;
     voices.clear();
 
+    // Voices are cheap to construct; mode banks are only built for the eager
+    // pool here; the rest via warmUp()
     for (int i = 0; i < maxVoices; ++i)
     {
         auto voice = std::make_unique<GiantPercussionVoice>();
-        voice->prepare(sampleRate);
+        if (i < eagerVoices)
+        {
+            prepareVoice(*voice);
+            adoptVoice(*voice);
+        }
         voices.push_back(std::move(voice));
     }
 }
 
+void GiantPercussionVoiceManager::prepareVoice(GiantPercussionVoice& voice)
+{
+    // Allocation only: settings the audio thread may be changing are
+    // replayed when it adopts the voice
+    voice.exciter.setSharedTables(sharedTables);
+    voice.prepare(currentSampleRate);
+    voice.ready.store(true, std::memory_order_release);
+}
+
+void GiantPercussionVoiceManager::adoptVoice(GiantPercussionVoice& voice)
+{
+    voice.resonator.setParameters(resonatorParams);
+    voice.exciter.setParameters(exciterParams);
+    voice.radiation.setParameters(radiationParams);
+    voice.prepared = true;
+}
+
+int GiantPercussionVoiceManager::warmUp(int maxVoices)
+{
+    int cold = 0;
+    for (auto& voice : voices)
+    {
+        if (voice->ready.load(std::memory_order_acquire))
+            continue;
+
+        if (maxVoices > 0)
+        {
+            prepareVoice(*voice);
+            --maxVoices;
+        }
+        else
+        {
+            ++cold;
+        }
+    }
+    return cold;
+}
+
+int GiantPercussionVoiceManager::getPreparedVoiceCount() const
+{
+    int count = 0;
+    for (const auto& voice : voices)
+        if (voice->ready.load(std::memory_order_acquire))
+            ++count;
+    return count;
+}
+
 void GiantPercussionVoiceManager::reset()
 {
     for (auto& voice : voices)
-        voice->reset();
+        if (voice->prepared)
+            voice->reset();
 }
 
 GiantPercussionVoice* GiantPercussionVoiceManager::findFreeVoice()
 {
-    // First try to find inactive voice
+    // First try to find inactive, already prepared voice
     for (auto& voice : voices)
     {
-        if (!voice->isActive())
+        if (!voice->isActive() && voice->prepared)
+            return voice.get();
+    }
+
+    // Then one the warm-up has published since
+    for (auto& voice : voices)
+    {
+        if (!voice->prepared && voice->ready.load(std::memory_order_acquire))
+        {
+            adoptVoice(*voice);
             return voice.get();
+        }
     }
 
     // If all active, steal oldest (first in list)
+    // Cold voices are never prepared here (that allocates); the warm-up
+    // brings them in off the audio thread. voices[0] is in the eager pool.
     return voices[0].get();
 }
 
@@ -880,26 +1049,54 @@ GiantPercussionVoice* GiantPercussionVoiceManager::findVoiceForNote(int note)
 void GiantPercussionVoiceManager::handleNoteOn(int note, float velocity, const GiantGestureParameters& gesture,
                                                 const GiantScaleParameters& scale)
 {
+    GiantModeDetail::Context detail;
+    detail.velocity = velocity;
+    detail.airLoss = scale.airLoss;
+    detail.distanceMeters = listenerDistance;
+    detail.activeVoices = getActiveVoiceCount();
+    detail.fullDetail = fullDetail;
+
+    // Rolls and tremolos: strike the object that is still ringing rather
+    // than stacking another full mode bank on the same pitch
+    if (reExciteEnabled)
+    {
+        if (GiantPercussionVoice* ringing = findVoiceForNote(note))
+        {
+            ringing->reExcite(velocity, gesture, detail);
+
+            if (modulation != nullptr)
+                modulation->noteOn(indexOf(ringing), note, velocity);
+            return;
+        }
+    }
+
     GiantPercussionVoice* voice = findFreeVoice();
     if (voice)
-        voice->trigger(note, velocity, gesture, scale);
+    {
+        voice->trigger(note, velocity, gesture, scale, detail);
+
+        if (modulation != nullptr)
+            modulation->noteOn(indexOf(voice), note, velocity);
+    }
 }
 
 void GiantPercussionVoiceManager::handleNoteOff(int note)
 {
-    GiantPercussionVoice* voice = findVoiceForNote(note);
-    if (voice)
+    // Percussion naturally decays, so note off doesn't stop the voice; it
+    // frees itself once its modal energy has died away (processSample).
+    // Only the matrix envelope releases.
+    if (modulation != nullptr)
     {
-        // Percussion naturally decays, so note off doesn't stop immediately
-        // Just mark for eventual cleanup
-        voice->active = false;
+        if (GiantPercussionVoice* voice = findVoiceForNote(note))
+            modulation->noteOff(indexOf(voice));
     }
 }
 
 void GiantPercussionVoiceManager::allNotesOff()
 {
     for (auto& voice : voices)
-        voice->reset();
+        if (voice->prepared)
+            voice->reset();
 }
 
 void GiantPercussionVoiceManager::processSample(float& left, float& right)
@@ -907,18 +1104,36 @@ void GiantPercussionVoiceManager::processSample(float& left, float& right)
     left = 0.0f;
     right = 0.0f;
 
-    for (auto& voice : voices)
+    const bool modulated = (modulation != nullptr && modulation->isRunning());
+    if (modulated)
+        modulation->advance();
+
+    for (size_t v = 0; v < voices.size(); ++v)
     {
-        if (voice->isActive())
+        if (voices[v]->isActive())
         {
             float voiceLeft, voiceRight;
-            voice->processSample(voiceLeft, voiceRight);
-            left += voiceLeft;
-            right += voiceRight;
+            voices[v]->processSample(voiceLeft, voiceRight);
+
+            const float gain = modulated
+                             ? std::max(0.0f, 1.0f + modulation->getValue(static_cast<int>(v), GiantModDestination::Level))
+                             : 1.0f;
+            left += voiceLeft * gain;
+            right += voiceRight * gain;
         }
     }
 }
 
+int GiantPercussionVoiceManager::indexOf(const GiantPercussionVoice* voice) const
+{
+    for (size_t v = 0; v < voices.size(); ++v)
+    {
+        if (voices[v].get() == voice)
+            return static_cast<int>(v);
+    }
+    return -1;
+}
+
 int GiantPercussionVoiceManager::getActiveVoiceCount() const
 {
     int count = 0;
@@ -928,22 +1143,107 @@ int GiantPercussionVoiceManager::getActiveVoiceCount() const
     return count;
 }
 
+int GiantPercussionVoiceManager::getVoiceEnergies(float* energies, int maxVoices) const
+{
+    const int count = std::min(maxVoices, static_cast<int>(voices.size()));
+    for (int i = 0; i < count; ++i)
+    {
+        const auto& voice = voices[static_cast<size_t>(i)];
+        energies[i] = voice->isActive() ? voice->resonator.getTotalEnergy() : 0.0f;
+    }
+    return count;
+}
+
 void GiantPercussionVoiceManager::setResonatorParameters(const ModalResonatorBank::Parameters& params)
 {
+    resonatorParams = params;
     for (auto& voice : voices)
-        voice->resonator.setParameters(params);
+        if (voice->prepared)
+            voice->resonator.setParameters(params);
 }
 
 void GiantPercussionVoiceManager::setExciterParameters(const StrikeExciter::Parameters& params)
 {
+    exciterParams = params;
     for (auto& voice : voices)
-        voice->exciter.setParameters(params);
+        if (voice->prepared)
+            voice->exciter.setParameters(params);
+}
+
+void GiantPercussionVoiceManager::setSharedTables(const GiantSharedTables* tables)
+{
+    sharedTables = tables;
 }
 
 void GiantPercussionVoiceManager::setRadiationParameters(const StereoRadiationPattern::Parameters& params)
 {
+    radiationParams = params;
     for (auto& voice : voices)
-        voice->radiation.setParameters(params);
+        if (voice->prepared)
+            voice->radiation.setParameters(params);
+}
+
+void GiantPercussionVoiceManager::applyQuality(const GiantCpuBudget& budget)
+{
+    const auto quality = budget.getQuality();
+
+    // Loudest voice sets the reference for what counts as "quiet"
+    float loudest = 0.0f;
+    int activeCount = 0;
+    for (const auto& voice : voices)
+    {
+        if (voice->isActive())
+        {
+            loudest = std::max(loudest, voice->resonator.getTotalEnergy());
+            ++activeCount;
+        }
+    }
+
+    // Reduced trims only quiet tails; Low/Minimal trim everything but the loudest
+    const float quietThreshold = (quality == GiantCpuBudget::Quality::Reduced) ? 0.25f : 0.9f;
+
+    for (auto& voice : voices)
+    {
+        if (!voice->isActive())
+            continue;
+
+        // The budget trims on top of the voice's own level of detail, never above it
+        const int fullModes = voice->detailModes;
+        const bool quiet = voice->resonator.getTotalEnergy() < loudest * quietThreshold;
+
+        if (quality == GiantCpuBudget::Quality::Full || !quiet)
+            voice->resonator.setModeLimit(fullModes);
+        else
+            voice->resonator.setModeLimit(budget.scaleCount(fullModes, 4));
+    }
+
+    // Polyphony cap: retire the quietest voices first
+    if (quality < GiantCpuBudget::Quality::Low)
+        return;
+
+    const int maxActive = budget.scaleCount(static_cast<int>(voices.size()), 2);
+    while (activeCount > maxActive)
+    {
+        GiantPercussionVoice* quietest = nullptr;
+        float quietestEnergy = 0.0f;
+        for (auto& voice : voices)
+        {
+            if (!voice->isActive())
+                continue;
+            const float energy = voice->resonator.getTotalEnergy();
+            if (quietest == nullptr || energy < quietestEnergy)
+            {
+                quietest = voice.get();
+                quietestEnergy = energy;
+            }
+        }
+
+        if (quietest == nullptr)
+            break;
+
+        quietest->reset();
+        --activeCount;
+    }
 }
 
 //==============================================================================
@@ -952,6 +1252,7 @@ void GiantPercussionVoiceManager::setRadiationParameters(const StereoRadiationPa
 
 AetherGiantPercussionPureDSP::AetherGiantPercussionPureDSP()
 {
+    voiceManager_.setModMatrix(&modMatrix_);
 }
 
 AetherGiantPercussionPureDSP::~AetherGiantPercussionPureDSP()
@@ -963,7 +1264,13 @@ bool AetherGiantPercussionPureDSP::prepare(double sampleRate, int blockSize)
     sampleRate_ = sampleRate;
     blockSize_ = blockSize;
 
+    // Mallet impulse library is shared by every voice and instance at this rate
+    sharedTables_ = GiantSharedTables::acquire(sampleRate);
+    voiceManager_.setSharedTables(sharedTables_.get());
+
     voiceManager_.prepare(sampleRate, maxVoices_);
+    modMatrix_.prepare(sampleRate, maxVoices_);
+    cpuBudget_.prepare(sampleRate, blockSize);
 
     applyParameters();
 
@@ -973,10 +1280,15 @@ bool AetherGiantPercussionPureDSP::prepare(double sampleRate, int blockSize)
 void AetherGiantPercussionPureDSP::reset()
 {
     voiceManager_.reset();
+    modMatrix_.reset();
+    cpuBudget_.reset();
 }
 
 void AetherGiantPercussionPureDSP::process(float** outputs, int numChannels, int numSamples)
 {
+    cpuBudget_.beginBlock();
+    voiceManager_.applyQuality(cpuBudget_);
+
     // Clear buffers
     for (int ch = 0; ch < numChannels; ++ch)
         std::fill(outputs[ch], outputs[ch] + numSamples, 0.0f);
@@ -1007,6 +1319,8 @@ void AetherGiantPercussionPureDSP::process(float** outputs, int numChannels, int
             outputs[0][i] += (left + right) * 0.5f;
         }
     }
+
+    cpuBudget_.endBlock(numSamples);
 }
 
 void AetherGiantPercussionPureDSP::handleEvent(const ScheduledEvent& event)
@@ -1066,11 +1380,14 @@ float AetherGiantPercussionPureDSP::getParameter(const char* paramId) const
     if (id == "massBias") return params_.massBias;
     if (id == "airLoss") return params_.airLoss;
     if (id == "transientSlowing") return params_.transientSlowing;
+    if (id == "distanceMeters") return params_.distanceMeters;
     if (id == "force") return params_.force;
     if (id == "speed") return params_.speed;
     if (id == "contactArea") return params_.contactArea;
     if (id == "roughness") return params_.roughness;
     if (id == "masterVolume") return params_.masterVolume;
+    if (id == "reExcite") return params_.reExcite;
+    if (id == "cpuBudget") return params_.cpuBudget;
 
     return 0.0f;
 }
@@ -1097,11 +1414,14 @@ void AetherGiantPercussionPureDSP::setParameter(const char* paramId, float value
     else if (id == "massBias") params_.massBias = value;
     else if (id == "airLoss") params_.airLoss = value;
     else if (id == "transientSlowing") params_.transientSlowing = value;
+    else if (id == "distanceMeters") params_.distanceMeters = value;
     else if (id == "force") params_.force = value;
     else if (id == "speed") params_.speed = value;
     else if (id == "contactArea") params_.contactArea = value;
     else if (id == "roughness") params_.roughness = value;
     else if (id == "masterVolume") params_.masterVolume = value;
+    else if (id == "reExcite") params_.reExcite = value;
+    else if (id == "cpuBudget") params_.cpuBudget = value;
 
     applyParameters();
 }
@@ -1128,11 +1448,13 @@ bool AetherGiantPercussionPureDSP::savePreset(char* jsonBuffer, int jsonBufferSi
     writeJsonParameter("massBias", params_.massBias, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("airLoss", params_.airLoss, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("transientSlowing", params_.transientSlowing, jsonBuffer, offset, jsonBufferSize);
+    writeJsonParameter("distanceMeters", params_.distanceMeters, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("force", params_.force, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("speed", params_.speed, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("contactArea", params_.contactArea, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("roughness", params_.roughness, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("masterVolume", params_.masterVolume, jsonBuffer, offset, jsonBufferSize);
+    writeJsonParameter("reExcite", params_.reExcite, jsonBuffer, offset, jsonBufferSize);
 
     return (offset < jsonBufferSize);
 }
@@ -1177,6 +1499,8 @@ bool AetherGiantPercussionPureDSP::loadPreset(const char* jsonData)
         params_.airLoss = static_cast<float>(value);
     if (parseJsonParameter(jsonData, "transientSlowing", value))
         params_.transientSlowing = static_cast<float>(value);
+    if (parseJsonParameter(jsonData, "distanceMeters", value))
+        params_.distanceMeters = static_cast<float>(value);
     if (parseJsonParameter(jsonData, "force", value))
         params_.force = static_cast<float>(value);
     if (parseJsonParameter(jsonData, "speed", value))
@@ -1187,11 +1511,20 @@ bool AetherGiantPercussionPureDSP::loadPreset(const char* jsonData)
         params_.roughness = static_cast<float>(value);
     if (parseJsonParameter(jsonData, "masterVolume", value))
         params_.masterVolume = static_cast<float>(value);
+    if (parseJsonParameter(jsonData, "reExcite", value))
+        params_.reExcite = static_cast<float>(value);
 
     applyParameters();
     return true;
 }
 
+void AetherGiantPercussionPureDSP::setRenderProfile(GiantRenderProfile profile)
+{
+    const bool offline = (profile == GiantRenderProfile::Offline);
+    cpuBudget_.setEnabled(!offline);
+    voiceManager_.setFullDetail(offline);
+}
+
 int AetherGiantPercussionPureDSP::getActiveVoiceCount() const
 {
     return voiceManager_.getActiveVoiceCount();
@@ -1227,6 +1560,10 @@ void AetherGiantPercussionPureDSP::applyParameters()
     radiationParams.rotation = 0.0f;
 
     voiceManager_.setRadiationParameters(radiationParams);
+    voiceManager_.setReExcite(params_.reExcite >= 0.5f);
+    voiceManager_.setListenerDistance(std::clamp(params_.distanceMeters, 1.0f, 100.0f));
+
+    cpuBudget_.setBudget(params_.cpuBudget);
 }
 
 float AetherGiantPercussionPureDSP::calculateFrequency(int midiNote) const
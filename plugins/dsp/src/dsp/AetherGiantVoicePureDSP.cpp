@@ -18,6 +18,7 @@
 */
 
 #include "dsp/AetherGiantVoiceDSP.h"
+#include "dsp/GiantSharedTables.h"
 #include "../../../../include/dsp/LookupTables.h"
 #include "../../../../include/dsp/FastRNG.h"
 #include <cstring>
@@ -203,52 +204,13 @@ static inline float lerp(float a, float b, float t)
     return a + t * (b - a);
 }
 
-static inline float midiToFrequency(int midiNote)
-{
-    // Use LookupTables for MIDI to frequency conversion
-    return SchillingerEcosystem::DSP::LookupTables::getInstance().midiToFreq(static_cast<float>(midiNote));
-}
 
 //==============================================================================
 // Formant Lookup Tables
 //==============================================================================
 
-/**
- * Vowel formant definitions (based on speech synthesis research)
- * Frequencies in Hz for adult male, female, and giant-scaled voices
- */
-struct VowelFormants
-{
-    const char* name;
-    float f1, f2, f3, f4;  // Formant frequencies
-    float b1, b2, b3, b4;  // Formant bandwidths (Hz)
-};
-
-// Standard vowel formants (adult male reference)
-static const VowelFormants standardVowelTable[] =
-{
-    // Vowel     F1     F2      F3      F4     B1     B2     B3     B4
-    { "Ah",     730,   1090,   2440,   3400,  80,    90,    120,   130 },
-    { "Eh",     530,   1840,   2480,   3320,  70,    100,   110,   120 },
-    { "Ee",     270,   2290,   3010,   3340,  60,    90,    100,   120 },
-    { "Oh",     570,   840,    2410,   3370,  80,    80,    110,   130 },
-    { "Oo",     300,   870,    2240,   3370,  70,    80,    100,   120 },
-    { "Uh",     640,   1190,   2390,   3370,  70,    90,    110,   130 },
-    { "Ih",     390,   2300,   2980,   3360,  60,    90,    100,   120 }
-};
-
-// Giant-scaled vowel formants (lower frequencies, wider bandwidths)
-static const VowelFormants giantVowelTable[] =
-{
-    // Vowel     F1     F2      F3      F4     B1     B2     B3     B4
-    { "Ah",     440,   650,    1460,   2040,  120,   135,   180,   195 },
-    { "Eh",     320,   1100,   1490,   1990,  105,   150,   165,   180 },
-    { "Ee",     160,   1370,   1810,   2000,  90,    135,   150,   180 },
-    { "Oh",     340,   500,    1450,   2020,  120,   120,   165,   195 },
-    { "Oo",     180,   520,    1340,   2020,  105,   120,   150,   180 },
-    { "Uh",     380,   710,    1430,   2020,  105,   135,   165,   195 },
-    { "Ih",     230,   1380,   1790,   2020,  90,    135,   150,   180 }
-};
+// Vowel formant tables live in GiantSharedTables (one copy per process)
+using VowelFormants = GiantSharedTables::VowelFormants;
 
 /**
  * Calculate frequency-dependent Q factor for formant filters
@@ -284,11 +246,9 @@ static inline float bandwidthHzToOctaves(float bandwidthHz, float centerFreq)
  */
 static inline VowelFormants getVowelFormants(int vowelIndex, float scale = 0.6f)
 {
-    vowelIndex = clamp(vowelIndex, 0, 6);
-
     // Interpolate between standard and giant formants based on scale
-    const VowelFormants& standard = standardVowelTable[vowelIndex];
-    const VowelFormants& giant = giantVowelTable[vowelIndex];
+    const VowelFormants& standard = GiantSharedTables::getStandardVowel(vowelIndex);
+    const VowelFormants& giant = GiantSharedTables::getGiantVowel(vowelIndex);
 
     VowelFormants result;
     float t = (1.0f - scale) / 0.4f;  // Map scale to interpolation factor
@@ -785,19 +745,22 @@ float FormantStack::processSample(float input)
         updateFormantFrequencies();
     }
 
+    // Upper formants are dropped first under CPU pressure
+    const size_t activeFormants = std::min(formants.size(), static_cast<size_t>(formantLimit));
+
     // Process through formant filters using SIMD when available
 #if DSP_SIMD_NEON_AVAILABLE
-    return SIMD::processFormantsNEON(input, formants.data(), formants.size());
+    return SIMD::processFormantsNEON(input, formants.data(), activeFormants);
 #elif DSP_SIMD_AVX_AVAILABLE
-    return SIMD::processFormantsAVX(input, formants.data(), formants.size());
+    return SIMD::processFormantsAVX(input, formants.data(), activeFormants);
 #elif DSP_SIMD_SSE_AVAILABLE
-    return SIMD::processFormantsSSE(input, formants.data(), formants.size());
+    return SIMD::processFormantsSSE(input, formants.data(), activeFormants);
 #else
     // Scalar fallback - process through formant filters in series
     float output = input;
-    for (auto& formant : formants)
+    for (size_t i = 0; i < activeFormants; ++i)
     {
-        output = formant.processSample(output);
+        output = formants[i].processSample(output);
     }
     return output;
 #endif
@@ -806,6 +769,7 @@ float FormantStack::processSample(float input)
 void FormantStack::setParameters(const Parameters& p)
 {
     params = p;
+    useFrameBandwidths = false;
 
     if (p.vowelShape != VowelShape::Custom)
     {
@@ -845,9 +809,45 @@ void FormantStack::setVowelShape(VowelShape shape, float openness)
 {
     params.vowelShape = shape;
     params.openness = openness;
+    useFrameBandwidths = false;
     initializeVowel(shape, openness);
 }
 
+void FormantStack::setFormantFrame(const float* frequencies, const float* bandwidths, int count)
+{
+    // Same mapping as the vowel tables: giantScale 1.0 = human, 0.6 = giant
+    // (formants x0.6, bandwidths x1.5)
+    const float frequencyScale = params.giantScale;
+    const float bandwidthScale = 1.0f + 0.5f * (1.0f - params.giantScale) / 0.4f;
+
+    float* bases[] = { &baseF1, &baseF2, &baseF3, &baseF4 };
+    const int frameFormants = std::min(count, static_cast<int>(frameBandwidths.size()));
+    for (int i = 0; i < frameFormants; ++i)
+    {
+        *bases[i] = frequencies[i] * frequencyScale;
+        frameBandwidths[static_cast<size_t>(i)] = bandwidths[i] * bandwidthScale;
+    }
+
+    useFrameBandwidths = true;
+    updateFormantFrequencies();
+}
+
+void FormantStack::setFormantLimit(int limit)
+{
+    if (formants.empty())
+        return;
+
+    const int newLimit = std::clamp(limit, 1, static_cast<int>(formants.size()));
+
+    // Clear dropped formants so they restart cleanly when restored
+    for (int i = newLimit; i < formantLimit && i < static_cast<int>(formants.size()); ++i)
+    {
+        formants[i].reset();
+    }
+
+    formantLimit = newLimit;
+}
+
 int FormantStack::getVowelIndex(VowelShape shape) const
 {
     switch (shape)
@@ -888,10 +888,19 @@ void FormantStack::initializeVowel(VowelShape shape, float openness)
 
 void FormantStack::updateFormantFrequencies()
 {
-    // Get current vowel bandwidths
-    int vowelIdx = getVowelIndex(params.vowelShape);
-    float scale = params.giantScale;
-    VowelFormants vowel = getVowelFormants(vowelIdx, scale);
+    // Get current vowel bandwidths (or the analyzed performance's)
+    VowelFormants vowel {};
+    if (useFrameBandwidths)
+    {
+        vowel.b1 = frameBandwidths[0];
+        vowel.b2 = frameBandwidths[1];
+        vowel.b3 = frameBandwidths[2];
+        vowel.b4 = frameBandwidths[3];
+    }
+    else
+    {
+        vowel = getVowelFormants(getVowelIndex(params.vowelShape), params.giantScale);
+    }
 
     if (formants.size() >= 1)
     {
@@ -1128,8 +1137,9 @@ void ChestResonator::ChestMode::reset()
 // GiantVoice Implementation
 //==============================================================================
 
-void GiantVoice::prepare(double sampleRate)
+void GiantVoice::prepare(double newSampleRate)
 {
+    sampleRate = newSampleRate;
     breath.prepare(sampleRate);
     vocalFolds.prepare(sampleRate);
     formants.prepare(sampleRate);
@@ -1148,9 +1158,12 @@ void GiantVoice::reset()
     midiNote = -1;
     velocity = 0.0f;
     active = false;
+    setModulation(0.0f, 0.0f, 0.0f);
+    appliedPitchRatio = modPitchRatio;
 }
 
-void GiantVoice::trigger(int note, float vel, const GiantVoiceGesture& gestureParams,
+void GiantVoice::trigger(int note, float noteFrequency, float vel,
+                        const GiantVoiceGesture& gestureParams,
                         const GiantScaleParameters& scaleParams)
 {
     midiNote = note;
@@ -1160,11 +1173,12 @@ void GiantVoice::trigger(int note, float vel, const GiantVoiceGesture& gesturePa
     active = true;
 
     // Calculate fundamental frequency (scale-aware)
-    float baseFreq = midiToFrequency(note);
+    pitch.set(noteFrequency);
 
     // Scale affects frequency (larger = lower)
     float scaleMultiplier = 1.0f / (1.0f + scale.scaleMeters * 0.1f);
-    float fundamental = baseFreq * scaleMultiplier;
+    fundamental = noteFrequency * scaleMultiplier;
+    appliedPitchRatio = 1.0f;       // Modulation is reapplied from the next sample
 
     // Set vocal fold frequency
     VocalFoldOscillator::Parameters vocalParams;
@@ -1207,6 +1221,39 @@ void GiantVoice::trigger(int note, float vel, const GiantVoiceGesture& gesturePa
     chestParams.chestResonance = 0.7f;
     chestParams.bodySize = scale.scaleMeters / 20.0f;
     chest.setParameters(chestParams);
+
+    // Analyzed performance starts over with each note
+    trajectoryTime = 0.0;
+    trajectoryCountdown = 0;
+    trajectoryLevel = 1.0f;
+    trajectoryLevelStep = 0.0f;
+    if (trajectory != nullptr)
+    {
+        trajectoryLevel = trajectory->getFrame(0.0).level;
+        updateTrajectory();
+    }
+}
+
+void GiantVoice::updateTrajectory()
+{
+    const auto frame = trajectory->getFrame(trajectoryTime);
+    trajectoryTime += controlInterval / sampleRate;
+    trajectoryCountdown = controlInterval;
+
+    formants.setFormantFrame(frame.formantHz, frame.bandwidthHz, GiantFormantTrajectory::numFormants);
+
+    // Pitch contour relative to the phrase's median, transposed to the note;
+    // unvoiced frames keep the last pitch
+    if (frame.f0 > 0.0f && trajectory->getReferenceF0() > 0.0f)
+        vocalFolds.setFrequency(fundamental * frame.f0 / trajectory->getReferenceF0() * appliedPitchRatio);
+
+    // Level ramps over the interval so control-rate steps don't zipper
+    trajectoryLevelStep = (frame.level - trajectoryLevel) / controlInterval;
+}
+
+void GiantVoice::retune(float noteFrequency)
+{
+    pitch.glideTo(noteFrequency, sampleRate);
 }
 
 void GiantVoice::release(bool damping)
@@ -1214,6 +1261,18 @@ void GiantVoice::release(bool damping)
     breath.release(damping);
 }
 
+void GiantVoice::setModulation(float level, float semitones, float breathAmount)
+{
+    modGain = std::max(0.0f, 1.0f + level);
+    modPressure = std::max(0.0f, 1.0f + breathAmount);
+
+    if (semitones != modSemitones)
+    {
+        modSemitones = semitones;
+        modPitchRatio = std::exp2(semitones * (1.0f / 12.0f));
+    }
+}
+
 float GiantVoice::processSample()
 {
     if (!active && !breath.isActive())
@@ -1231,6 +1290,34 @@ float GiantVoice::processSample()
         return 0.0f;
     }
 
+    if (pitch.isGliding())
+    {
+        // Retune glide; a phrase's pitch contour rides on top of it
+        float previous = fundamental;
+        fundamental = pitch.advance() * (1.0f / (1.0f + scale.scaleMeters * 0.1f));
+        vocalFolds.setFrequency(trajectory != nullptr
+                                    ? vocalFolds.getParameters().frequency * (fundamental / previous)
+                                    : fundamental * appliedPitchRatio);
+    }
+
+    // Matrix pitch rides on the note (and phrase) pitch
+    if (modPitchRatio != appliedPitchRatio)
+    {
+        vocalFolds.setFrequency(vocalFolds.getParameters().frequency * (modPitchRatio / appliedPitchRatio));
+        appliedPitchRatio = modPitchRatio;
+    }
+
+    // Matrix breath scales the excitation; the breath envelope itself runs on
+    pressure *= modPressure;
+
+    if (trajectory != nullptr)
+    {
+        if (trajectoryCountdown == 0)
+            updateTrajectory();
+        --trajectoryCountdown;
+        trajectoryLevel += trajectoryLevelStep;
+    }
+
     // Generate glottal source
     float glottal = vocalFolds.processSample(pressure);
 
@@ -1256,8 +1343,10 @@ float GiantVoice::processSample()
     if (std::isnan(output) || std::isinf(output))
         return 0.0f;
 
-    // Scale by velocity
-    output *= velocity;
+    // Scale by velocity (and the performance's level when following one)
+    output *= velocity * modGain;
+    if (trajectory != nullptr)
+        output *= trajectoryLevel;
 
     // Safety limit
     output = clamp(output, -1.0f, 1.0f);
@@ -1273,7 +1362,9 @@ float GiantVoice::processSample()
 
 bool GiantVoice::isActive() const
 {
-    return active || breath.isActive();
+    // A voice the audio thread has not adopted yet may be mid warm-up: its
+    // breath generator is not ours to read
+    return prepared && (active || breath.isActive());
 }
 
 //==============================================================================
@@ -1289,31 +1380,107 @@ void GiantVoiceManager::prepare(double sampleRate, int maxVoices)
     currentSampleRate = sampleRate;
     voices.clear();
 
+    // Voices are cheap to construct; only the eager pool is prepared here,
+    // the rest via warmUp()
     for (int i = 0; i < maxVoices; ++i)
     {
         auto voice = std::make_unique<GiantVoice>();
-        voice->prepare(sampleRate);
+        if (i < eagerVoices)
+        {
+            prepareVoice(*voice);
+            adoptVoice(*voice);
+        }
         voices.push_back(std::move(voice));
     }
 }
 
+void GiantVoiceManager::prepareVoice(GiantVoice& voice)
+{
+    // Allocation only: settings the audio thread may be changing are
+    // replayed when it adopts the voice
+    voice.prepare(currentSampleRate);
+    voice.ready.store(true, std::memory_order_release);
+}
+
+void GiantVoiceManager::adoptVoice(GiantVoice& voice)
+{
+    // Only replay settings that were actually pushed, so a cold voice ends up
+    // in exactly the state an eagerly prepared one would have
+    if (hasFormantParams)
+        voice.formants.setParameters(formantParams);
+    if (hasSubharmonicParams)
+        voice.subharmonics.setParameters(subharmonicParams);
+    if (hasChestParams)
+        voice.chest.setParameters(chestParams);
+
+    voice.controlInterval = controlInterval;
+    voice.trajectory = trajectory;
+    voice.prepared = true;
+}
+
+int GiantVoiceManager::warmUp(int maxVoices)
+{
+    int cold = 0;
+    for (auto& voice : voices)
+    {
+        if (voice->ready.load(std::memory_order_acquire))
+            continue;
+
+        if (maxVoices > 0)
+        {
+            prepareVoice(*voice);
+            --maxVoices;
+        }
+        else
+        {
+            ++cold;
+        }
+    }
+    return cold;
+}
+
+int GiantVoiceManager::getPreparedVoiceCount() const
+{
+    int count = 0;
+    for (const auto& voice : voices)
+    {
+        if (voice->ready.load(std::memory_order_acquire))
+            count++;
+    }
+    return count;
+}
+
 void GiantVoiceManager::reset()
 {
     for (auto& voice : voices)
     {
-        voice->reset();
+        if (voice->prepared)
+            voice->reset();
     }
+    outputClip.reset();
 }
 
 GiantVoice* GiantVoiceManager::findFreeVoice()
 {
     for (auto& voice : voices)
     {
-        if (!voice->isActive())
+        if (!voice->isActive() && voice->prepared)
+            return voice.get();
+    }
+
+    // Then one the warm-up has published since
+    for (auto& voice : voices)
+    {
+        if (!voice->prepared && voice->ready.load(std::memory_order_acquire))
+        {
+            adoptVoice(*voice);
             return voice.get();
+        }
     }
 
     // Voice stealing: find oldest voice
+    // Cold voices are never prepared here (that allocates); the warm-up
+    // brings them in off the audio thread. voices[0] is in the eager pool.
     return voices[0].get();
 }
 
@@ -1334,7 +1501,11 @@ void GiantVoiceManager::handleNoteOn(int note, float velocity,
     GiantVoice* voice = findFreeVoice();
     if (voice)
     {
-        voice->trigger(note, velocity, gesture, scale);
+        voice->trajectory = trajectory;
+        voice->trigger(note, tuning->getFrequency(note), velocity, gesture, scale);
+
+        if (modulation != nullptr)
+            modulation->noteOn(indexOf(voice), note, velocity);
     }
 }
 
@@ -1344,38 +1515,86 @@ void GiantVoiceManager::handleNoteOff(int note, bool damping)
     if (voice)
     {
         voice->release(damping);
+
+        if (modulation != nullptr)
+            modulation->noteOff(indexOf(voice));
     }
 }
 
 void GiantVoiceManager::allNotesOff()
 {
-    for (auto& voice : voices)
+    for (size_t v = 0; v < voices.size(); ++v)
     {
-        voice->release(true);
+        if (!voices[v]->prepared)
+            continue;
+
+        voices[v]->release(true);
+
+        if (modulation != nullptr)
+            modulation->noteOff(static_cast<int>(v));
     }
 }
 
-float GiantVoiceManager::processSample()
+float GiantVoiceManager::processSample(float* voiceOutputs)
 {
     float output = 0.0f;
 
-    for (auto& voice : voices)
+    const bool modulated = (modulation != nullptr && modulation->isRunning());
+    if (modulated)
+        modulation->advance();
+
+    for (size_t v = 0; v < voices.size(); ++v)
     {
-        if (voice->isActive())
+        if (!voices[v]->prepared)
+        {
+            if (voiceOutputs != nullptr)
+                voiceOutputs[v] = 0.0f;
+            continue;
+        }
+
+        if (modulated)
         {
-            output += voice->processSample();
+            const int index = static_cast<int>(v);
+            voices[v]->setModulation(modulation->getValue(index, GiantModDestination::Level),
+                                     modulation->getValue(index, GiantModDestination::Pitch),
+                                     modulation->getValue(index, GiantModDestination::Breath));
         }
+
+        const float voiceOutput = voices[v]->isActive() ? voices[v]->processSample() : 0.0f;
+        if (voiceOutputs != nullptr)
+            voiceOutputs[v] = voiceOutput;
+        output += voiceOutput;
     }
 
-    // Soft clip to prevent distortion
-    if (output > 1.0f)
-        output = 1.0f - std::exp(-output + 1.0f);
-    else if (output < -1.0f)
-        output = -1.0f + std::exp(output + 1.0f);
+    // Soft clip to prevent distortion (ADAA exponential: continuous at the
+    // knee and bounded to +-1, overs no longer alias)
+    output = outputClip.processSample(output);
+
+    if (voiceOutputs != nullptr)
+        distributeBusSample(voiceOutputs, static_cast<int>(voices.size()), output);
 
     return output;
 }
 
+int GiantVoiceManager::indexOf(const GiantVoice* voice) const
+{
+    for (size_t v = 0; v < voices.size(); ++v)
+    {
+        if (voices[v].get() == voice)
+            return static_cast<int>(v);
+    }
+    return -1;
+}
+
+int GiantVoiceManager::getVoiceNote(int index) const
+{
+    if (index < 0 || index >= static_cast<int>(voices.size()))
+        return -1;
+
+    const auto& voice = voices[static_cast<size_t>(index)];
+    return voice->isActive() ? voice->midiNote : -1;
+}
+
 int GiantVoiceManager::getActiveVoiceCount() const
 {
     int count = 0;
@@ -1387,27 +1606,149 @@ int GiantVoiceManager::getActiveVoiceCount() const
     return count;
 }
 
+int GiantVoiceManager::getVoiceEnergies(float* energies, int maxVoices) const
+{
+    const int count = std::min(maxVoices, static_cast<int>(voices.size()));
+    for (int i = 0; i < count; ++i)
+    {
+        const auto& voice = voices[static_cast<size_t>(i)];
+        energies[i] = voice->isActive() ? voice->breath.getPressure() * voice->velocity : 0.0f;
+    }
+    return count;
+}
+
 void GiantVoiceManager::setFormantParameters(const FormantStack::Parameters& params)
 {
+    formantParams = params;
+    hasFormantParams = true;
     for (auto& voice : voices)
     {
-        voice->formants.setParameters(params);
+        if (voice->prepared)
+            voice->formants.setParameters(params);
     }
 }
 
 void GiantVoiceManager::setSubharmonicParameters(const SubharmonicGenerator::Parameters& params)
 {
+    subharmonicParams = params;
+    hasSubharmonicParams = true;
     for (auto& voice : voices)
     {
-        voice->subharmonics.setParameters(params);
+        if (voice->prepared)
+            voice->subharmonics.setParameters(params);
     }
 }
 
 void GiantVoiceManager::setChestParameters(const ChestResonator::Parameters& params)
 {
+    chestParams = params;
+    hasChestParams = true;
+    for (auto& voice : voices)
+    {
+        if (voice->prepared)
+            voice->chest.setParameters(params);
+    }
+}
+
+void GiantVoiceManager::setTrajectory(const GiantFormantTrajectory* newTrajectory)
+{
+    trajectory = newTrajectory;
+
+    for (auto& voice : voices)
+    {
+        if (voice->prepared)
+            voice->trajectory = trajectory;
+    }
+}
+
+void GiantVoiceManager::setControlInterval(int samples)
+{
+    controlInterval = std::max(1, samples);
+    for (auto& voice : voices)
+    {
+        if (voice->prepared)
+            voice->controlInterval = controlInterval;
+    }
+}
+
+void GiantVoiceManager::setTuningTable(const GiantTuningTable& table)
+{
+    tuning = &table;
+
     for (auto& voice : voices)
     {
-        voice->chest.setParameters(params);
+        if (voice->isActive())
+            voice->retune(tuning->getFrequency(voice->midiNote));
+    }
+}
+
+void GiantVoiceManager::applyQuality(const GiantCpuBudget& budget)
+{
+    const auto quality = budget.getQuality();
+
+    // Voice level ~ breath pressure * velocity
+    auto levelOf = [](const GiantVoice& voice)
+    {
+        return voice.breath.getPressure() * voice.velocity;
+    };
+
+    float loudest = 0.0f;
+    int sustainingCount = 0;
+    for (const auto& voice : voices)
+    {
+        if (voice->isActive())
+        {
+            loudest = std::max(loudest, levelOf(*voice));
+            if (!voice->breath.isReleasing())
+                ++sustainingCount;
+        }
+    }
+
+    // Reduced trims only quiet voices; Low/Minimal trim everything but the loudest
+    const float quietThreshold = (quality == GiantCpuBudget::Quality::Reduced) ? 0.25f : 0.9f;
+
+    for (auto& voice : voices)
+    {
+        if (!voice->isActive())
+            continue;
+
+        const int fullFormants = voice->formants.getFormantCount();
+        const bool quiet = levelOf(*voice) < loudest * quietThreshold;
+
+        // Keep F1/F2 at minimum so vowels stay intelligible
+        if (quality == GiantCpuBudget::Quality::Full || !quiet)
+            voice->formants.setFormantLimit(fullFormants);
+        else
+            voice->formants.setFormantLimit(budget.scaleCount(fullFormants, 2));
+    }
+
+    // Polyphony cap: release the quietest sustaining voices early
+    if (quality < GiantCpuBudget::Quality::Low)
+        return;
+
+    const int maxActive = budget.scaleCount(static_cast<int>(voices.size()), 2);
+    while (sustainingCount > maxActive)
+    {
+        GiantVoice* quietest = nullptr;
+        float quietestLevel = 0.0f;
+        for (auto& voice : voices)
+        {
+            if (!voice->isActive() || voice->breath.isReleasing())
+                continue;
+
+            const float level = levelOf(*voice);
+            if (quietest == nullptr || level < quietestLevel)
+            {
+                quietest = voice.get();
+                quietestLevel = level;
+            }
+        }
+
+        if (quietest == nullptr)
+            break;
+
+        quietest->release(true);
+        --sustainingCount;
     }
 }
 
@@ -1417,6 +1758,7 @@ void GiantVoiceManager::setChestParameters(const ChestResonator::Parameters& par
 
 AetherGiantVoicePureDSP::AetherGiantVoicePureDSP()
 {
+    voiceManager_.setModMatrix(&modMatrix_);
 }
 
 AetherGiantVoicePureDSP::~AetherGiantVoicePureDSP()
@@ -1429,6 +1771,12 @@ bool AetherGiantVoicePureDSP::prepare(double sampleRate, int blockSize)
     blockSize_ = blockSize;
 
     voiceManager_.prepare(sampleRate, maxVoices_);
+    modMatrix_.prepare(sampleRate, maxVoices_);
+    cpuBudget_.prepare(sampleRate, blockSize);
+    cpuBudget_.setBudget(params_.cpuBudget);
+
+    voiceSamples_.assign(static_cast<size_t>(maxVoices_), 0.0f);
+    stemNotes_.assign(static_cast<size_t>(maxVoices_), -1);
 
     // Initialize scale parameters
     currentScale_.scaleMeters = params_.scaleMeters;
@@ -1448,16 +1796,61 @@ bool AetherGiantVoicePureDSP::prepare(double sampleRate, int blockSize)
 void AetherGiantVoicePureDSP::reset()
 {
     voiceManager_.reset();
+    modMatrix_.reset();
+    cpuBudget_.reset();
 }
 
 void AetherGiantVoicePureDSP::process(float** outputs, int numChannels, int numSamples)
 {
-    // Clear output buffers
-    for (int ch = 0; ch < numChannels; ++ch)
+    if (numChannels <= 0)
+        return;
+
+    cpuBudget_.beginBlock();
+    voiceManager_.applyQuality(cpuBudget_);
+
+    renderBlock(outputs[0], nullptr, numSamples);
+
+    // Output to all channels
+    for (int ch = 1; ch < numChannels; ++ch)
     {
-        std::memset(outputs[ch], 0, sizeof(float) * numSamples);
+        std::memcpy(outputs[ch], outputs[0], sizeof(float) * numSamples);
     }
 
+    cpuBudget_.endBlock(numSamples);
+}
+
+void AetherGiantVoicePureDSP::processStems(float* const* stems, GiantStemPosition* positions, int numSamples)
+{
+    cpuBudget_.beginBlock();
+    voiceManager_.applyQuality(cpuBudget_);
+
+    const int numStems = voiceManager_.getNumVoices();
+
+    // Voices that finish during the block still sounded in it
+    for (int v = 0; v < numStems; ++v)
+        positions[v].active = (voiceManager_.getVoiceNote(v) >= 0);
+
+    renderBlock(nullptr, stems, numSamples);
+
+    for (int v = 0; v < numStems; ++v)
+    {
+        const int note = voiceManager_.getVoiceNote(v);
+        GiantStemPosition& position = positions[v];
+
+        // A slot that was idle or changed note is a new source, not a moving one
+        position.retriggered = (note >= 0 && note != stemNotes_[static_cast<size_t>(v)]);
+        position.active = position.active || note >= 0;
+        if (note >= 0)
+            position.lateral = std::clamp((static_cast<float>(note) - 60.0f) / 30.0f, -1.0f, 1.0f);
+
+        stemNotes_[static_cast<size_t>(v)] = note;
+    }
+
+    cpuBudget_.endBlock(numSamples);
+}
+
+void AetherGiantVoicePureDSP::renderBlock(float* mono, float* const* stems, int numSamples)
+{
     // Guard against NaN master volume
     float masterVol = params_.masterVolume;
     if (std::isnan(masterVol) || std::isinf(masterVol))
@@ -1465,25 +1858,31 @@ void AetherGiantVoicePureDSP::process(float** outputs, int numChannels, int numS
         masterVol = 0.8f;  // Safe default
     }
 
+    const int numStems = voiceManager_.getNumVoices();
+
     // Process samples
     for (int sample = 0; sample < numSamples; ++sample)
     {
-        float mono = voiceManager_.processSample();
+        float output = voiceManager_.processSample(stems != nullptr ? voiceSamples_.data() : nullptr);
 
         // Apply master volume
-        mono *= masterVol;
+        output *= masterVol;
 
         // Guard against NaN in output
-        if (std::isnan(mono) || std::isinf(mono))
+        const bool finite = !(std::isnan(output) || std::isinf(output));
+        if (!finite)
         {
-            mono = 0.0f;
+            output = 0.0f;
         }
 
-        // Output to all channels
-        for (int ch = 0; ch < numChannels; ++ch)
+        if (stems == nullptr)
         {
-            outputs[ch][sample] = mono;
+            mono[sample] = output;
+            continue;
         }
+
+        for (int v = 0; v < numStems; ++v)
+            stems[v][sample] = finite ? voiceSamples_[static_cast<size_t>(v)] * masterVol : 0.0f;
     }
 }
 
@@ -1578,6 +1977,7 @@ float AetherGiantVoicePureDSP::getParameter(const char* paramId) const
     if (id == "roughness") return params_.roughness;
 
     if (id == "masterVolume") return params_.masterVolume;
+    if (id == "cpuBudget") return params_.cpuBudget;
 
     return 0.0f;
 }
@@ -1646,6 +2046,7 @@ void AetherGiantVoicePureDSP::setParameter(const char* paramId, float value)
     }
 
     else if (id == "masterVolume") params_.masterVolume = value;
+    else if (id == "cpuBudget") params_.cpuBudget = value;
 
     applyParameters();
 }
@@ -1673,6 +2074,8 @@ void AetherGiantVoicePureDSP::applyParameters()
     chestParams.chestResonance = params_.chestResonance;
     chestParams.bodySize = params_.bodySize;
     voiceManager_.setChestParameters(chestParams);
+
+    cpuBudget_.setBudget(params_.cpuBudget);
 }
 
 bool AetherGiantVoicePureDSP::savePreset(char* jsonBuffer, int jsonBufferSize) const
@@ -1850,6 +2253,32 @@ bool AetherGiantVoicePureDSP::loadPreset(const char* jsonData)
     return true;
 }
 
+void AetherGiantVoicePureDSP::setFormantTrajectory(std::shared_ptr<const GiantFormantTrajectory> trajectory)
+{
+    // Voices hold plain pointers: repoint them before the old phrase is released
+    voiceManager_.setTrajectory(trajectory.get());
+    trajectory_ = std::move(trajectory);
+}
+
+void AetherGiantVoicePureDSP::setFormantTrajectory(const GiantFormantTrajectory* trajectory)
+{
+    // Borrowed: an owned phrase is only released by the next owning call
+    voiceManager_.setTrajectory(trajectory);
+}
+
+void AetherGiantVoicePureDSP::setRenderProfile(GiantRenderProfile profile)
+{
+    const bool offline = (profile == GiantRenderProfile::Offline);
+    cpuBudget_.setEnabled(!offline);
+    voiceManager_.setControlInterval(offline ? 1 : GiantVoice::trajectoryControlInterval);
+}
+
+void AetherGiantVoicePureDSP::setTuningTable(const GiantTuningTable* table)
+{
+    tuning_ = (table != nullptr) ? table : &GiantTuningTable::equalTemperament();
+    voiceManager_.setTuningTable(*tuning_);
+}
+
 int AetherGiantVoicePureDSP::getActiveVoiceCount() const
 {
     return voiceManager_.getActiveVoiceCount();
@@ -1857,7 +2286,7 @@ int AetherGiantVoicePureDSP::getActiveVoiceCount() const
 
 float AetherGiantVoicePureDSP::calculateFrequency(int midiNote) const
 {
-    float freq = midiToFrequency(midiNote);
+    float freq = tuning_->getFrequency(midiNote);
 
     // Apply scale-based frequency adjustment
     float scaleMultiplier = 1.0f / (1.0f + currentScale_.scaleMeters * 0.1f);
@@ -0,0 +1,124 @@
+/*
+  ==============================================================================
+
+   GiantBatchRenderer.cpp
+   Batch rendering of isolated notes for sample-library export
+
+  ==============================================================================
+*/
+
+#include "dsp/GiantBatchRenderer.h"
+#include "dsp/GiantRenderProfile.h"
+#include "dsp/GiantWorkerPool.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace DSP {
+
+//==============================================================================
+// GiantBatchRenderer Implementation
+//==============================================================================
+
+GiantBatchRenderer::GiantBatchRenderer(EngineFactory createEngineFn, const GiantBatchSettings& batchSettings)
+    : createEngine(std::move(createEngineFn))
+    , settings(batchSettings)
+{
+    settings.blockSize = std::max(1, settings.blockSize);
+}
+
+void GiantBatchRenderer::renderBatch(const GiantBatchJob* jobs, int numJobs, GiantBatchResult* results) const
+{
+    if (jobs == nullptr || numJobs <= 0)
+        return;
+
+    // Jobs write disjoint buffers
+    GiantWorkerPool::run(numJobs, GiantWorkerPool::threadCount(settings.numThreads, numJobs), [&](int j)
+    {
+        const GiantBatchResult result = renderJob(jobs[j]);
+        if (results != nullptr)
+            results[j] = result;
+    });
+}
+
+GiantBatchResult GiantBatchRenderer::renderJob(const GiantBatchJob& job) const
+{
+    GiantBatchResult result;
+
+    const int numChannels = (job.outputs[1] != nullptr) ? 2 : 1;
+    if (job.outputs[0] == nullptr || job.numSamples <= 0)
+        return result;
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        std::fill(job.outputs[ch], job.outputs[ch] + job.numSamples, 0.0f);
+
+    auto engine = createEngine(settings.sampleRate, settings.blockSize);
+    if (engine == nullptr)
+        return result;
+
+    if (auto* profileTarget = dynamic_cast<GiantRenderProfileTarget*>(engine.get()))
+        profileTarget->setRenderProfile(GiantRenderProfile::Offline);
+
+    ScheduledEvent event;
+    event.type = ScheduledEvent::NOTE_ON;
+    event.time = 0.0;
+    event.sampleOffset = 0;
+    event.data.note.midiNote = job.midiNote;
+    event.data.note.velocity = job.velocity;
+    engine->handleEvent(event);
+
+    // Engines always render stereo; a mono job discards the right channel
+    std::vector<float> discardedRight(numChannels == 1 ? static_cast<size_t>(settings.blockSize) : 0);
+
+    const int silenceSamples = static_cast<int>(std::ceil(settings.silenceSeconds * settings.sampleRate));
+    const bool stopOnSilence = settings.silenceThreshold > 0.0f;
+    int quietSince = -1;
+
+    int position = 0;
+    while (position < job.numSamples)
+    {
+        // Blocks end at the note-off so it lands exactly where asked
+        int n = std::min(settings.blockSize, job.numSamples - position);
+        if (job.noteOffSample > position)
+            n = std::min(n, job.noteOffSample - position);
+
+        if (position == job.noteOffSample)
+        {
+            event.type = ScheduledEvent::NOTE_OFF;
+            engine->handleEvent(event);
+        }
+
+        if (numChannels == 1)
+            std::fill(discardedRight.begin(), discardedRight.begin() + n, 0.0f);
+
+        float* outputs[2] = { job.outputs[0] + position,
+                              (numChannels > 1) ? job.outputs[1] + position : discardedRight.data() };
+        engine->process(outputs, 2, n);
+
+        float blockPeak = 0.0f;
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int i = 0; i < n; ++i)
+                blockPeak = std::max(blockPeak, std::abs(outputs[ch][i]));
+        result.peak = std::max(result.peak, blockPeak);
+
+        position += n;
+
+        // Giant tails: once sounded, released and silent for long enough, the rest stays zero
+        const bool released = (job.noteOffSample < 0 || position > job.noteOffSample);
+        if (stopOnSilence && released && result.peak >= settings.silenceThreshold)
+        {
+            if (blockPeak >= settings.silenceThreshold)
+                quietSince = -1;
+            else if (quietSince < 0)
+                quietSince = position - n;
+
+            if (quietSince >= 0 && position - quietSince >= silenceSamples)
+                break;
+        }
+    }
+
+    result.renderedSamples = position;
+    return result;
+}
+
+}  // namespace DSP
@@ -0,0 +1,353 @@
+/*
+  ==============================================================================
+
+   GiantChunkRenderer.cpp
+   Chunk-parallel offline rendering for the Giant Instruments engines
+
+  ==============================================================================
+*/
+
+#include "dsp/GiantChunkRenderer.h"
+#include "dsp/GiantRenderProfile.h"
+#include "dsp/GiantVoiceWarmUp.h"
+#include "dsp/GiantWorkerPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <set>
+
+namespace DSP {
+
+namespace {
+
+/** Seconds to a whole number of blocks (at least one) */
+int64_t toBlocks(double seconds, double sampleRate, int blockSize)
+{
+    const auto samples = static_cast<int64_t>(std::ceil(std::max(0.0, seconds) * sampleRate));
+    return std::max<int64_t>(1, (samples + blockSize - 1) / blockSize) * blockSize;
+}
+
+/** Copy the part of [blockStart, blockStart + n) inside [start, end) to dest (indexed from origin) */
+void copyOverlap(const float* block, int64_t blockStart, int n, int64_t start, int64_t end,
+                 float* dest, int64_t origin)
+{
+    const int64_t from = std::max(blockStart, start);
+    const int64_t to = std::min(blockStart + n, end);
+    if (from < to)
+        std::copy(block + (from - blockStart), block + (to - blockStart), dest + (from - origin));
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+//==============================================================================
+// GiantChunkRenderer Implementation
+//==============================================================================
+
+GiantChunkRenderer::GiantChunkRenderer(EngineFactory createEngineFn, const GiantChunkRenderSettings& renderSettings)
+    : createEngine(std::move(createEngineFn))
+    , settings(renderSettings)
+{
+    settings.blockSize = std::max(1, settings.blockSize);
+    settings.numChannels = std::clamp(settings.numChannels, 1, 2);
+}
+
+GiantChunkRenderReport GiantChunkRenderer::render(const std::vector<GiantTimelineEvent>& events, int64_t numSamples,
+                                                  std::vector<std::vector<float>>& output) const
+{
+    GiantChunkRenderReport report;
+
+    numSamples = std::max<int64_t>(0, numSamples);
+    output.assign(static_cast<size_t>(settings.numChannels), std::vector<float>(static_cast<size_t>(numSamples), 0.0f));
+    if (numSamples == 0)
+        return report;
+
+    const int64_t chunkLength = toBlocks(settings.chunkSeconds, settings.sampleRate, settings.blockSize);
+    const int64_t preroll = toBlocks(settings.prerollSeconds, settings.sampleRate, settings.blockSize);
+    const int64_t maxHeldPreroll = std::max(preroll, toBlocks(settings.maxHeldPrerollSeconds, settings.sampleRate,
+                                                              settings.blockSize));
+    const int64_t crossfade = std::min(chunkLength,
+        static_cast<int64_t>(std::llround(std::max(0.0, settings.crossfadeSeconds) * settings.sampleRate)));
+
+    // Chunks inside long held-note chains join the chunk before them:
+    // re-rendering the chain per chunk would cost quadratic time
+    std::vector<ChunkPlan> plans;
+    for (int64_t chunkStart = 0; chunkStart < numSamples; chunkStart += chunkLength)
+    {
+        const int64_t warmStart = findWarmStart(events, std::max<int64_t>(0, chunkStart - preroll));
+        const int64_t chunkEnd = std::min(numSamples, chunkStart + chunkLength);
+
+        if (!plans.empty() && chunkStart - warmStart > maxHeldPreroll)
+        {
+            plans.back().chunkEnd = chunkEnd;
+            plans.back().renderEnd = std::min(numSamples, chunkEnd + crossfade);
+            continue;
+        }
+
+        ChunkPlan plan;
+        plan.chunkStart = chunkStart;
+        plan.warmStart = warmStart;
+        plan.writeStart = plans.empty() ? 0 : std::min(numSamples, chunkStart + crossfade);
+        plan.chunkEnd = chunkEnd;
+        plan.renderEnd = std::min(numSamples, chunkEnd + crossfade);
+        plans.push_back(plan);
+    }
+    const int numChunks = static_cast<int>(plans.size());
+
+    // Overlaps are rendered twice (tail of chunk k - 1, head of chunk k) and crossfaded afterwards
+    using Channels = std::vector<std::vector<float>>;
+    std::vector<Channels> heads(static_cast<size_t>(numChunks));
+    std::vector<Channels> tails(static_cast<size_t>(numChunks));
+    for (int k = 0; k < numChunks; ++k)
+    {
+        const ChunkPlan& plan = plans[static_cast<size_t>(k)];
+        heads[static_cast<size_t>(k)].assign(static_cast<size_t>(settings.numChannels),
+                                             std::vector<float>(static_cast<size_t>(plan.writeStart - plan.chunkStart)));
+        tails[static_cast<size_t>(k)].assign(static_cast<size_t>(settings.numChannels),
+                                             std::vector<float>(static_cast<size_t>(plan.renderEnd - plan.chunkEnd)));
+    }
+
+    const int numThreads = GiantWorkerPool::threadCount(settings.numThreads, numChunks);
+    report.numChunks = numChunks;
+    report.numThreads = numThreads;
+
+    // Chunks write disjoint output ranges
+    const auto parallelStart = std::chrono::steady_clock::now();
+    GiantWorkerPool::run(numChunks, numThreads, [&](int k)
+    {
+        const ChunkTarget target { &output, &heads[static_cast<size_t>(k)], &tails[static_cast<size_t>(k)] };
+        renderChunk(events, plans[static_cast<size_t>(k)], target);
+    });
+
+    // Linear crossfade: both sides render the same (correlated) signal
+    for (int k = 1; k < numChunks; ++k)
+    {
+        const ChunkPlan& plan = plans[static_cast<size_t>(k)];
+        const auto& head = heads[static_cast<size_t>(k)];
+        const auto& tail = tails[static_cast<size_t>(k - 1)];
+        const int64_t length = plan.writeStart - plan.chunkStart;
+
+        for (int ch = 0; ch < settings.numChannels; ++ch)
+        {
+            float* dest = output[static_cast<size_t>(ch)].data() + plan.chunkStart;
+            for (int64_t i = 0; i < length; ++i)
+            {
+                const float incoming = head[static_cast<size_t>(ch)][static_cast<size_t>(i)];
+                const float outgoing = tail[static_cast<size_t>(ch)][static_cast<size_t>(i)];
+                const float fade = (static_cast<float>(i) + 0.5f) / static_cast<float>(length);
+
+                dest[i] = outgoing + fade * (incoming - outgoing);
+                report.maxSeamDifference = std::max(report.maxSeamDifference, std::abs(incoming - outgoing));
+            }
+        }
+    }
+    report.renderSeconds = secondsSince(parallelStart);
+
+    if (settings.verify)
+    {
+        Channels serial(static_cast<size_t>(settings.numChannels), std::vector<float>(static_cast<size_t>(numSamples)));
+        const ChunkPlan whole { 0, 0, 0, numSamples, numSamples };
+
+        const auto serialStart = std::chrono::steady_clock::now();
+        renderChunk(events, whole, ChunkTarget { &serial, nullptr, nullptr });
+        report.serialRenderSeconds = secondsSince(serialStart);
+
+        for (int ch = 0; ch < settings.numChannels; ++ch)
+        {
+            for (int64_t i = 0; i < numSamples; ++i)
+            {
+                const float difference = std::abs(output[static_cast<size_t>(ch)][static_cast<size_t>(i)]
+                                                - serial[static_cast<size_t>(ch)][static_cast<size_t>(i)]);
+                if (difference > report.maxDifference)
+                {
+                    report.maxDifference = difference;
+                    report.maxDifferencePosition = i;
+                }
+            }
+        }
+        report.verified = true;
+    }
+
+    return report;
+}
+
+//==============================================================================
+void GiantChunkRenderer::renderChunk(const std::vector<GiantTimelineEvent>& events, const ChunkPlan& plan,
+                                     const ChunkTarget& target) const
+{
+    auto engine = createEngine(settings.sampleRate, settings.blockSize);
+    if (engine == nullptr)
+        return;
+
+    // No deadline offline: full detail, no governor, every voice ready up front
+    if (auto* profileTarget = dynamic_cast<GiantRenderProfileTarget*>(engine.get()))
+        profileTarget->setRenderProfile(GiantRenderProfile::Offline);
+    if (auto* warmUp = dynamic_cast<GiantVoiceWarmUp*>(engine.get()))
+        while (warmUp->warmUpVoices(64) > 0) {}
+
+    chaseEvents(*engine, events, plan.warmStart);
+
+    std::vector<float> left(static_cast<size_t>(settings.blockSize));
+    std::vector<float> right(static_cast<size_t>(settings.blockSize));
+    float* outputs[2] = { left.data(), right.data() };
+
+    auto nextEvent = std::lower_bound(events.begin(), events.end(), plan.warmStart,
+        [](const GiantTimelineEvent& e, int64_t position) { return e.samplePosition < position; });
+
+    for (int64_t blockStart = plan.warmStart; blockStart < plan.renderEnd; blockStart += settings.blockSize)
+    {
+        const int n = static_cast<int>(std::min<int64_t>(settings.blockSize, plan.renderEnd - blockStart));
+
+        for (; nextEvent != events.end() && nextEvent->samplePosition < blockStart + n; ++nextEvent)
+        {
+            ScheduledEvent event = nextEvent->event;
+            event.sampleOffset = static_cast<int>(nextEvent->samplePosition - blockStart);
+            applyEvent(*engine, event);
+        }
+
+        std::fill(left.begin(), left.begin() + n, 0.0f);
+        std::fill(right.begin(), right.begin() + n, 0.0f);
+        engine->process(outputs, settings.numChannels, n);
+
+        for (int ch = 0; ch < settings.numChannels; ++ch)
+        {
+            const auto c = static_cast<size_t>(ch);
+            copyOverlap(outputs[ch], blockStart, n, plan.writeStart, plan.chunkEnd,
+                        (*target.output)[c].data(), 0);
+            if (target.head != nullptr)
+                copyOverlap(outputs[ch], blockStart, n, plan.chunkStart, plan.writeStart,
+                            (*target.head)[c].data(), plan.chunkStart);
+            if (target.tail != nullptr)
+                copyOverlap(outputs[ch], blockStart, n, plan.chunkEnd, plan.renderEnd,
+                            (*target.tail)[c].data(), plan.chunkEnd);
+        }
+    }
+}
+
+int64_t GiantChunkRenderer::findWarmStart(const std::vector<GiantTimelineEvent>& events, int64_t position) const
+{
+    // Sustained engines self-oscillate: a note picked up half way never
+    // locks to the serial render's phase. Start before the held notes instead.
+    std::set<int> heldNotes;
+    int64_t heldSince = position;
+
+    for (const auto& timed : events)
+    {
+        if (timed.samplePosition >= position)
+            break;
+
+        const ScheduledEvent& event = timed.event;
+        const bool noteOn = (event.type == ScheduledEvent::NOTE_ON && event.data.note.velocity > 0.0f);
+        const bool noteOff = (event.type == ScheduledEvent::NOTE_OFF)
+                          || (event.type == ScheduledEvent::NOTE_ON && event.data.note.velocity <= 0.0f);
+
+        if (noteOn)
+        {
+            if (heldNotes.empty())
+                heldSince = timed.samplePosition;
+            heldNotes.insert(event.data.note.midiNote);
+        }
+        else if (noteOff)
+        {
+            heldNotes.erase(event.data.note.midiNote);
+        }
+        else if (event.type == ScheduledEvent::RESET)
+        {
+            heldNotes.clear();
+        }
+    }
+
+    if (heldNotes.empty())
+        return position;
+
+    // Same block grid as the serial render
+    return (heldSince / settings.blockSize) * settings.blockSize;
+}
+
+void GiantChunkRenderer::chaseEvents(InstrumentDSP& engine, const std::vector<GiantTimelineEvent>& events,
+                                     int64_t position)
+{
+    std::map<int, float> controllers;               // Controller -> last value
+    bool hasPitchBend = false, hasPressure = false;
+    float pitchBend = 0.0f, pressure = 0.0f;
+
+    for (const auto& timed : events)
+    {
+        if (timed.samplePosition >= position)
+            break;
+
+        const ScheduledEvent& event = timed.event;
+        switch (event.type)
+        {
+            case ScheduledEvent::PITCH_BEND:
+                pitchBend = event.data.pitchBend.bendValue;
+                hasPitchBend = true;
+                break;
+
+            case ScheduledEvent::CONTROL_CHANGE:
+                controllers[event.data.controlChange.controllerNumber] = event.data.controlChange.value;
+                break;
+
+            case ScheduledEvent::CHANNEL_PRESSURE:
+                pressure = event.data.channelPressure.pressure;
+                hasPressure = true;
+                break;
+
+            case ScheduledEvent::PARAM_CHANGE:
+                // Parameters can depend on each other (presets, bore shapes): keep their order
+                applyEvent(engine, event);
+                break;
+
+            case ScheduledEvent::RESET:
+                controllers.clear();
+                hasPitchBend = hasPressure = false;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    // Notes never need chasing: findWarmStart() starts outside held notes
+    ScheduledEvent event;
+    event.time = 0.0;
+    event.sampleOffset = 0;
+
+    for (const auto& [number, value] : controllers)
+    {
+        event.type = ScheduledEvent::CONTROL_CHANGE;
+        event.data.controlChange.controllerNumber = number;
+        event.data.controlChange.value = value;
+        engine.handleEvent(event);
+    }
+
+    if (hasPitchBend)
+    {
+        event.type = ScheduledEvent::PITCH_BEND;
+        event.data.pitchBend.bendValue = pitchBend;
+        engine.handleEvent(event);
+    }
+
+    if (hasPressure)
+    {
+        event.type = ScheduledEvent::CHANNEL_PRESSURE;
+        event.data.channelPressure.pressure = pressure;
+        engine.handleEvent(event);
+    }
+}
+
+void GiantChunkRenderer::applyEvent(InstrumentDSP& engine, const ScheduledEvent& event)
+{
+    // Not every engine handles PARAM_CHANGE events; all of them take setParameter()
+    if (event.type == ScheduledEvent::PARAM_CHANGE)
+        engine.setParameter(event.data.param.paramId, event.data.param.value);
+    else
+        engine.handleEvent(event);
+}
+
+}  // namespace DSP
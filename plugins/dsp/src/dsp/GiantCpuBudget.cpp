@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+   GiantCpuBudget.cpp
+   CPU budget governor for the Giant Instruments engines
+
+  ==============================================================================
+*/
+
+#include "dsp/GiantCpuBudget.h"
+#include <algorithm>
+
+namespace DSP {
+
+//==============================================================================
+// GiantCpuBudget Implementation
+//==============================================================================
+
+void GiantCpuBudget::prepare(double sampleRate, int /*blockSize*/)
+{
+    sr = sampleRate > 0.0 ? sampleRate : 48000.0;
+    reset();
+}
+
+void GiantCpuBudget::reset()
+{
+    quality = Quality::Full;
+    blockOpen = false;
+    smoothedLoad = 0.0f;
+    blocksSinceChange = 0;
+    goodBlocks = 0;
+}
+
+void GiantCpuBudget::beginBlock()
+{
+    blockStart = Clock::now();
+    blockOpen = true;
+}
+
+void GiantCpuBudget::endBlock(int numSamples)
+{
+    if (!enabled || !blockOpen || numSamples <= 0)
+        return;
+
+    blockOpen = false;
+
+    const double elapsed = std::chrono::duration<double>(Clock::now() - blockStart).count();
+    const double deadline = static_cast<double>(numSamples) / sr;
+    const float load = static_cast<float>(elapsed / deadline);
+
+    // One-pole smoothing for the restore decision only; degrading reacts to
+    // the instantaneous load so a single heavy block is enough
+    smoothedLoad += (load - smoothedLoad) * 0.1f;
+    ++blocksSinceChange;
+
+    if (load > params.budgetFraction)
+    {
+        goodBlocks = 0;
+        if (blocksSinceChange >= params.degradeHoldBlocks)
+            stepDown();
+        return;
+    }
+
+    if (smoothedLoad < params.budgetFraction * params.restoreHeadroom)
+    {
+        if (++goodBlocks >= params.restoreHoldBlocks)
+            stepUp();
+    }
+    else
+    {
+        goodBlocks = 0;
+    }
+}
+
+void GiantCpuBudget::setEnabled(bool shouldBeEnabled)
+{
+    if (enabled == shouldBeEnabled)
+        return;
+
+    enabled = shouldBeEnabled;
+    reset();
+}
+
+void GiantCpuBudget::setBudget(float fraction)
+{
+    params.budgetFraction = std::clamp(fraction, 0.05f, 1.0f);
+}
+
+void GiantCpuBudget::setParameters(const Parameters& p)
+{
+    params = p;
+    params.budgetFraction = std::clamp(params.budgetFraction, 0.05f, 1.0f);
+    params.restoreHeadroom = std::clamp(params.restoreHeadroom, 0.1f, 1.0f);
+    params.restoreHoldBlocks = std::max(1, params.restoreHoldBlocks);
+    params.degradeHoldBlocks = std::max(1, params.degradeHoldBlocks);
+}
+
+int GiantCpuBudget::scaleCount(int fullCount, int minCount) const
+{
+    int count = fullCount;
+
+    switch (quality)
+    {
+        case Quality::Full:    count = fullCount; break;
+        case Quality::Reduced: count = (fullCount * 3) / 4; break;
+        case Quality::Low:     count = fullCount / 2; break;
+        case Quality::Minimal: count = fullCount / 4; break;
+    }
+
+    return std::min(fullCount, std::max(minCount, count));
+}
+
+void GiantCpuBudget::stepDown()
+{
+    if (quality != Quality::Minimal)
+        quality = static_cast<Quality>(static_cast<int>(quality) + 1);
+
+    blocksSinceChange = 0;
+    goodBlocks = 0;
+}
+
+void GiantCpuBudget::stepUp()
+{
+    if (quality != Quality::Full)
+        quality = static_cast<Quality>(static_cast<int>(quality) - 1);
+
+    blocksSinceChange = 0;
+    goodBlocks = 0;
+}
+
+}  // namespace DSP
@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+   GiantFormantTrajectory.cpp
+   Pre-analyzed vocal performances for the Giant Voice engine
+
+  ==============================================================================
+*/
+
+#include "dsp/GiantFormantTrajectory.h"
+#include <juce_core/juce_core.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace DSP {
+
+namespace {
+
+constexpr char fileMagic[4] = { 'G', 'F', 'T', 'R' };
+
+} // namespace
+
+//==============================================================================
+// GiantFormantTrajectory Implementation
+//==============================================================================
+
+GiantFormantTrajectory::~GiantFormantTrajectory() = default;
+
+std::shared_ptr<const GiantFormantTrajectory> GiantFormantTrajectory::load(const juce::File& file)
+{
+    auto mapping = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+    const auto* data = static_cast<const char*>(mapping->getData());
+    const size_t size = mapping->getSize();
+
+    if (data == nullptr || size < sizeof(FileHeader))
+        return nullptr;
+
+    FileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0
+        || header.version != fileVersion
+        || header.numFormants != static_cast<uint32_t>(numFormants)
+        || header.numFrames == 0
+        || !(header.frameRate > 0.0f) || !std::isfinite(header.frameRate)
+        || !(header.referenceF0 >= 0.0f) || !(header.referenceF0 < maxPitchHz)
+        || size < sizeof(FileHeader) + static_cast<size_t>(header.numFrames) * sizeof(Frame))
+    {
+        return nullptr;
+    }
+
+    const auto* frames = reinterpret_cast<const Frame*>(data + sizeof(FileHeader));
+    if (!std::all_of(frames, frames + header.numFrames, isValidFrame))
+        return nullptr;
+
+    std::shared_ptr<GiantFormantTrajectory> trajectory(new GiantFormantTrajectory());
+    trajectory->frames = frames;
+    trajectory->numFrames = header.numFrames;
+    trajectory->frameRate = header.frameRate;
+    trajectory->referenceF0 = header.referenceF0;
+    trajectory->mappedFile = std::move(mapping);
+    return trajectory;
+}
+
+bool GiantFormantTrajectory::write(const juce::File& file, float frameRate, float referenceF0,
+                                   const std::vector<Frame>& frames)
+{
+    if (frames.empty() || !(frameRate > 0.0f))
+        return false;
+
+    FileHeader header;
+    std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = fileVersion;
+    header.frameRate = frameRate;
+    header.numFrames = static_cast<uint32_t>(frames.size());
+    header.numFormants = static_cast<uint32_t>(numFormants);
+    header.referenceF0 = referenceF0;
+
+    std::vector<char> bytes(sizeof(FileHeader) + frames.size() * sizeof(Frame));
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    std::memcpy(bytes.data() + sizeof(header), frames.data(), frames.size() * sizeof(Frame));
+
+    return file.replaceWithData(bytes.data(), bytes.size());
+}
+
+bool GiantFormantTrajectory::isValidFrame(const Frame& frame)
+{
+    // Written so that NaN fails every comparison
+    if (!(frame.f0 >= 0.0f && frame.f0 < maxPitchHz) || !(frame.level >= 0.0f && frame.level <= 1.0f))
+        return false;
+
+    for (int i = 0; i < numFormants; ++i)
+    {
+        if (!(frame.formantHz[i] > 0.0f && frame.formantHz[i] < maxFormantHz)
+            || !(frame.bandwidthHz[i] > 0.0f && frame.bandwidthHz[i] < maxFormantHz))
+            return false;
+    }
+    return true;
+}
+
+GiantFormantTrajectory::Frame GiantFormantTrajectory::getFrame(double timeSeconds) const
+{
+    const double position = std::max(0.0, timeSeconds) * frameRate;
+    const uint32_t index = static_cast<uint32_t>(std::min(position, static_cast<double>(numFrames - 1)));
+
+    if (index + 1 >= numFrames)
+        return frames[numFrames - 1];
+
+    const Frame& a = frames[index];
+    const Frame& b = frames[index + 1];
+    const float t = static_cast<float>(position - index);
+
+    Frame frame;
+    frame.level = a.level + t * (b.level - a.level);
+    for (int i = 0; i < numFormants; ++i)
+    {
+        frame.formantHz[i] = a.formantHz[i] + t * (b.formantHz[i] - a.formantHz[i]);
+        frame.bandwidthHz[i] = a.bandwidthHz[i] + t * (b.bandwidthHz[i] - a.bandwidthHz[i]);
+    }
+
+    // Voicing switches at the midpoint rather than gliding from 0 Hz
+    if (a.f0 > 0.0f && b.f0 > 0.0f)
+        frame.f0 = a.f0 + t * (b.f0 - a.f0);
+    else
+        frame.f0 = (t < 0.5f) ? a.f0 : b.f0;
+
+    return frame;
+}
+
+}  // namespace DSP
@@ -0,0 +1,289 @@
+/*
+  ==============================================================================
+
+   GiantModMatrix.cpp
+   Control-rate modulation matrix for the Giant Instruments engines
+
+  ==============================================================================
+*/
+
+#include "dsp/GiantModMatrix.h"
+#include <algorithm>
+#include <cmath>
+
+namespace DSP {
+
+namespace {
+
+constexpr float twoPi = 6.28318530717958647692f;
+
+/** Bipolar LFO waveform at phase (0 - 1); sample-and-hold is handled by the caller */
+float lfoWaveform(GiantLfoShape shape, float phase)
+{
+    switch (shape)
+    {
+        case GiantLfoShape::Triangle:
+            return 1.0f - 4.0f * std::abs(phase - 0.5f);
+        case GiantLfoShape::Saw:
+            return 2.0f * phase - 1.0f;
+        case GiantLfoShape::Square:
+            return (phase < 0.5f) ? 1.0f : -1.0f;
+        case GiantLfoShape::Sine:
+        default:
+            return std::sin(twoPi * phase);
+    }
+}
+
+}  // namespace
+
+//==============================================================================
+// GiantModMatrix Implementation
+//==============================================================================
+
+GiantModMatrix::GiantModMatrix()
+    : noise(0x4D6F644D61747269ull)  // Fixed seed: random and S&H sources repeat in offline renders
+{
+    updateCoefficients();
+}
+
+void GiantModMatrix::prepare(double newSampleRate, int numVoices)
+{
+    sampleRate = newSampleRate;
+
+    // Fixed rate in seconds, not samples: the matrix costs the same at any sample rate
+    controlInterval = std::max(1, static_cast<int>(std::lround(sampleRate / controlRate)));
+
+    voices.assign(static_cast<size_t>(std::max(0, numVoices)), VoiceState {});
+    rampStart.assign(voices.size() * numDestinations, 0.0f);
+    rampStep.assign(voices.size() * numDestinations, 0.0f);
+    rampTarget.assign(voices.size() * numDestinations, 0.0f);
+
+    updateCoefficients();
+    reset();
+}
+
+void GiantModMatrix::reset()
+{
+    std::fill(voices.begin(), voices.end(), VoiceState {});
+    std::fill(rampStart.begin(), rampStart.end(), 0.0f);
+    std::fill(rampStep.begin(), rampStep.end(), 0.0f);
+    std::fill(rampTarget.begin(), rampTarget.end(), 0.0f);
+    rampPosition = controlInterval;
+
+    lfoPhase.fill(0.0f);
+    lfoValue.fill(0.0f);
+    lfoHeld.fill(0.0f);
+    running = (numActiveRoutes > 0);
+}
+
+void GiantModMatrix::setSettings(const GiantModSettings& newSettings)
+{
+    settings = newSettings;
+
+    numActiveRoutes = 0;
+    for (int r = 0; r < GiantModSettings::maxRoutes; ++r)
+    {
+        if (settings.routes[static_cast<size_t>(r)].isActive())
+            activeRoutes[static_cast<size_t>(numActiveRoutes++)] = r;
+    }
+
+    // Removing the last route keeps ticking until the values have ramped to zero
+    if (numActiveRoutes > 0)
+        running = true;
+
+    updateCoefficients();
+}
+
+void GiantModMatrix::updateCoefficients()
+{
+    const auto& envelope = settings.envelope;
+    const double interval = static_cast<double>(controlInterval);
+
+    attackStep = static_cast<float>(interval / std::max(1.0, envelope.attackSeconds * sampleRate));
+    decayCoefficient = static_cast<float>(std::exp(-interval / std::max(1.0, envelope.decaySeconds * sampleRate)));
+    releaseCoefficient = static_cast<float>(std::exp(-interval / std::max(1.0, envelope.releaseSeconds * sampleRate)));
+}
+
+void GiantModMatrix::noteOn(int voice, int note, float velocity)
+{
+    if (voice < 0 || voice >= static_cast<int>(voices.size()))
+        return;
+
+    VoiceState& state = voices[static_cast<size_t>(voice)];
+    state.note = std::clamp(note, 0, numNotes - 1);
+    state.velocity = velocity;
+    state.random = noise.nextBipolar();
+    state.stage = EnvelopeStage::Attack;
+    state.envelope = 0.0f;
+
+    if (!running)
+        return;
+
+    // Start at the target and hold it until the next tick
+    float targets[numDestinations];
+    evaluateVoice(voice, targets);
+
+    for (int d = 0; d < numDestinations; ++d)
+    {
+        const size_t slot = static_cast<size_t>(voice * numDestinations + d);
+        rampStart[slot] = targets[d];
+        rampStep[slot] = 0.0f;
+        rampTarget[slot] = targets[d];
+    }
+}
+
+void GiantModMatrix::noteOff(int voice)
+{
+    if (voice < 0 || voice >= static_cast<int>(voices.size()))
+        return;
+
+    VoiceState& state = voices[static_cast<size_t>(voice)];
+    if (state.stage != EnvelopeStage::Idle)
+        state.stage = EnvelopeStage::Release;
+}
+
+void GiantModMatrix::setNotePressure(int note, float pressure)
+{
+    if (note < 0)
+        notePressure.fill(pressure);
+    else if (note < numNotes)
+        notePressure[static_cast<size_t>(note)] = pressure;
+}
+
+void GiantModMatrix::setNoteTimbre(int note, float timbre)
+{
+    if (note < 0)
+        noteTimbre.fill(timbre);
+    else if (note < numNotes)
+        noteTimbre[static_cast<size_t>(note)] = timbre;
+}
+
+void GiantModMatrix::setNoteBend(int note, float bend)
+{
+    if (note < 0)
+        noteBend.fill(bend);
+    else if (note < numNotes)
+        noteBend[static_cast<size_t>(note)] = bend;
+}
+
+void GiantModMatrix::advanceEnvelope(VoiceState& state) const
+{
+    const float sustain = settings.envelope.sustain;
+
+    switch (state.stage)
+    {
+        case EnvelopeStage::Attack:
+            state.envelope += attackStep;
+            if (state.envelope >= 1.0f)
+            {
+                state.envelope = 1.0f;
+                state.stage = EnvelopeStage::Decay;
+            }
+            break;
+
+        case EnvelopeStage::Decay:
+            state.envelope = sustain + (state.envelope - sustain) * decayCoefficient;
+            break;
+
+        case EnvelopeStage::Release:
+            state.envelope *= releaseCoefficient;
+            if (state.envelope < 1.0e-4f)
+            {
+                state.envelope = 0.0f;
+                state.stage = EnvelopeStage::Idle;
+            }
+            break;
+
+        case EnvelopeStage::Idle:
+        default:
+            break;
+    }
+}
+
+void GiantModMatrix::evaluateVoice(int voice, float* targets) const
+{
+    std::fill(targets, targets + numDestinations, 0.0f);
+
+    const VoiceState& state = voices[static_cast<size_t>(voice)];
+    if (state.note < 0)
+        return;
+
+    const size_t note = static_cast<size_t>(state.note);
+
+    float sources[static_cast<int>(GiantModSource::numSources)];
+    sources[static_cast<int>(GiantModSource::Lfo1)] = lfoValue[0];
+    sources[static_cast<int>(GiantModSource::Lfo2)] = lfoValue[1];
+    sources[static_cast<int>(GiantModSource::Envelope)] = state.envelope;
+    sources[static_cast<int>(GiantModSource::Velocity)] = state.velocity;
+    sources[static_cast<int>(GiantModSource::KeyTrack)] = static_cast<float>(state.note - 60) / 60.0f;
+    sources[static_cast<int>(GiantModSource::Pressure)] = notePressure[note];
+    sources[static_cast<int>(GiantModSource::Timbre)] = noteTimbre[note];
+    sources[static_cast<int>(GiantModSource::Bend)] = noteBend[note];
+    sources[static_cast<int>(GiantModSource::ModWheel)] = modWheel;
+    sources[static_cast<int>(GiantModSource::Random)] = state.random;
+
+    for (int i = 0; i < numActiveRoutes; ++i)
+    {
+        const GiantModRoute& route = settings.routes[static_cast<size_t>(activeRoutes[static_cast<size_t>(i)])];
+        const int source = static_cast<int>(route.source);
+        if (source >= 0 && source < static_cast<int>(GiantModSource::numSources))
+            targets[route.destination] += route.depth * sources[source];
+    }
+}
+
+void GiantModMatrix::tick()
+{
+    const float tickSeconds = static_cast<float>(controlInterval / sampleRate);
+
+    for (int l = 0; l < GiantModSettings::numLfos; ++l)
+    {
+        const GiantModLfo& lfo = settings.lfos[static_cast<size_t>(l)];
+        float& phase = lfoPhase[static_cast<size_t>(l)];
+
+        phase += std::max(0.0f, lfo.rateHz) * tickSeconds;
+        const bool wrapped = (phase >= 1.0f);
+        phase -= std::floor(phase);
+
+        if (lfo.shape == GiantLfoShape::SampleAndHold)
+        {
+            if (wrapped)
+                lfoHeld[static_cast<size_t>(l)] = noise.nextBipolar();
+            lfoValue[static_cast<size_t>(l)] = lfoHeld[static_cast<size_t>(l)];
+        }
+        else
+        {
+            lfoValue[static_cast<size_t>(l)] = lfoWaveform(lfo.shape, phase);
+        }
+    }
+
+    const float rampScale = 1.0f / static_cast<float>(controlInterval);
+    const int numVoices = static_cast<int>(voices.size());
+    bool settled = true;
+
+    for (int v = 0; v < numVoices; ++v)
+    {
+        advanceEnvelope(voices[static_cast<size_t>(v)]);
+
+        float targets[numDestinations];
+        evaluateVoice(v, targets);
+
+        for (int d = 0; d < numDestinations; ++d)
+        {
+            const size_t slot = static_cast<size_t>(v * numDestinations + d);
+            const float current = rampTarget[slot];    // Where the last ramp ended
+
+            rampStart[slot] = current;
+            rampStep[slot] = (targets[d] - current) * rampScale;
+            rampTarget[slot] = targets[d];
+            settled = settled && current == 0.0f && targets[d] == 0.0f;
+        }
+    }
+
+    rampPosition = 0;
+
+    // No routes and every value back at zero: voices are unmodulated
+    if (numActiveRoutes == 0 && settled)
+        running = false;
+}
+
+}  // namespace DSP
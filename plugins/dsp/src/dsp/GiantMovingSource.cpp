@@ -0,0 +1,233 @@
+/*
+  ==============================================================================
+
+   GiantMovingSource.cpp
+   Doppler, distance gain and air absorption for a moving giant
+
+  ==============================================================================
+*/
+
+#include "dsp/GiantMovingSource.h"
+#include <algorithm>
+#include <cmath>
+
+namespace DSP {
+
+namespace {
+
+constexpr double twoPi = 6.28318530717958647692;
+
+/** 4-point, 3rd-order Hermite interpolation between x0 and x1 */
+inline float hermite(float xm1, float x0, float x1, float x2, float t)
+{
+    const float c1 = 0.5f * (x1 - xm1);
+    const float c2 = xm1 - 2.5f * x0 + 2.0f * x1 - 0.5f * x2;
+    const float c3 = 0.5f * (x2 - xm1) + 1.5f * (x0 - x1);
+    return ((c3 * t + c2) * t + c1) * t + x0;
+}
+
+}  // namespace
+
+//==============================================================================
+// GiantMovingSource Implementation
+//==============================================================================
+
+void GiantMovingSource::prepare(double newSampleRate, int numChannels)
+{
+    sampleRate = newSampleRate;
+    preparedChannels = std::clamp(numChannels, 1, maxChannels);
+
+    // Longest delay: the farthest source in the coldest air we accept (-40 C)
+    const double slowestSound = 331.3 * std::sqrt(1.0 - 40.0 / 273.15);
+    const int maxDelaySamples = static_cast<int>(std::ceil(maxDistance / slowestSound * sampleRate));
+
+    delayLineSize = 1;
+    while (delayLineSize < maxDelaySamples + subBlockSize + 4)
+        delayLineSize <<= 1;
+
+    delayLines.assign(static_cast<size_t>(delayLineSize * preparedChannels), 0.0f);
+
+    // Positions as far back as the longest delay reaches
+    distanceHistory.assign(static_cast<size_t>(maxDelaySamples / controlInterval + 4), referenceDistance);
+
+    reset();
+}
+
+void GiantMovingSource::reset()
+{
+    // The delay lines keep their contents: process() reads anything older than clock 0 as silence
+    absorptionState.fill(0.0f);
+
+    // At rest at the target since forever
+    sourceDistance = targetDistance;
+    std::fill(distanceHistory.begin(), distanceHistory.end(), sourceDistance);
+    latestTick = 0;
+    emissionTick = -1;
+    clock = 0;
+    currentDelay = sourceDistance * sampleRate / speedOfSound;
+    currentAbsorption = absorptionCoefficient(sourceDistance);
+}
+
+void GiantMovingSource::setDistance(float meters)
+{
+    targetDistance = std::clamp(meters, minDistance, maxDistance);
+}
+
+float GiantMovingSource::speedOfSoundAt(float temperatureCelsius)
+{
+    return 331.3f * std::sqrt(1.0f + std::clamp(temperatureCelsius, -40.0f, 50.0f) / 273.15f);
+}
+
+void GiantMovingSource::setAir(float temperatureCelsius, float humidity)
+{
+    speedOfSound = speedOfSoundAt(temperatureCelsius);
+
+    // ~0.1 dB/m at 10 kHz in mild air (ISO 9613-1, 20 C, 50 %); dry air absorbs more
+    absorptionPerMeter = 0.0011f * (1.5f - std::clamp(humidity, 0.0f, 1.0f));
+}
+
+float GiantMovingSource::historyAt(int64_t tick) const
+{
+    const auto size = static_cast<int64_t>(distanceHistory.size());
+    tick = std::max(tick, latestTick - size + 1);   // Older than kept: the oldest
+    return distanceHistory[static_cast<size_t>(((tick % size) + size) % size)];
+}
+
+double GiantMovingSource::arrivalDelay(double time)
+{
+    const double samplesPerMeter = sampleRate / speedOfSound;
+    const int64_t oldestTick = latestTick - static_cast<int64_t>(distanceHistory.size()) + 1;
+
+    // Emission time only moves forward, so the cursor rarely moves more than a segment
+    emissionTick = std::clamp(emissionTick, oldestTick, latestTick - 1);
+
+    for (;;)
+    {
+        // On this segment r(tau) = r0 + slope * (tau - t0); solve delay = r(time - delay) / c
+        const double t0 = static_cast<double>(emissionTick * controlInterval);
+        const double r0 = historyAt(emissionTick);
+        const double slope = (historyAt(emissionTick + 1) - r0) / controlInterval;
+        const double delay = samplesPerMeter * (r0 + slope * (time - t0)) / (1.0 + slope * samplesPerMeter);
+        const double emission = time - delay;
+
+        if (emission < t0 && emissionTick > oldestTick)
+            --emissionTick;
+        else if (emission > t0 + controlInterval && emissionTick < latestTick - 1)
+            ++emissionTick;
+        else
+            return delay;
+    }
+}
+
+float GiantMovingSource::absorptionCoefficient(float pathMeters) const
+{
+    // Only the path beyond the reference distance: the engines are voiced for it
+    const float extraMeters = pathMeters - referenceDistance;
+    if (extraMeters <= 0.0f)
+        return 1.0f;
+
+    // Loss(f) = absorptionPerMeter * extra * (f / 1 kHz)^2 dB; cutoff where it is 3 dB
+    const double cutoff = 1000.0 * std::sqrt(3.0 / (absorptionPerMeter * extraMeters));
+    if (cutoff >= 0.45 * sampleRate)
+        return 1.0f;
+
+    return static_cast<float>(1.0 - std::exp(-twoPi * cutoff / sampleRate));
+}
+
+void GiantMovingSource::advanceMotion(int numSamples)
+{
+    const double samplesPerMeter = sampleRate / speedOfSound;
+    const float tickSeconds = static_cast<float>(controlInterval / sampleRate);
+    const float glide = 1.0f - std::exp(-tickSeconds / glideSeconds);
+    const float maxStep = maxMach * speedOfSound * tickSeconds;
+
+    int i = 0;
+    while (i < numSamples)
+    {
+        // Next control tick: the source glides on toward its target
+        if (clock >= latestTick * controlInterval)
+        {
+            sourceDistance += std::clamp((targetDistance - sourceDistance) * glide, -maxStep, maxStep);
+            ++latestTick;
+
+            const auto size = static_cast<int64_t>(distanceHistory.size());
+            distanceHistory[static_cast<size_t>(latestTick % size)] = sourceDistance;
+        }
+
+        const int segment = static_cast<int>(std::min<int64_t>(numSamples - i, latestTick * controlInterval - clock));
+        const double endDelay = arrivalDelay(static_cast<double>(clock + segment));
+        const double delayStep = (endDelay - currentDelay) / segment;
+
+        // 1/r over the path the arriving sound travelled
+        const float startGain = static_cast<float>(referenceDistance * samplesPerMeter / currentDelay);
+        const float gainStep = (static_cast<float>(referenceDistance * samplesPerMeter / endDelay) - startGain)
+                             / static_cast<float>(segment);
+
+        for (int j = 0; j < segment; ++j)
+        {
+            delayTrack[static_cast<size_t>(i + j)] = currentDelay + delayStep * (j + 1);
+            gainTrack[static_cast<size_t>(i + j)] = startGain + gainStep * static_cast<float>(j + 1);
+        }
+
+        currentDelay = endDelay;
+        clock += segment;
+        i += segment;
+    }
+}
+
+void GiantMovingSource::process(float* const* channels, int numChannels, int numSamples)
+{
+    numChannels = std::min(numChannels, preparedChannels);
+    if (numChannels <= 0 || delayLineSize == 0)
+        return;
+
+    const int mask = delayLineSize - 1;
+
+    for (int start = 0; start < numSamples; start += subBlockSize)
+    {
+        const int n = std::min(subBlockSize, numSamples - start);
+
+        // Motion once per sub-block, shared by every channel
+        advanceMotion(n);
+
+        const int64_t blockStart = clock - n;   // Samples since reset at the sub-block's first sample
+        const float absorption = currentAbsorption;
+        currentAbsorption = absorptionCoefficient(static_cast<float>(currentDelay * speedOfSound / sampleRate));
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            float* line = delayLines.data() + static_cast<size_t>(ch) * static_cast<size_t>(delayLineSize);
+            float* samples = channels[ch] + start;
+            float state = absorptionState[static_cast<size_t>(ch)];
+
+            // Whole sub-block in first: the shortest delay (1 m) is well over the 2 samples of look-ahead
+            for (int i = 0; i < n; ++i)
+                line[(writePosition + i) & mask] = samples[i];
+
+            for (int i = 0; i < n; ++i)
+            {
+                // Read (writePosition + i - delay) = index + fraction
+                const double delay = delayTrack[static_cast<size_t>(i)];
+                const double wholeDelay = std::ceil(delay);
+                const int index = writePosition + i - static_cast<int>(wholeDelay);
+                const float fraction = static_cast<float>(wholeDelay - delay);
+
+                float taps[4];
+                const int64_t firstTap = blockStart + i - static_cast<int64_t>(wholeDelay) - 1;
+                for (int k = 0; k < 4; ++k)
+                    taps[k] = (firstTap + k >= 0) ? line[(index - 1 + k) & mask] : 0.0f;
+
+                const float delayed = hermite(taps[0], taps[1], taps[2], taps[3], fraction);
+
+                state += absorption * (delayed - state);
+                samples[i] = state * gainTrack[static_cast<size_t>(i)];
+            }
+
+            absorptionState[static_cast<size_t>(ch)] = state;
+        }
+
+        writePosition = (writePosition + n) & mask;
+    }
+}
+
+}  // namespace DSP
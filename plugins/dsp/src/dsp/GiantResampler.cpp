@@ -0,0 +1,189 @@
+/*
+  ==============================================================================
+
+   GiantResampler.cpp
+   Integer-factor polyphase upsampler (engine rate -> host rate)
+
+  ==============================================================================
+*/
+
+#include "dsp/GiantResampler.h"
+#include <algorithm>
+#include <cmath>
+
+// Platform-specific SIMD includes (one 4-wide multiply-accumulate per 4 taps)
+#if defined(__ARM_NEON) || defined(__aarch64__)
+    #include <arm_neon.h>
+    #define DSP_SIMD_NEON_AVAILABLE 1
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define DSP_SIMD_SSE_AVAILABLE 1
+#endif
+
+namespace DSP {
+
+namespace {
+
+constexpr double kaiserBeta = 8.0;      // ~80 dB stopband
+
+/** Zeroth-order modified Bessel function (Kaiser window) */
+double besselI0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    const double halfX = 0.5 * x;
+
+    for (int k = 1; k < 32; ++k)
+    {
+        term *= halfX / static_cast<double>(k);
+        sum += term * term;
+        if (term * term < sum * 1.0e-12)
+            break;
+    }
+
+    return sum;
+}
+
+/** Dot product of tapsPerPhase coefficients with the newest-first history */
+inline float dotProduct(const float* coefficients, const float* samples)
+{
+#if DSP_SIMD_NEON_AVAILABLE
+    float32x4_t sum0 = vdupq_n_f32(0.0f);
+    float32x4_t sum1 = vdupq_n_f32(0.0f);
+    for (int k = 0; k < GiantUpsampler::tapsPerPhase; k += 8)
+    {
+        sum0 = vmlaq_f32(sum0, vld1q_f32(coefficients + k), vld1q_f32(samples + k));
+        sum1 = vmlaq_f32(sum1, vld1q_f32(coefficients + k + 4), vld1q_f32(samples + k + 4));
+    }
+    const float32x4_t sum = vaddq_f32(sum0, sum1);
+    float32x2_t pair = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    pair = vpadd_f32(pair, pair);
+    return vget_lane_f32(pair, 0);
+#elif DSP_SIMD_SSE_AVAILABLE
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    for (int k = 0; k < GiantUpsampler::tapsPerPhase; k += 8)
+    {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(coefficients + k), _mm_loadu_ps(samples + k)));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(coefficients + k + 4), _mm_loadu_ps(samples + k + 4)));
+    }
+    __m128 sum = _mm_add_ps(sum0, sum1);
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+#else
+    float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (int k = 0; k < GiantUpsampler::tapsPerPhase; k += 4)
+    {
+        sum[0] += coefficients[k + 0] * samples[k + 0];
+        sum[1] += coefficients[k + 1] * samples[k + 1];
+        sum[2] += coefficients[k + 2] * samples[k + 2];
+        sum[3] += coefficients[k + 3] * samples[k + 3];
+    }
+    return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+#endif
+}
+
+static_assert(GiantUpsampler::tapsPerPhase % 8 == 0, "dotProduct runs two 4-wide accumulators");
+
+}  // namespace
+
+//==============================================================================
+// GiantUpsampler Implementation
+//==============================================================================
+
+void GiantUpsampler::prepare(int newFactor)
+{
+    factor = std::clamp(newFactor, 1, maxFactor);
+
+    // Prototype lowpass at the output rate. The Kaiser transition is about
+    // 5 / tapsPerPhase of the engine rate wide, so the cutoff sits half of
+    // that below the engine's Nyquist and the stopband starts right at it.
+    // Centred on a whole sample (the one tap past the end is a window edge,
+    // ~0) so the latency reported to the host is exact.
+    const int length = factor * tapsPerPhase;
+    const double centre = 0.5 * static_cast<double>(length);
+    const double cutoff = 0.455 / static_cast<double>(factor);     // Cycles per output sample
+    const double windowNorm = besselI0(kaiserBeta);
+    const double pi = 3.14159265358979323846;
+
+    std::vector<double> prototype(static_cast<size_t>(length));
+    for (int i = 0; i < length; ++i)
+    {
+        const double t = static_cast<double>(i) - centre;
+        const double x = 2.0 * cutoff * t;
+        const double sinc = (std::abs(x) < 1.0e-12) ? 1.0 : std::sin(pi * x) / (pi * x);
+
+        const double r = t / centre;
+        const double window = besselI0(kaiserBeta * std::sqrt(std::max(0.0, 1.0 - r * r))) / windowNorm;
+
+        // Zero stuffing loses a factor of `factor` in level; the filter restores it
+        prototype[static_cast<size_t>(i)] = 2.0 * cutoff * sinc * window * static_cast<double>(factor);
+    }
+
+    // Phase p takes prototype taps p, p + factor, p + 2 * factor, ... against x[n], x[n - 1], ...
+    phaseCoefficients.assign(static_cast<size_t>(length), 0.0f);
+    for (int p = 0; p < factor; ++p)
+    {
+        for (int k = 0; k < tapsPerPhase; ++k)
+            phaseCoefficients[static_cast<size_t>(p * tapsPerPhase + k)]
+                = static_cast<float>(prototype[static_cast<size_t>(k * factor + p)]);
+    }
+
+    for (auto& channel : history)
+        channel.assign(static_cast<size_t>(2 * tapsPerPhase), 0.0f);
+
+    reset();
+}
+
+void GiantUpsampler::reset()
+{
+    for (auto& channel : history)
+        std::fill(channel.begin(), channel.end(), 0.0f);
+
+    historyPosition = 0;
+}
+
+int GiantUpsampler::getLatencySamples() const
+{
+    // Linear phase, centred on tap length / 2
+    return (factor > 1) ? (factor * tapsPerPhase) / 2 : 0;
+}
+
+void GiantUpsampler::process(const float* const* input, float* const* output, int numChannels, int numInputSamples)
+{
+    numChannels = std::min(numChannels, maxChannels);
+
+    if (factor == 1)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+            std::copy(input[ch], input[ch] + numInputSamples, output[ch]);
+        return;
+    }
+
+    int position = historyPosition;
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        float* const ring = history[static_cast<size_t>(ch)].data();
+        const float* in = input[ch];
+        float* out = output[ch];
+        position = historyPosition;
+
+        for (int n = 0; n < numInputSamples; ++n)
+        {
+            // Newest sample goes in front; the mirror keeps the window contiguous
+            position = (position == 0) ? tapsPerPhase - 1 : position - 1;
+            ring[position] = in[n];
+            ring[position + tapsPerPhase] = in[n];
+
+            const float* window = ring + position;
+            for (int p = 0; p < factor; ++p)
+                *out++ = dotProduct(phaseCoefficients.data() + p * tapsPerPhase, window);
+        }
+    }
+
+    historyPosition = position;
+}
+
+}  // namespace DSP
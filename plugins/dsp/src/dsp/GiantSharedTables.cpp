@@ -0,0 +1,314 @@
+/*
+  ==============================================================================
+
+   GiantSharedTables.cpp
+   Process-wide read-only DSP tables for the Giant Instruments engines
+
+  ==============================================================================
+*/
+
+#include "dsp/GiantSharedTables.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace DSP {
+
+namespace {
+
+constexpr float pi = 3.14159265358979323846f;
+
+//==============================================================================
+// Source data (sample-rate independent)
+//==============================================================================
+
+struct HornFormantPreset
+{
+    int count;
+    float frequency[GiantSharedTables::maxHornFormants];
+    float amplitude[GiantSharedTables::maxHornFormants];
+    float bandwidth[GiantSharedTables::maxHornFormants];
+};
+
+// Indexed by HornFormantShaper::HornType
+const HornFormantPreset hornFormantPresets[GiantSharedTables::numHornTypes] =
+{
+    // Trumpet: bright, focused
+    { 3, { 1200.0f, 2500.0f, 4000.0f, 0.0f }, { 1.0f, 0.7f, 0.4f, 0.0f }, { 1.5f, 2.0f, 2.5f, 0.0f } },
+    // Trombone: warm, broad
+    { 3, { 500.0f, 1500.0f, 3000.0f, 0.0f },  { 1.0f, 0.8f, 0.5f, 0.0f }, { 1.2f, 1.8f, 2.2f, 0.0f } },
+    // Tuba: dark, massive
+    { 4, { 80.0f, 400.0f, 1200.0f, 2500.0f }, { 1.0f, 0.9f, 0.6f, 0.3f }, { 0.8f, 1.2f, 1.8f, 2.5f } },
+    // French horn: mellow, complex
+    { 4, { 200.0f, 800.0f, 2000.0f, 3500.0f }, { 1.0f, 0.8f, 0.6f, 0.4f }, { 1.0f, 1.5f, 2.0f, 2.8f } },
+    // Saxophone: reed character
+    { 3, { 400.0f, 1500.0f, 3000.0f, 0.0f },  { 1.0f, 0.7f, 0.5f, 0.0f }, { 1.3f, 1.8f, 2.2f, 0.0f } },
+    // Custom: neutral
+    { 3, { 500.0f, 1500.0f, 3000.0f, 0.0f },  { 1.0f, 0.7f, 0.4f, 0.0f }, { 1.5f, 2.0f, 2.5f, 0.0f } }
+};
+
+// Standard vowel formants (adult male reference)
+const GiantSharedTables::VowelFormants standardVowelTable[GiantSharedTables::numVowels] =
+{
+    // Vowel     F1     F2      F3      F4     B1     B2     B3     B4
+    { "Ah",     730,   1090,   2440,   3400,  80,    90,    120,   130 },
+    { "Eh",     530,   1840,   2480,   3320,  70,    100,   110,   120 },
+    { "Ee",     270,   2290,   3010,   3340,  60,    90,    100,   120 },
+    { "Oh",     570,   840,    2410,   3370,  80,    80,    110,   130 },
+    { "Oo",     300,   870,    2240,   3370,  70,    80,    100,   120 },
+    { "Uh",     640,   1190,   2390,   3370,  70,    90,    110,   130 },
+    { "Ih",     390,   2300,   2980,   3360,  60,    90,    100,   120 }
+};
+
+// Giant-scaled vowel formants (lower frequencies, wider bandwidths)
+const GiantSharedTables::VowelFormants giantVowelTable[GiantSharedTables::numVowels] =
+{
+    // Vowel     F1     F2      F3      F4     B1     B2     B3     B4
+    { "Ah",     440,   650,    1460,   2040,  120,   135,   180,   195 },
+    { "Eh",     320,   1100,   1490,   1990,  105,   150,   165,   180 },
+    { "Ee",     160,   1370,   1810,   2000,  90,    135,   150,   180 },
+    { "Oh",     340,   500,    1450,   2020,  120,   120,   165,   195 },
+    { "Oo",     180,   520,    1340,   2020,  105,   120,   150,   180 },
+    { "Uh",     380,   710,    1430,   2020,  105,   135,   165,   195 },
+    { "Ih",     230,   1380,   1790,   2020,  90,    135,   150,   180 }
+};
+
+// Mallet character per StrikeExciter::MalletType (Soft, Medium, Hard, Metal)
+constexpr float malletContactMs[GiantSharedTables::numMalletTypes] = { 2.5f, 1.2f, 0.6f, 0.25f };
+constexpr float malletTickHz[GiantSharedTables::numMalletTypes]    = { 0.0f, 2500.0f, 4500.0f, 7500.0f };
+constexpr float malletTickGain[GiantSharedTables::numMalletTypes]  = { 0.0f, 0.1f, 0.4f, 0.8f };
+constexpr float malletNoiseHz[GiantSharedTables::numMalletTypes]   = { 1200.0f, 3000.0f, 6000.0f, 12000.0f };
+constexpr float malletNoiseGain[GiantSharedTables::numMalletTypes] = { 0.3f, 0.5f, 0.7f, 1.0f };
+
+// Longest burst: softest mallet, softest layer, gentlest hit, plus ring-out
+constexpr double malletBurstMs = 4.0;
+
+/** Scale a burst so the area under |x| is one, keeping layers level-matched */
+void normalizeArea(float* burst, int length)
+{
+    float area = 0.0f;
+    for (int n = 0; n < length; ++n)
+        area += std::abs(burst[n]);
+
+    if (area > 0.0f)
+    {
+        for (int n = 0; n < length; ++n)
+            burst[n] /= area;
+    }
+}
+
+//==============================================================================
+// Registry
+//==============================================================================
+
+std::mutex& registryLock()
+{
+    static std::mutex lock;
+    return lock;
+}
+
+std::map<double, std::weak_ptr<const GiantSharedTables>>& registry()
+{
+    static std::map<double, std::weak_ptr<const GiantSharedTables>> tables;
+    return tables;
+}
+
+int clampIndex(int index, int count)
+{
+    return std::clamp(index, 0, count - 1);
+}
+
+size_t malletContactOffset(int type, int hardness, int velocity, int burstLength)
+{
+    const int index = (clampIndex(type, GiantSharedTables::numMalletTypes) * GiantSharedTables::numMalletHardnessLayers
+                       + clampIndex(hardness, GiantSharedTables::numMalletHardnessLayers))
+                      * GiantSharedTables::numMalletVelocityLayers
+                      + clampIndex(velocity, GiantSharedTables::numMalletVelocityLayers);
+    return static_cast<size_t>(index) * static_cast<size_t>(burstLength);
+}
+
+size_t malletNoiseOffset(int type, int hardness, int burstLength)
+{
+    const int index = clampIndex(type, GiantSharedTables::numMalletTypes) * GiantSharedTables::numMalletHardnessLayers
+                      + clampIndex(hardness, GiantSharedTables::numMalletHardnessLayers);
+    return static_cast<size_t>(index) * static_cast<size_t>(burstLength);
+}
+
+} // namespace
+
+//==============================================================================
+// GiantSharedTables Implementation
+//==============================================================================
+
+GiantSharedTables::GiantSharedTables(double sampleRate)
+    : sr(sampleRate)
+{
+    for (int type = 0; type < numHornTypes; ++type)
+        hornFormants[type] = buildHornFormants(type, sr);
+
+    buildMalletLibrary();
+}
+
+std::shared_ptr<const GiantSharedTables> GiantSharedTables::acquire(double sampleRate)
+{
+    if (sampleRate <= 0.0)
+        sampleRate = 48000.0;
+
+    std::lock_guard<std::mutex> guard(registryLock());
+    auto& tables = registry();
+
+    if (auto existing = tables[sampleRate].lock())
+        return existing;
+
+    // Drop entries whose last holder has gone while we hold the lock anyway
+    for (auto it = tables.begin(); it != tables.end();)
+    {
+        if (it->first != sampleRate && it->second.expired())
+            it = tables.erase(it);
+        else
+            ++it;
+    }
+
+    std::shared_ptr<const GiantSharedTables> created(new GiantSharedTables(sampleRate));
+    tables[sampleRate] = created;
+    return created;
+}
+
+int GiantSharedTables::getLiveTableCount()
+{
+    std::lock_guard<std::mutex> guard(registryLock());
+
+    int count = 0;
+    for (const auto& entry : registry())
+    {
+        if (!entry.second.expired())
+            ++count;
+    }
+    return count;
+}
+
+const GiantSharedTables::HornFormantSet& GiantSharedTables::getHornFormants(int hornType) const
+{
+    return hornFormants[clampIndex(hornType, numHornTypes)];
+}
+
+GiantSharedTables::HornFormantSet GiantSharedTables::buildHornFormants(int hornType, double sampleRate)
+{
+    const HornFormantPreset& preset = hornFormantPresets[clampIndex(hornType, numHornTypes)];
+
+    HornFormantSet set;
+    set.count = preset.count;
+
+    for (int i = 0; i < preset.count; ++i)
+    {
+        HornFormant& f = set.formants[i];
+        f.frequency = preset.frequency[i];
+        f.amplitude = preset.amplitude[i];
+        f.bandwidth = preset.bandwidth[i];
+
+        // Resonator radius and phase step, previously evaluated every sample
+        float bw = f.bandwidth * 100.0f;
+        f.pole = std::exp(-bw / (f.frequency + bw));
+        f.phaseIncrement = f.frequency * 2.0f * pi / static_cast<float>(sampleRate);
+    }
+
+    return set;
+}
+
+const float* GiantSharedTables::getMalletContact(int malletType, int hardnessLayer, int velocityLayer) const
+{
+    return malletContact.data() + malletContactOffset(malletType, hardnessLayer, velocityLayer, malletBurstLength);
+}
+
+const float* GiantSharedTables::getMalletNoise(int malletType, int hardnessLayer) const
+{
+    return malletNoise.data() + malletNoiseOffset(malletType, hardnessLayer, malletBurstLength);
+}
+
+void GiantSharedTables::buildMalletLibrary()
+{
+    const float rate = static_cast<float>(sr);
+    const float maxBandHz = 0.35f * rate;   // Keep tick and noise well below Nyquist
+
+    malletBurstLength = std::max(16, static_cast<int>(std::ceil(malletBurstMs * 0.001 * sr)));
+    malletContact.assign(static_cast<size_t>(numMalletTypes * numMalletHardnessLayers
+                                             * numMalletVelocityLayers * malletBurstLength), 0.0f);
+    malletNoise.assign(static_cast<size_t>(numMalletTypes * numMalletHardnessLayers * malletBurstLength), 0.0f);
+
+    uint32_t noiseState = 0x9E3779B9u;  // Fixed seed: identical bursts on every run
+
+    for (int type = 0; type < numMalletTypes; ++type)
+    {
+        for (int h = 0; h < numMalletHardnessLayers; ++h)
+        {
+            const float hardness = static_cast<float>(h) / (numMalletHardnessLayers - 1);
+
+            for (int v = 0; v < numMalletVelocityLayers; ++v)
+            {
+                const float velocity = static_cast<float>(v) / (numMalletVelocityLayers - 1);
+                float* burst = malletContact.data() + malletContactOffset(type, h, v, malletBurstLength);
+
+                // Harder mallets and harder hits shorten the contact (Hertzian
+                // contact), which is what moves energy up the spectrum. Never
+                // shorter than 4 samples so the pulse itself stays band-limited.
+                const float contactMs = malletContactMs[type] * (1.25f - 0.5f * hardness)
+                                        * (1.15f - 0.3f * velocity);
+                const int contactSamples = std::clamp(static_cast<int>(contactMs * 0.001f * rate),
+                                                      4, malletBurstLength);
+
+                for (int n = 0; n < contactSamples; ++n)
+                    burst[n] = std::sin(pi * (static_cast<float>(n) + 0.5f) / contactSamples);
+
+                // Beater tick: Hann-windowed partial over twice the contact time
+                const float tickHz = std::min(malletTickHz[type] * (0.75f + 0.5f * hardness), maxBandHz);
+                const float tickGain = malletTickGain[type] * (0.5f + 0.5f * velocity);
+                const int tickSamples = std::min(malletBurstLength, contactSamples * 2);
+
+                if (tickGain > 0.0f)
+                {
+                    for (int n = 0; n < tickSamples; ++n)
+                    {
+                        const float window = 0.5f - 0.5f * std::cos(2.0f * pi * n / tickSamples);
+                        burst[n] += tickGain * window * std::sin(2.0f * pi * tickHz * n / rate);
+                    }
+                }
+
+                normalizeArea(burst, malletBurstLength);
+            }
+
+            // Surface noise: white noise through a one-pole lowpass set by the
+            // mallet's colour, under an exponential envelope
+            float* noise = malletNoise.data() + malletNoiseOffset(type, h, malletBurstLength);
+            const float cutoffHz = std::min(malletNoiseHz[type] * (0.5f + hardness), maxBandHz);
+            const float coeff = 1.0f - std::exp(-2.0f * pi * cutoffHz / rate);
+            const float envelopeSamples = 0.25f * malletBurstLength;
+            float state = 0.0f;
+
+            for (int n = 0; n < malletBurstLength; ++n)
+            {
+                noiseState = noiseState * 1664525u + 1013904223u;
+                const float white = static_cast<float>(noiseState >> 8) * (2.0f / 16777216.0f) - 1.0f;
+                state += coeff * (white - state);
+                noise[n] = state * std::exp(-static_cast<float>(n) / envelopeSamples);
+            }
+
+            normalizeArea(noise, malletBurstLength);
+            for (int n = 0; n < malletBurstLength; ++n)
+                noise[n] *= malletNoiseGain[type];
+        }
+    }
+}
+
+const GiantSharedTables::VowelFormants& GiantSharedTables::getStandardVowel(int vowelIndex)
+{
+    return standardVowelTable[clampIndex(vowelIndex, numVowels)];
+}
+
+const GiantSharedTables::VowelFormants& GiantSharedTables::getGiantVowel(int vowelIndex)
+{
+    return giantVowelTable[clampIndex(vowelIndex, numVowels)];
+}
+
+}  // namespace DSP
@@ -0,0 +1,257 @@
+/*
+  ==============================================================================
+
+   GiantSpatialEncoder.cpp
+   Ambisonic and speaker-bed encoding for the Giant Instruments engines
+
+  ==============================================================================
+*/
+
+#include "dsp/GiantSpatialEncoder.h"
+#include <algorithm>
+#include <cmath>
+
+// Platform-specific SIMD includes (gain ramp applied 4 samples at a time)
+#if defined(__ARM_NEON) || defined(__aarch64__)
+    #include <arm_neon.h>
+    #define DSP_SIMD_NEON_AVAILABLE 1
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define DSP_SIMD_SSE_AVAILABLE 1
+#endif
+
+namespace DSP {
+
+namespace {
+
+constexpr float pi = 3.14159265358979323846f;
+constexpr float degreesToRadians = pi / 180.0f;
+constexpr float heightRingMinimumDegrees = 20.0f;      // Speakers above this form the height ring
+
+/** Wrap an angle to [0, 2 pi) */
+float wrapPositive(float radians)
+{
+    const float twoPi = 2.0f * pi;
+    radians = std::fmod(radians, twoPi);
+    return (radians < 0.0f) ? radians + twoPi : radians;
+}
+
+/** outputs += signal * gain, gain ramping linearly from start by step per sample */
+void accumulateRamped(float* output, const float* signal, float start, float step, int numSamples)
+{
+    int i = 0;
+
+#if DSP_SIMD_NEON_AVAILABLE
+    const float offsets[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    float32x4_t gain = vmlaq_n_f32(vdupq_n_f32(start), vld1q_f32(offsets), step);
+    const float32x4_t increment = vdupq_n_f32(4.0f * step);
+    for (; i + 4 <= numSamples; i += 4)
+    {
+        vst1q_f32(output + i, vmlaq_f32(vld1q_f32(output + i), vld1q_f32(signal + i), gain));
+        gain = vaddq_f32(gain, increment);
+    }
+#elif DSP_SIMD_SSE_AVAILABLE
+    __m128 gain = _mm_add_ps(_mm_set1_ps(start), _mm_mul_ps(_mm_set_ps(4.0f, 3.0f, 2.0f, 1.0f), _mm_set1_ps(step)));
+    const __m128 increment = _mm_set1_ps(4.0f * step);
+    for (; i + 4 <= numSamples; i += 4)
+    {
+        _mm_storeu_ps(output + i, _mm_add_ps(_mm_loadu_ps(output + i), _mm_mul_ps(_mm_loadu_ps(signal + i), gain)));
+        gain = _mm_add_ps(gain, increment);
+    }
+#endif
+
+    for (; i < numSamples; ++i)
+        output[i] += signal[i] * (start + step * static_cast<float>(i + 1));
+}
+
+}  // namespace
+
+//==============================================================================
+// GiantSpatialEncoder Implementation
+//==============================================================================
+
+void GiantSpatialEncoder::configureAmbisonic(int order)
+{
+    ambisonicOrder = std::clamp(order, 0, maxAmbisonicOrder);
+    numChannels = (ambisonicOrder + 1) * (ambisonicOrder + 1);
+    earLevel = {};
+    height = {};
+}
+
+void GiantSpatialEncoder::configureSpeakers(const std::vector<GiantSpeaker>& speakers)
+{
+    ambisonicOrder = -1;
+    numChannels = std::min(static_cast<int>(speakers.size()), maxChannels);
+    earLevel = {};
+    height = {};
+
+    for (Ring* ring : { &earLevel, &height })
+    {
+        const bool isHeight = (ring == &height);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const GiantSpeaker& speaker = speakers[static_cast<size_t>(ch)];
+            if (!speaker.lfe && (speaker.elevationDegrees >= heightRingMinimumDegrees) == isHeight)
+                ring->channels.push_back(ch);
+        }
+
+        std::sort(ring->channels.begin(), ring->channels.end(), [&speakers](int a, int b)
+        {
+            return wrapPositive(speakers[static_cast<size_t>(a)].azimuthDegrees * degreesToRadians)
+                 < wrapPositive(speakers[static_cast<size_t>(b)].azimuthDegrees * degreesToRadians);
+        });
+
+        for (int ch : ring->channels)
+            ring->azimuths.push_back(wrapPositive(speakers[static_cast<size_t>(ch)].azimuthDegrees * degreesToRadians));
+    }
+}
+
+void GiantSpatialEncoder::computeGains(float azimuthDegrees, float elevationDegrees, float* gains) const
+{
+    std::fill(gains, gains + numChannels, 0.0f);
+
+    const float azimuth = azimuthDegrees * degreesToRadians;
+    const float elevation = std::clamp(elevationDegrees, -90.0f, 90.0f) * degreesToRadians;
+
+    if (ambisonicOrder >= 0)
+    {
+        // Real spherical harmonics, ACN order, SN3D
+        const float x = std::cos(elevation) * std::cos(azimuth);
+        const float y = std::cos(elevation) * std::sin(azimuth);
+        const float z = std::sin(elevation);
+
+        gains[0] = 1.0f;
+        if (ambisonicOrder >= 1)
+        {
+            gains[1] = y;
+            gains[2] = z;
+            gains[3] = x;
+        }
+        if (ambisonicOrder >= 2)
+        {
+            const float sqrt3 = std::sqrt(3.0f);
+            gains[4] = sqrt3 * x * y;
+            gains[5] = sqrt3 * y * z;
+            gains[6] = 0.5f * (3.0f * z * z - 1.0f);
+            gains[7] = sqrt3 * x * z;
+            gains[8] = 0.5f * sqrt3 * (x * x - y * y);
+        }
+        if (ambisonicOrder >= 3)
+        {
+            const float sqrt5_8 = std::sqrt(5.0f / 8.0f);
+            const float sqrt3_8 = std::sqrt(3.0f / 8.0f);
+            const float sqrt15 = std::sqrt(15.0f);
+            gains[9] = sqrt5_8 * y * (3.0f * x * x - y * y);
+            gains[10] = sqrt15 * x * y * z;
+            gains[11] = sqrt3_8 * y * (5.0f * z * z - 1.0f);
+            gains[12] = 0.5f * z * (5.0f * z * z - 3.0f);
+            gains[13] = sqrt3_8 * x * (5.0f * z * z - 1.0f);
+            gains[14] = 0.5f * sqrt15 * z * (x * x - y * y);
+            gains[15] = sqrt5_8 * x * (x * x - 3.0f * y * y);
+        }
+        return;
+    }
+
+    // Bed: ear-level pair crossfaded (constant power) into the height pair
+    float heightBlend = 0.0f;
+    if (!height.channels.empty())
+        heightBlend = earLevel.channels.empty() ? 1.0f
+                                                : std::clamp(elevationDegrees / 45.0f, 0.0f, 1.0f);
+
+    panOnRing(earLevel, azimuth, std::cos(0.5f * pi * heightBlend), gains);
+    panOnRing(height, azimuth, std::sin(0.5f * pi * heightBlend), gains);
+}
+
+void GiantSpatialEncoder::panOnRing(const Ring& ring, float azimuth, float gain, float* gains) const
+{
+    const int count = static_cast<int>(ring.channels.size());
+    if (count == 0 || gain <= 0.0f)
+        return;
+
+    if (count == 1)
+    {
+        gains[ring.channels[0]] += gain;
+        return;
+    }
+
+    const float target = wrapPositive(azimuth);
+
+    for (int i = 0; i < count; ++i)
+    {
+        const int j = (i + 1) % count;
+        float arc = wrapPositive(ring.azimuths[static_cast<size_t>(j)] - ring.azimuths[static_cast<size_t>(i)]);
+        if (arc <= 0.0f)
+            arc = 2.0f * pi;
+
+        const float offset = wrapPositive(target - ring.azimuths[static_cast<size_t>(i)]);
+        if (offset > arc)
+            continue;
+
+        // Pairwise VBAP; gaps of half a circle or more fall back to a constant-power fraction
+        float first, second;
+        if (arc < pi - 1.0e-3f)
+        {
+            first = std::sin(arc - offset);
+            second = std::sin(offset);
+        }
+        else
+        {
+            first = std::cos(0.5f * pi * offset / arc);
+            second = std::sin(0.5f * pi * offset / arc);
+        }
+
+        const float norm = gain / std::max(1.0e-9f, std::sqrt(first * first + second * second));
+        gains[ring.channels[static_cast<size_t>(i)]] += first * norm;
+        gains[ring.channels[static_cast<size_t>(j)]] += second * norm;
+        return;
+    }
+}
+
+//==============================================================================
+// GiantSpatialMixer Implementation
+//==============================================================================
+
+void GiantSpatialMixer::prepare(int channels, int sources)
+{
+    numChannels = std::max(0, channels);
+    maxSources = std::max(0, sources);
+    currentGains.assign(static_cast<size_t>(numChannels * maxSources), 0.0f);
+    started.assign(static_cast<size_t>(maxSources), false);
+}
+
+void GiantSpatialMixer::reset()
+{
+    std::fill(currentGains.begin(), currentGains.end(), 0.0f);
+    std::fill(started.begin(), started.end(), false);
+}
+
+void GiantSpatialMixer::addSource(int sourceId, const float* signal, const float* targetGains, bool snap,
+                                  float* const* outputs, int numSamples)
+{
+    if (sourceId < 0 || sourceId >= maxSources || numSamples <= 0)
+        return;
+
+    float* gains = currentGains.data() + sourceId * numChannels;
+    if (snap || !started[static_cast<size_t>(sourceId)])
+    {
+        std::copy(targetGains, targetGains + numChannels, gains);
+        started[static_cast<size_t>(sourceId)] = true;
+    }
+
+    const float rampScale = 1.0f / static_cast<float>(numSamples);
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const float start = gains[ch];
+        const float target = targetGains[ch];
+
+        // Most bed speakers are silent for any one source
+        if (start != 0.0f || target != 0.0f)
+            accumulateRamped(outputs[ch], signal, start, (target - start) * rampScale, numSamples);
+
+        gains[ch] = target;
+    }
+}
+
+}  // namespace DSP
@@ -129,14 +129,21 @@ GiantInstrumentsPluginEditor::GiantInstrumentsPluginEditor(GiantInstrumentsPlugi
     updateInfoDisplay();
 
     //==========================================================================
-    // Giant Visual (placeholder for now)
+    // Giant Visual (live meters)
     //==========================================================================
 
-    giantVisual = std::make_unique<juce::Component>();
+    giantVisual = std::make_unique<GiantMeterView>();
     addAndMakeVisible(giantVisual.get());
+
+    processor.getMeterFeed().setScopeEnabled(true);
+    startTimerHz(30);
 }
 
-GiantInstrumentsPluginEditor::~GiantInstrumentsPluginEditor() = default;
+GiantInstrumentsPluginEditor::~GiantInstrumentsPluginEditor()
+{
+    stopTimer();
+    processor.getMeterFeed().setScopeEnabled(false);
+}
 
 //==============================================================================
 // Graphics
@@ -290,6 +297,13 @@ void GiantInstrumentsPluginEditor::updateInfoDisplay()
     infoDisplay->setText(info, false);
 }
 
+void GiantInstrumentsPluginEditor::timerCallback()
+{
+    // Only the newest frame matters; blocks in between are skipped
+    if (const auto* frame = processor.getMeterFeed().poll())
+        giantVisual->setFrame(*frame);
+}
+
 void GiantInstrumentsPluginEditor::refreshPresetList()
 {
     presetSelector->clear();
@@ -308,3 +322,83 @@ void GiantInstrumentsPluginEditor::refreshPresetList()
         presetSelector->setSelectedId(currentProgram + 1, juce::dontSendNotification);
     }
 }
+
+//==============================================================================
+// GiantMeterView Implementation
+//==============================================================================
+
+void GiantMeterView::setFrame(const DSP::GiantMeterFrame& newFrame)
+{
+    frame = newFrame;
+
+    float loudest = 0.0f;
+    for (int i = 0; i < frame.numVoices; ++i)
+        loudest = juce::jmax(loudest, frame.voiceEnergy[static_cast<size_t>(i)]);
+    voiceScale = juce::jmax(loudest, voiceScale * 0.97f, 1.0e-6f);
+
+    repaint();
+}
+
+void GiantMeterView::paint(juce::Graphics& g)
+{
+    auto area = getLocalBounds().reduced(8);
+    g.fillAll(juce::Colours::darkgrey.darker());
+
+    // Channel peak (outline) and RMS (fill)
+    auto levels = area.removeFromLeft(40);
+    const int barWidth = levels.getWidth() / juce::jmax(1, frame.numChannels);
+    for (int ch = 0; ch < frame.numChannels; ++ch)
+    {
+        auto bar = levels.removeFromLeft(barWidth).reduced(2, 0).toFloat();
+        const float rmsHeight = bar.getHeight() * juce::jlimit(0.0f, 1.0f, frame.rms[ch]);
+        const float peakHeight = bar.getHeight() * juce::jlimit(0.0f, 1.0f, frame.peak[ch]);
+
+        g.setColour(juce::Colours::orange);
+        g.fillRect(bar.withTop(bar.getBottom() - rmsHeight));
+        g.setColour(juce::Colours::white);
+        g.drawHorizontalLine(juce::roundToInt(bar.getBottom() - peakHeight), bar.getX(), bar.getRight());
+    }
+
+    area.removeFromLeft(8);
+
+    // Per-voice energy
+    auto voicesArea = area.removeFromTop(area.getHeight() / 2).toFloat();
+    g.setColour(juce::Colours::white);
+    g.drawText("Voices: " + juce::String(frame.activeVoices), voicesArea.removeFromTop(18.0f),
+               juce::Justification::centredLeft, false);
+
+    if (frame.numVoices > 0)
+    {
+        const float slotWidth = voicesArea.getWidth() / static_cast<float>(frame.numVoices);
+        for (int i = 0; i < frame.numVoices; ++i)
+        {
+            const float energy = frame.voiceEnergy[static_cast<size_t>(i)] / voiceScale;
+            auto slot = voicesArea.withX(voicesArea.getX() + slotWidth * static_cast<float>(i))
+                                  .withWidth(slotWidth).reduced(1.0f, 0.0f);
+            g.setColour(juce::Colours::skyblue);
+            g.fillRect(slot.withTop(slot.getBottom() - slot.getHeight() * juce::jlimit(0.0f, 1.0f, energy)));
+        }
+    }
+
+    // Scope
+    if (frame.hasScope)
+    {
+        auto scopeArea = area.reduced(0, 4).toFloat();
+        const float step = scopeArea.getWidth() / static_cast<float>(DSP::GiantMeterFrame::scopeSize - 1);
+
+        juce::Path scope;
+        for (int i = 0; i < DSP::GiantMeterFrame::scopeSize; ++i)
+        {
+            const float x = scopeArea.getX() + step * static_cast<float>(i);
+            const float y = scopeArea.getCentreY()
+                          - 0.5f * scopeArea.getHeight() * juce::jlimit(-1.0f, 1.0f, frame.scope[static_cast<size_t>(i)]);
+            if (i == 0)
+                scope.startNewSubPath(x, y);
+            else
+                scope.lineTo(x, y);
+        }
+
+        g.setColour(juce::Colours::lightgreen);
+        g.strokePath(scope, juce::PathStrokeType(1.5f));
+    }
+}
@@ -16,11 +16,32 @@
 #include <juce_audio_utils/juce_audio_utils.h>
 #include "GiantInstrumentsPluginProcessor.h"
 
+//==============================================================================
+// Giant Meter View
+//==============================================================================
+
+/**
+ * Live levels, per-voice energy and scope from the processor's meter feed
+ */
+class GiantMeterView : public juce::Component
+{
+public:
+    /** Show a newly polled frame (message thread) */
+    void setFrame(const DSP::GiantMeterFrame& newFrame);
+
+    void paint(juce::Graphics&) override;
+
+private:
+    DSP::GiantMeterFrame frame;
+    float voiceScale = 1.0f;    // Decaying max of voice energies (engine units differ)
+};
+
 //==============================================================================
 // Giant Instruments Plugin Editor
 //==============================================================================
 
-class GiantInstrumentsPluginEditor : public juce::AudioProcessorEditor
+class GiantInstrumentsPluginEditor : public juce::AudioProcessorEditor,
+                                     private juce::Timer
 {
 public:
     GiantInstrumentsPluginEditor(GiantInstrumentsPluginProcessor&);
@@ -65,8 +86,8 @@ private:
     // Info display (shows current instrument info)
     std::unique_ptr<juce::TextEditor> infoDisplay;
 
-    // Giant instrument visual
-    std::unique_ptr<juce::Component> giantVisual;
+    // Giant instrument visual (live meters)
+    std::unique_ptr<GiantMeterView> giantVisual;
 
     //==========================================================================
     // Callbacks
@@ -76,5 +97,8 @@ private:
     void updateInfoDisplay();
     void refreshPresetList();
 
+    /** Poll the meter feed */
+    void timerCallback() override;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GiantInstrumentsPluginEditor)
 };
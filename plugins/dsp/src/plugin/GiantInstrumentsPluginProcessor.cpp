@@ -13,6 +13,41 @@
 #include "GiantInstrumentsPluginProcessor.h"
 #include "GiantInstrumentsPluginEditor.h"
 
+namespace
+{
+    /** Bed speaker direction of a host channel (unknown channels stay silent) */
+    DSP::GiantSpeaker speakerForChannel(juce::AudioChannelSet::ChannelType type)
+    {
+        using Channel = juce::AudioChannelSet;
+
+        switch (type)
+        {
+            case Channel::left:                 return { 30.0f, 0.0f };
+            case Channel::right:                return { -30.0f, 0.0f };
+            case Channel::centre:               return { 0.0f, 0.0f };
+            case Channel::leftCentre:           return { 15.0f, 0.0f };
+            case Channel::rightCentre:          return { -15.0f, 0.0f };
+            case Channel::wideLeft:             return { 60.0f, 0.0f };
+            case Channel::wideRight:            return { -60.0f, 0.0f };
+            case Channel::leftSurroundSide:     return { 90.0f, 0.0f };
+            case Channel::rightSurroundSide:    return { -90.0f, 0.0f };
+            case Channel::leftSurround:         return { 110.0f, 0.0f };
+            case Channel::rightSurround:        return { -110.0f, 0.0f };
+            case Channel::leftSurroundRear:     return { 150.0f, 0.0f };
+            case Channel::rightSurroundRear:    return { -150.0f, 0.0f };
+            case Channel::centreSurround:       return { 180.0f, 0.0f };
+            case Channel::topFrontLeft:         return { 45.0f, 45.0f };
+            case Channel::topFrontCentre:       return { 0.0f, 45.0f };
+            case Channel::topFrontRight:        return { -45.0f, 45.0f };
+            case Channel::topRearLeft:          return { 135.0f, 45.0f };
+            case Channel::topRearCentre:        return { 180.0f, 45.0f };
+            case Channel::topRearRight:         return { -135.0f, 45.0f };
+            case Channel::topMiddle:            return { 0.0f, 90.0f };
+            default:                            return { 0.0f, 0.0f, true };    // LFE and unknown
+        }
+    }
+}
+
 //==============================================================================
 // GiantInstrumentsPluginProcessor Implementation
 //==============================================================================
@@ -29,6 +64,8 @@ GiantInstrumentsPluginProcessor::GiantInstrumentsPluginProcessor()
                        )
 #endif
 {
+    instantiationTimeMs = juce::Time::getMillisecondCounterHiRes();
+
     // Initialize MPE Support (Full MPE for Giant Instruments)
     mpeSupport = std::make_unique<MPEUniversalSupport>();
 
@@ -43,9 +80,11 @@ GiantInstrumentsPluginProcessor::GiantInstrumentsPluginProcessor()
 
     // Initialize Microtonal Tuning Manager
     tuningManager = std::make_unique<MicrotonalTuningManager>();
+    publishTuning();
+    publishedModSettings.publish(std::make_unique<const DSP::GiantModSettings>(modSettings));
 
     // Create initial instrument (Giant Strings as default)
-    currentInstrument = createInstrument(instrumentType);
+    publishInstrument(createInstrument(instrumentType));
 
     // Load factory presets
     loadFactoryPresets();
@@ -59,28 +98,63 @@ GiantInstrumentsPluginProcessor::~GiantInstrumentsPluginProcessor() = default;
 
 void GiantInstrumentsPluginProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    juce::ScopedLock lock(dspLock);
-
-    if (currentInstrument)
+    // Never concurrent with processBlock (the host stops processing first),
+    // so the engine and the render state are set up in place
+    const juce::ScopedLock warmUpGuard(warmUpLock);
+
+    // Engine rate: the host rate, or the integer division nearest the internal target
+    const int factor = (internalRateTarget > 0.0)
+                     ? juce::jlimit(1, DSP::GiantUpsampler::maxFactor,
+                                    juce::roundToInt(sampleRate / internalRateTarget))
+                     : 1;
+    engineSampleRate = sampleRate / factor;
+    maxBlockSamples = samplesPerBlock;
+    engineBlockSize = (factor > 1) ? samplesPerBlock / factor + 1 : samplesPerBlock;
+
+    if (auto* instrument = getCurrentInstrument())
     {
-        currentInstrument->prepare(sampleRate, samplesPerBlock);
+        instrument->prepare(engineSampleRate, engineBlockSize);
     }
 
+    upsampler.prepare(factor);
+    engineRenderBuffer.setSize(2, engineBlockSize, false, true, false);
+    upsampledBuffer.setSize(2, engineBlockSize * factor, false, true, false);
+    upsampledCarryCount = 0;
+
     // Prepare MPE support
     if (mpeSupport && mpeEnabled)
     {
         mpeSupport->prepare(sampleRate);
     }
+
+    configureSpatialOutput(samplesPerBlock);
+
+    movingSource.prepare(sampleRate, juce::jmax(2, getTotalNumOutputChannels()));
+    appliedMovingSourceEnabled = false;     // The first block starts the giant at rest
+    updateLatency();
+
+    // Engines only prepare a few voices eagerly and never prepare one on the
+    // audio thread. An offline bounce needs every voice from its first block,
+    // so warm them all now; otherwise warm up the rest in the background.
+    if (isNonRealtime())
+    {
+        if (auto* warmUp = dynamic_cast<DSP::GiantVoiceWarmUp*>(getCurrentInstrument()))
+            while (warmUp->warmUpVoices(64) > 0) {}
+    }
+
+    startTimer(20);
 }
 
 void GiantInstrumentsPluginProcessor::releaseResources()
 {
-    juce::ScopedLock lock(dspLock);
-
-    if (currentInstrument)
+    if (auto* instrument = getCurrentInstrument())
     {
-        currentInstrument->reset();
+        instrument->reset();
     }
+
+    upsampler.reset();
+    upsampledCarryCount = 0;
+    movingSource.reset();
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -90,9 +164,15 @@ bool GiantInstrumentsPluginProcessor::isBusesLayoutSupported(const BusesLayout&
     juce::ignoreUnused(layouts);
     return true;
     #else
-    // Support mono and stereo layouts
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Mono, stereo, 5.1 and 7.1.4 beds, and Ambisonics up to third order
+    const auto& output = layouts.getMainOutputChannelSet();
+    const int ambisonicOrder = output.getAmbisonicOrder();
+
+    if (output != juce::AudioChannelSet::mono()
+     && output != juce::AudioChannelSet::stereo()
+     && output != juce::AudioChannelSet::create5point1()
+     && output != juce::AudioChannelSet::create7point1point4()
+     && (ambisonicOrder < 1 || ambisonicOrder > DSP::GiantSpatialEncoder::maxAmbisonicOrder))
         return false;
 
     #if ! JucePlugin_IsSynth
@@ -113,22 +193,440 @@ void GiantInstrumentsPluginProcessor::processBlock(juce::AudioBuffer<float>& buf
     // Clear output buffer
     buffer.clear();
 
-    juce::ScopedLock lock(dspLock);
-
-    if (!currentInstrument)
+    // No lock: the engine, settings, tuning and phrase are all published
+    // snapshots, and parameter writes arrive through the queue
+    const auto* slot = instruments.acquire();
+    if (slot == nullptr || maxBlockSamples <= 0)
         return;
 
+    activeInstrument = slot->instrument.get();
+    activeGeneration = slot->generation;
+
+    applyTuning();
+    applyRenderProfile();
+    applyModulation();
+    applyFormantTrajectory();
+
     // Process MPE first (before note handling)
     if (mpeSupport && mpeEnabled)
     {
         processMPE(midiMessages);
     }
 
-    // Process MIDI events
-    for (const auto metadata : midiMessages)
+    const int numChannels = juce::jmin(buffer.getNumChannels(), DSP::GiantSpatialEncoder::maxChannels);
+    const int numSamples = buffer.getNumSamples();
+
+    // Sub-blocks end at the next queued parameter write, so each lands on
+    // its sample, and at the block size announced in prepareToPlay: every
+    // scratch buffer is sized for that, so nothing is resized (allocated) here
+    std::array<float*, DSP::GiantSpatialEncoder::maxChannels> chunk {};
+    for (int start = 0; start < numSamples;)
+    {
+        const int nextWrite = applyQueuedParameters(start, numSamples);
+        const int length = juce::jmin(maxBlockSamples, nextWrite - start);
+        for (int ch = 0; ch < numChannels; ++ch)
+            chunk[static_cast<size_t>(ch)] = buffer.getWritePointer(ch, start);
+
+        // Process audio through current instrument (straight into the host's channels)
+        handleMidiEvents(midiMessages, start, length);
+        renderOutput(chunk.data(), numChannels, length);
+        applyMovingSource(chunk.data(), numChannels, length);
+        start += length;
+    }
+
+    publishMeters(buffer.getArrayOfReadPointers(), juce::jmin(numChannels, 2), numSamples);
+    noteFirstAudioRendered();
+}
+
+void GiantInstrumentsPluginProcessor::renderOutput(float* const* outputs, int numChannels, int numSamples)
+{
+    if (numChannels <= 0)
+        return;
+
+    if (numChannels == 2)
+    {
+        renderInstrument(outputs, numChannels, numSamples);
+        return;
+    }
+
+    if (numChannels > 2 && spatialEncoder.getNumChannels() == numChannels)
+    {
+        renderSpatial(outputs, numChannels, numSamples);
+        return;
+    }
+
+    // Mono: not every engine honours a single channel, so downmix a stereo render
+    jassert(numSamples <= spatialStereoBuffer.getNumSamples());
+    spatialStereoBuffer.clear(0, numSamples);
+    renderInstrument(spatialStereoBuffer.getArrayOfWritePointers(), 2, numSamples);
+
+    const float* left = spatialStereoBuffer.getReadPointer(0);
+    const float* right = spatialStereoBuffer.getReadPointer(1);
+    if (numChannels == 1)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            outputs[0][i] = 0.5f * (left[i] + right[i]);
+        return;
+    }
+
+    std::copy(left, left + numSamples, outputs[0]);
+    std::copy(right, right + numSamples, outputs[1]);
+}
+
+void GiantInstrumentsPluginProcessor::renderSpatial(float* const* outputs, int numChannels, int numSamples)
+{
+    jassert(numChannels == spatialMixer.getNumChannels());
+    juce::ignoreUnused(numChannels);
+
+    // A new engine's stems are new sources
+    if (activeInstrument != spatialInstrument)
+    {
+        spatialMixer.reset();
+        spatialInstrument = activeInstrument;
+    }
+
+    const float azimuth = spatialAzimuth.load(std::memory_order_relaxed);
+    const float elevation = spatialElevation.load(std::memory_order_relaxed);
+    const float halfSpread = 0.5f * spatialSpread.load(std::memory_order_relaxed);
+
+    float gains[DSP::GiantSpatialEncoder::maxChannels];
+
+    // Per-voice stems need the engine at the host rate (no resampler in between)
+    auto* source = dynamic_cast<DSP::GiantSpatialSource*>(activeInstrument);
+    if (source != nullptr && upsampler.getFactor() == 1 && source->getNumStems() <= maxSpatialStems)
+    {
+        const int numStems = source->getNumStems();
+
+        jassert(numSamples <= stemBuffer.getNumSamples());
+        source->processStems(stemBuffer.getArrayOfWritePointers(), stemPositions.data(), numSamples);
+
+        // Only sounding voices are mixed: cost follows the voice count
+        for (int v = 0; v < numStems; ++v)
+        {
+            const auto& position = stemPositions[static_cast<size_t>(v)];
+            if (!position.active)
+                continue;
+
+            spatialEncoder.computeGains(azimuth - position.lateral * halfSpread, elevation, gains);
+            spatialMixer.addSource(v, stemBuffer.getReadPointer(v), gains, position.retriggered,
+                                   outputs, numSamples);
+        }
+        return;
+    }
+
+    // Other engines: place their stereo pair across the spread
+    jassert(numSamples <= spatialStereoBuffer.getNumSamples());
+    spatialStereoBuffer.clear(0, numSamples);
+    renderInstrument(spatialStereoBuffer.getArrayOfWritePointers(), 2, numSamples);
+
+    for (int side = 0; side < 2; ++side)
+    {
+        spatialEncoder.computeGains(azimuth + ((side == 0) ? halfSpread : -halfSpread), elevation, gains);
+        spatialMixer.addSource(side, spatialStereoBuffer.getReadPointer(side), gains, false, outputs, numSamples);
+    }
+}
+
+void GiantInstrumentsPluginProcessor::applyMovingSource(float* const* outputs, int numChannels, int numSamples)
+{
+    const bool enabled = movingSourceEnabled.load(std::memory_order_relaxed);
+    const bool justEnabled = enabled && !appliedMovingSourceEnabled;
+    appliedMovingSourceEnabled = enabled;
+
+    if (!enabled)
+        return;
+
+    movingSource.setAir(airTemperature.load(std::memory_order_relaxed), airHumidity.load(std::memory_order_relaxed));
+    movingSource.setDistance(sourceDistance.load(std::memory_order_relaxed));
+
+    // Enabling starts the giant at rest with nothing in flight
+    if (justEnabled)
+        movingSource.reset();
+
+    movingSource.process(outputs, numChannels, numSamples);
+}
+
+void GiantInstrumentsPluginProcessor::updateLatency()
+{
+    int latency = upsampler.getLatencySamples();
+
+    // The propagation delay at the reference distance, so a giant there stays on the host's grid
+    if (isMovingSourceEnabled())
+        latency += juce::roundToInt(DSP::GiantMovingSource::referenceDelaySeconds(airTemperature.load(std::memory_order_relaxed))
+                                    * getSampleRate());
+
+    setLatencySamples(latency);
+}
+
+void GiantInstrumentsPluginProcessor::configureSpatialOutput(int samplesPerBlock)
+{
+    const auto layout = (getBusCount(false) > 0) ? getChannelLayoutOfBus(false, 0)
+                                                 : juce::AudioChannelSet::disabled();
+    const int ambisonicOrder = layout.getAmbisonicOrder();
+
+    if (ambisonicOrder >= 1)
+    {
+        spatialEncoder.configureAmbisonic(ambisonicOrder);
+    }
+    else
+    {
+        // Mono and stereo render directly: no speakers, no encoder
+        std::vector<DSP::GiantSpeaker> speakers;
+        if (layout.size() > 2)
+        {
+            for (int ch = 0; ch < layout.size(); ++ch)
+                speakers.push_back(speakerForChannel(layout.getTypeOfChannel(ch)));
+        }
+        spatialEncoder.configureSpeakers(speakers);
+    }
+
+    const bool spatial = spatialEncoder.getNumChannels() > 2;
+    spatialMixer.prepare(spatialEncoder.getNumChannels(), maxSpatialStems);
+    stemBuffer.setSize(spatial ? maxSpatialStems : 0, spatial ? samplesPerBlock : 0, false, true, false);
+    spatialStereoBuffer.setSize(2, samplesPerBlock, false, true, false);
+    spatialInstrument = nullptr;
+}
+
+void GiantInstrumentsPluginProcessor::renderInstrument(float* const* outputs, int numChannels, int numSamples)
+{
+    const int factor = upsampler.getFactor();
+    if (factor == 1)
+    {
+        // Always a stereo pair; InstrumentDSP::process takes a mutable pointer array
+        jassert(numChannels == 2);
+        float* channels[2] = { outputs[0], outputs[1] };
+        activeInstrument->process(channels, numChannels, numSamples);
+        return;
+    }
+
+    numChannels = juce::jmin(numChannels, DSP::GiantUpsampler::maxChannels);
+
+    // Host samples left over from the previous block's last engine sample
+    const int fromCarry = juce::jmin(upsampledCarryCount, numSamples);
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        std::copy(upsampledCarry[ch], upsampledCarry[ch] + fromCarry, outputs[ch]);
+        std::copy(upsampledCarry[ch] + fromCarry, upsampledCarry[ch] + upsampledCarryCount, upsampledCarry[ch]);
+    }
+    upsampledCarryCount -= fromCarry;
+
+    const int remaining = numSamples - fromCarry;
+    if (remaining == 0)
+        return;
+
+    // At most the prepared host block (processBlock chunks longer ones), so
+    // this fits the engineBlockSize buffers
+    const int engineSamples = (remaining + factor - 1) / factor;
+    jassert(engineSamples <= engineRenderBuffer.getNumSamples());
+
+    engineRenderBuffer.clear(0, engineSamples);
+
+    float* engineOutputs[2] = { engineRenderBuffer.getWritePointer(0), engineRenderBuffer.getWritePointer(1) };
+    float* upsampled[2] = { upsampledBuffer.getWritePointer(0), upsampledBuffer.getWritePointer(1) };
+
+    activeInstrument->process(engineOutputs, numChannels, engineSamples);
+    upsampler.process(engineOutputs, upsampled, numChannels, engineSamples);
+
+    // Fewer than `factor` host samples overhang the block; keep them for the next one
+    upsampledCarryCount = engineSamples * factor - remaining;
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        std::copy(upsampled[ch], upsampled[ch] + remaining, outputs[ch] + fromCarry);
+        std::copy(upsampled[ch] + remaining, upsampled[ch] + remaining + upsampledCarryCount, upsampledCarry[ch]);
+    }
+}
+
+int GiantInstrumentsPluginProcessor::toEngineSampleOffset(int hostSamplePosition) const
+{
+    const int factor = upsampler.getFactor();
+    if (factor == 1)
+        return hostSamplePosition;
+
+    // The engine block starts after the carried-over host samples
+    return juce::jmax(0, (hostSamplePosition - upsampledCarryCount) / factor);
+}
+
+void GiantInstrumentsPluginProcessor::publishMeters(const float* const* outputs, int numChannels, int numSamples)
+{
+    meterFeed.publish(outputs, numChannels, numSamples,
+                      activeInstrument->getActiveVoiceCount(),
+                      dynamic_cast<const DSP::GiantMeterSource*>(activeInstrument));
+}
+
+void GiantInstrumentsPluginProcessor::noteFirstAudioRendered()
+{
+    if (instantiateToFirstAudioMs.load(std::memory_order_relaxed) < 0.0)
+    {
+        instantiateToFirstAudioMs.store(juce::Time::getMillisecondCounterHiRes() - instantiationTimeMs,
+                                        std::memory_order_relaxed);
+    }
+}
+
+int GiantInstrumentsPluginProcessor::applyQueuedParameters(int position, int numSamples)
+{
+    // setParameter() rather than PARAM_CHANGE events: not every engine
+    // handles those, and the ID is only borrowed for the call. Writes for a
+    // switched-out engine are dropped by front(); offsets past the block
+    // land on its last sample.
+    while (const auto* queued = parameterQueue.front(activeGeneration))
+    {
+        const int offset = juce::jlimit(0, numSamples - 1, queued->sampleOffset);
+        if (offset > position)
+            return offset;
+
+        activeInstrument->setParameter(queued->paramId, queued->value);
+        parameterQueue.pop();
+    }
+
+    return numSamples;
+}
+
+void GiantInstrumentsPluginProcessor::flushPendingParameters()
+{
+    size_t flushed = 0;
+    while (flushed < pendingParameters.size()
+           && parameterQueue.push(pendingParameters[flushed].first.toRawUTF8(), pendingParameters[flushed].second,
+                                  0, instrumentGeneration))
+        ++flushed;
+
+    pendingParameters.erase(pendingParameters.begin(), pendingParameters.begin() + static_cast<std::ptrdiff_t>(flushed));
+}
+
+void GiantInstrumentsPluginProcessor::publishTuning()
+{
+    if (microtonalEnabled && tuningManager)
     {
+        const auto tuning = tuningManager->getTuning();
+        tuningTables.publish(std::make_unique<const DSP::GiantTuningTable>(
+            [&tuning](int midiNote) { return tuning.midiToFrequency(midiNote); }));
+    }
+    else
+    {
+        tuningTables.publish(std::make_unique<const DSP::GiantTuningTable>());
+    }
+}
+
+void GiantInstrumentsPluginProcessor::applyTuning()
+{
+    const auto* table = tuningTables.acquire();
+    if (table == appliedTuning && activeInstrument == tunedInstrument)
+        return;
+
+    if (auto* tunable = dynamic_cast<DSP::GiantTunable*>(activeInstrument))
+        tunable->setTuningTable(table);
+
+    appliedTuning = table;
+    tunedInstrument = activeInstrument;
+}
+
+void GiantInstrumentsPluginProcessor::applyRenderProfile()
+{
+    const auto profile = isNonRealtime() ? DSP::GiantRenderProfile::Offline
+                                         : DSP::GiantRenderProfile::Realtime;
+    if (profile == appliedProfile && activeInstrument == profiledInstrument)
+        return;
+
+    if (auto* target = dynamic_cast<DSP::GiantRenderProfileTarget*>(activeInstrument))
+        target->setRenderProfile(profile);
+
+    appliedProfile = profile;
+    profiledInstrument = activeInstrument;
+}
+
+void GiantInstrumentsPluginProcessor::applyModulation()
+{
+    const auto* settings = publishedModSettings.acquire();
+    if (settings == appliedModSettings && activeInstrument == modulatedInstrument)
+        return;
+
+    modTarget = dynamic_cast<DSP::GiantModulationTarget*>(activeInstrument);
+    if (modTarget != nullptr && settings != nullptr)
+        modTarget->getModMatrix().setSettings(*settings);
+
+    appliedModSettings = settings;
+    modulatedInstrument = activeInstrument;
+}
+
+void GiantInstrumentsPluginProcessor::applyFormantTrajectory()
+{
+    const auto* trajectory = formantTrajectories.acquire();
+    if (trajectory == appliedTrajectory && activeInstrument == trajectoryInstrument)
+        return;
+
+    // Borrowed: the publisher keeps the phrase alive while it is current
+    if (auto* voice = dynamic_cast<DSP::AetherGiantVoicePureDSP*>(activeInstrument))
+        voice->setFormantTrajectory(trajectory);
+
+    appliedTrajectory = trajectory;
+    trajectoryInstrument = activeInstrument;
+}
+
+void GiantInstrumentsPluginProcessor::applyChannelExpression(int channel, DSP::GiantModSource source, float value)
+{
+    if (modTarget == nullptr)
+        return;
+
+    auto& matrix = modTarget->getModMatrix();
+    const auto apply = [&matrix, source, value](int note)
+    {
+        if (source == DSP::GiantModSource::Pressure)
+            matrix.setNotePressure(note, value);
+        else if (source == DSP::GiantModSource::Timbre)
+            matrix.setNoteTimbre(note, value);
+        else if (source == DSP::GiantModSource::Bend)
+            matrix.setNoteBend(note, value);
+    };
+
+    if (!(mpeSupport && mpeEnabled))
+    {
+        apply(-1);
+        return;
+    }
+
+    for (int note = 0; note < DSP::GiantModMatrix::numNotes; ++note)
+    {
+        if (noteChannels[static_cast<size_t>(note)] == channel)
+            apply(note);
+    }
+}
+
+void GiantInstrumentsPluginProcessor::timerCallback()
+{
+    // Free what the audio thread was still holding at publish time
+    bool settled = tuningTables.collectGarbage();
+    settled = publishedModSettings.collectGarbage() && settled;
+    settled = formantTrajectories.collectGarbage() && settled;
+
+    flushPendingParameters();
+    settled = settled && pendingParameters.empty();
+
+    // The warm-up runs beside the audio thread: cold voices are published
+    // through their ready flags, so it never blocks the render path. It
+    // only has to stay clear of prepare() and of an engine swap freeing the
+    // engine it is warming; if one is running, retry next tick.
+    const juce::ScopedTryLock lock(warmUpLock);
+    if (!lock.isLocked())
+        return;
+
+    settled = instruments.collectGarbage() && settled;
+
+    // A couple of voices per tick keeps each tick short
+    auto* warmUp = dynamic_cast<DSP::GiantVoiceWarmUp*>(getCurrentInstrument());
+    if ((warmUp == nullptr || warmUp->warmUpVoices(2) == 0) && settled)
+        stopTimer();
+}
+
+void GiantInstrumentsPluginProcessor::handleMidiEvents(const juce::MidiBuffer& midiMessages,
+                                                        int startSample, int numSamples)
+{
+    // Process MIDI events that land in this chunk
+    for (auto it = midiMessages.findNextSamplePosition(startSample); it != midiMessages.cend(); ++it)
+    {
+        const auto metadata = *it;
+        if (metadata.samplePosition >= startSample + numSamples)
+            break;
+
         const auto message = metadata.getMessage();
-        int samplePosition = metadata.samplePosition;
+        int samplePosition = toEngineSampleOffset(metadata.samplePosition - startSample);
 
         if (message.isNoteOn())
         {
@@ -139,16 +637,11 @@ void GiantInstrumentsPluginProcessor::processBlock(juce::AudioBuffer<float>& buf
             // Apply MPE gestures if available
             if (mpeSupport && mpeEnabled)
             {
-                applyMPEToNote(midiNote, channel, currentInstrument.get());
-            }
-
-            // Convert to frequency with microtonal tuning if enabled
-            float frequency = midiNote;
-            if (microtonalEnabled && tuningManager)
-            {
-                frequency = tuningManager->getTuning().midiToFrequency(midiNote);
+                noteChannels[static_cast<size_t>(midiNote)] = channel;
+                applyMPEToNote(midiNote, channel, activeInstrument);
             }
 
+            // Pitch comes from the engine's tuning table (see applyTuning)
             // Create note-on event
             DSP::ScheduledEvent event;
             event.type = DSP::ScheduledEvent::NOTE_ON;
@@ -157,7 +650,7 @@ void GiantInstrumentsPluginProcessor::processBlock(juce::AudioBuffer<float>& buf
             event.data.note.midiNote = midiNote;
             event.data.note.velocity = velocity;
 
-            currentInstrument->handleEvent(event);
+            activeInstrument->handleEvent(event);
         }
         else if (message.isNoteOff())
         {
@@ -167,7 +660,8 @@ void GiantInstrumentsPluginProcessor::processBlock(juce::AudioBuffer<float>& buf
             event.sampleOffset = samplePosition;
             event.data.note.midiNote = message.getNoteNumber();
 
-            currentInstrument->handleEvent(event);
+            activeInstrument->handleEvent(event);
+            noteChannels[static_cast<size_t>(message.getNoteNumber())] = 0;
         }
         else if (message.isPitchWheel())
         {
@@ -179,7 +673,8 @@ void GiantInstrumentsPluginProcessor::processBlock(juce::AudioBuffer<float>& buf
             event.sampleOffset = samplePosition;
             event.data.pitchBend.bendValue = pitchBendValue;
 
-            currentInstrument->handleEvent(event);
+            activeInstrument->handleEvent(event);
+            applyChannelExpression(message.getChannel(), DSP::GiantModSource::Bend, pitchBendValue);
         }
         else if (message.isController())
         {
@@ -190,7 +685,14 @@ void GiantInstrumentsPluginProcessor::processBlock(juce::AudioBuffer<float>& buf
             event.data.controlChange.controllerNumber = message.getControllerNumber();
             event.data.controlChange.value = message.getControllerValue() / 127.0f;
 
-            currentInstrument->handleEvent(event);
+            activeInstrument->handleEvent(event);
+
+            // Mod wheel and MPE timbre (CC74) are matrix sources
+            if (modTarget != nullptr && message.getControllerNumber() == 1)
+                modTarget->getModMatrix().setModWheel(event.data.controlChange.value);
+            else if (message.getControllerNumber() == 74)
+                applyChannelExpression(message.getChannel(), DSP::GiantModSource::Timbre,
+                                       event.data.controlChange.value);
         }
         else if (message.isChannelPressure())
         {
@@ -200,13 +702,11 @@ void GiantInstrumentsPluginProcessor::processBlock(juce::AudioBuffer<float>& buf
             event.sampleOffset = samplePosition;
             event.data.channelPressure.pressure = message.getChannelPressureValue() / 127.0f;
 
-            currentInstrument->handleEvent(event);
+            activeInstrument->handleEvent(event);
+            applyChannelExpression(message.getChannel(), DSP::GiantModSource::Pressure,
+                                   event.data.channelPressure.pressure);
         }
     }
-
-    // Process audio through current instrument
-    float* outputs[2] = { buffer.getWritePointer(0), buffer.getWritePointer(1) };
-    currentInstrument->process(outputs, buffer.getNumChannels(), buffer.getNumSamples());
 }
 
 //==============================================================================
@@ -215,8 +715,8 @@ void GiantInstrumentsPluginProcessor::processBlock(juce::AudioBuffer<float>& buf
 
 juce::AudioProcessorEditor* GiantInstrumentsPluginProcessor::createEditor()
 {
-    // Generic editor for pluginval testing
-    return new juce::GenericAudioProcessorEditor(*this);
+    // The editor turns the scope feed on for as long as it is open
+    return new GiantInstrumentsPluginEditor(*this);
 }
 
 bool GiantInstrumentsPluginProcessor::hasEditor() const
@@ -250,6 +750,10 @@ bool GiantInstrumentsPluginProcessor::isMidiEffect() const
 
 double GiantInstrumentsPluginProcessor::getTailLengthSeconds() const
 {
+    // Sound still on its way from a distant giant
+    if (isMovingSourceEnabled())
+        return DSP::GiantMovingSource::maxDistance / 331.3;
+
     return 0.0;
 }
 
@@ -334,6 +838,54 @@ void GiantInstrumentsPluginProcessor::getStateInformation(juce::MemoryBlock& des
         mainXml->setAttribute("referenceNote", tuning.rootNote);
     }
 
+    // Save internal engine rate
+    mainXml->setAttribute("internalRate", internalRateTarget);
+
+    // Save moving-source stage
+    mainXml->setAttribute("sourceMotion", isMovingSourceEnabled());
+    mainXml->setAttribute("sourceDistance", getSourceDistance());
+    mainXml->setAttribute("airTemperature", airTemperature.load(std::memory_order_relaxed));
+    mainXml->setAttribute("airHumidity", airHumidity.load(std::memory_order_relaxed));
+
+    // Save modulation matrix
+    {
+        const auto settings = getModulationSettings();
+        auto* modXml = mainXml->createNewChildElement("Modulation");
+
+        for (int l = 0; l < DSP::GiantModSettings::numLfos; ++l)
+        {
+            const auto& lfo = settings.lfos[static_cast<size_t>(l)];
+            modXml->setAttribute("lfo" + juce::String(l + 1) + "Rate", lfo.rateHz);
+            modXml->setAttribute("lfo" + juce::String(l + 1) + "Shape", static_cast<int>(lfo.shape));
+        }
+
+        modXml->setAttribute("envAttack", settings.envelope.attackSeconds);
+        modXml->setAttribute("envDecay", settings.envelope.decaySeconds);
+        modXml->setAttribute("envSustain", settings.envelope.sustain);
+        modXml->setAttribute("envRelease", settings.envelope.releaseSeconds);
+
+        for (int slot = 0; slot < DSP::GiantModSettings::maxRoutes; ++slot)
+        {
+            const auto& route = settings.routes[static_cast<size_t>(slot)];
+            if (!route.isActive())
+                continue;
+
+            auto* routeXml = modXml->createNewChildElement("Route");
+            routeXml->setAttribute("slot", slot);
+            routeXml->setAttribute("source", static_cast<int>(route.source));
+            routeXml->setAttribute("destination", route.destination);
+            routeXml->setAttribute("depth", route.depth);
+        }
+    }
+
+    // Save Giant Voice performance
+    mainXml->setAttribute("formantTrajectory", formantTrajectoryFile.getFullPathName());
+
+    // Save surround/Ambisonic placement
+    mainXml->setAttribute("spatialAzimuth", getSpatialAzimuth());
+    mainXml->setAttribute("spatialElevation", getSpatialElevation());
+    mainXml->setAttribute("spatialSpread", getSpatialSpread());
+
     // Save current preset index
     mainXml->setAttribute("currentPreset", currentProgramIndex);
 
@@ -383,6 +935,66 @@ void GiantInstrumentsPluginProcessor::setStateInformation(const void* data, int
         tuning.rootNote = mainXml->getIntAttribute("referenceNote", 69);
         tuningManager->setTuning(tuning);
     }
+    publishTuning();
+
+    // Restore internal engine rate
+    setInternalSampleRate(mainXml->getDoubleAttribute("internalRate", 0.0));
+
+    // Restore moving-source stage
+    setAirConditions(static_cast<float>(mainXml->getDoubleAttribute("airTemperature", 20.0)),
+                     static_cast<float>(mainXml->getDoubleAttribute("airHumidity", 0.5)));
+    setSourceDistance(static_cast<float>(mainXml->getDoubleAttribute("sourceDistance",
+                                                                     DSP::GiantMovingSource::referenceDistance)));
+    setMovingSourceEnabled(mainXml->getBoolAttribute("sourceMotion", false));
+
+    // Restore modulation matrix (older states have none: no routes)
+    {
+        DSP::GiantModSettings settings;
+
+        if (const auto* modXml = mainXml->getChildByName("Modulation"))
+        {
+            for (int l = 0; l < DSP::GiantModSettings::numLfos; ++l)
+            {
+                auto& lfo = settings.lfos[static_cast<size_t>(l)];
+                lfo.rateHz = static_cast<float>(modXml->getDoubleAttribute("lfo" + juce::String(l + 1) + "Rate", lfo.rateHz));
+                lfo.shape = static_cast<DSP::GiantLfoShape>(juce::jlimit(0, static_cast<int>(DSP::GiantLfoShape::SampleAndHold),
+                                                                         modXml->getIntAttribute("lfo" + juce::String(l + 1) + "Shape", 0)));
+            }
+
+            auto& envelope = settings.envelope;
+            envelope.attackSeconds = static_cast<float>(modXml->getDoubleAttribute("envAttack", envelope.attackSeconds));
+            envelope.decaySeconds = static_cast<float>(modXml->getDoubleAttribute("envDecay", envelope.decaySeconds));
+            envelope.sustain = static_cast<float>(modXml->getDoubleAttribute("envSustain", envelope.sustain));
+            envelope.releaseSeconds = static_cast<float>(modXml->getDoubleAttribute("envRelease", envelope.releaseSeconds));
+
+            for (const auto* routeXml : modXml->getChildWithTagNameIterator("Route"))
+            {
+                const int slot = routeXml->getIntAttribute("slot", -1);
+                const int source = routeXml->getIntAttribute("source", -1);
+                if (slot < 0 || slot >= DSP::GiantModSettings::maxRoutes
+                    || source < 0 || source >= static_cast<int>(DSP::GiantModSource::numSources))
+                    continue;
+
+                settings.routes[static_cast<size_t>(slot)] = { static_cast<DSP::GiantModSource>(source),
+                                                               routeXml->getIntAttribute("destination", -1),
+                                                               static_cast<float>(routeXml->getDoubleAttribute("depth", 0.0)) };
+            }
+        }
+
+        setModulationSettings(settings);
+    }
+
+    // Restore Giant Voice performance (a moved or deleted file falls back to the vowel tables)
+    {
+        const auto path = mainXml->getStringAttribute("formantTrajectory");
+        if (path.isEmpty() || !loadFormantTrajectory(juce::File(path)))
+            loadFormantTrajectory(juce::File());
+    }
+
+    // Restore surround/Ambisonic placement
+    setSpatialPlacement(static_cast<float>(mainXml->getDoubleAttribute("spatialAzimuth", 0.0)),
+                        static_cast<float>(mainXml->getDoubleAttribute("spatialElevation", 0.0)),
+                        static_cast<float>(mainXml->getDoubleAttribute("spatialSpread", 60.0)));
 
     // Restore preset
     int presetIndex = mainXml->getIntAttribute("currentPreset", 0);
@@ -401,6 +1013,95 @@ void GiantInstrumentsPluginProcessor::setInstrumentType(GiantInstrumentType type
     switchInstrument(type);
 }
 
+void GiantInstrumentsPluginProcessor::setInternalSampleRate(double rate)
+{
+    rate = juce::jmax(0.0, rate);
+    if (rate == internalRateTarget)
+        return;
+
+    internalRateTarget = rate;
+
+    // Not prepared yet: prepareToPlay picks the rate up
+    if (getSampleRate() <= 0.0)
+        return;
+
+    suspendProcessing(true);
+    prepareToPlay(getSampleRate(), getBlockSize());
+    suspendProcessing(false);
+}
+
+void GiantInstrumentsPluginProcessor::setSpatialPlacement(float azimuthDegrees, float elevationDegrees,
+                                                          float spreadDegrees)
+{
+    spatialAzimuth.store(azimuthDegrees, std::memory_order_relaxed);
+    spatialElevation.store(juce::jlimit(-90.0f, 90.0f, elevationDegrees), std::memory_order_relaxed);
+    spatialSpread.store(juce::jlimit(0.0f, 360.0f, spreadDegrees), std::memory_order_relaxed);
+}
+
+void GiantInstrumentsPluginProcessor::setModulationSettings(const DSP::GiantModSettings& settings)
+{
+    modSettings = settings;
+    publishedModSettings.publish(std::make_unique<const DSP::GiantModSettings>(modSettings));
+}
+
+DSP::GiantModSettings GiantInstrumentsPluginProcessor::getModulationSettings() const
+{
+    return modSettings;
+}
+
+void GiantInstrumentsPluginProcessor::setModRoute(int slot, DSP::GiantModSource source, int destination, float depth)
+{
+    if (slot < 0 || slot >= DSP::GiantModSettings::maxRoutes)
+        return;
+
+    modSettings.routes[static_cast<size_t>(slot)] = { source, destination, depth };
+    publishedModSettings.publish(std::make_unique<const DSP::GiantModSettings>(modSettings));
+}
+
+bool GiantInstrumentsPluginProcessor::loadFormantTrajectory(const juce::File& file)
+{
+    std::shared_ptr<const DSP::GiantFormantTrajectory> trajectory;
+    if (file != juce::File())
+    {
+        trajectory = DSP::GiantFormantTrajectory::load(file);
+        if (trajectory == nullptr)
+            return false;
+    }
+
+    // The audio thread hands it to the engine at its next block; the timer
+    // frees the previous phrase once the audio thread has moved past it
+    formantTrajectories.publish(std::move(trajectory));
+    formantTrajectoryFile = file;
+    startTimer(20);
+    return true;
+}
+
+void GiantInstrumentsPluginProcessor::setMovingSourceEnabled(bool enabled)
+{
+    if (enabled == isMovingSourceEnabled())
+        return;
+
+    // The audio thread resets the stage at its next block (applyMovingSource)
+    movingSourceEnabled.store(enabled, std::memory_order_relaxed);
+    updateLatency();
+}
+
+void GiantInstrumentsPluginProcessor::setSourceDistance(float meters)
+{
+    sourceDistance.store(juce::jlimit(DSP::GiantMovingSource::minDistance, DSP::GiantMovingSource::maxDistance, meters),
+                         std::memory_order_relaxed);
+}
+
+void GiantInstrumentsPluginProcessor::setAirConditions(float temperatureCelsius, float humidity)
+{
+    airTemperature.store(juce::jlimit(-40.0f, 50.0f, temperatureCelsius), std::memory_order_relaxed);
+    airHumidity.store(juce::jlimit(0.0f, 1.0f, humidity), std::memory_order_relaxed);
+
+    // The speed of sound sets the reported delay
+    if (isMovingSourceEnabled())
+        updateLatency();
+}
+
 juce::String GiantInstrumentsPluginProcessor::getInstrumentTypeName(GiantInstrumentType type)
 {
     switch (type)
@@ -420,19 +1121,78 @@ juce::String GiantInstrumentsPluginProcessor::getInstrumentTypeName(GiantInstrum
 
 float GiantInstrumentsPluginProcessor::getParameter(const juce::String& name)
 {
-    if (currentInstrument)
+    float value = 0.0f;
+    if (getProcessorParameter(name, value))
+        return value;
+
+    if (auto* instrument = getCurrentInstrument())
     {
-        return currentInstrument->getParameter(name.toStdString().c_str());
+        return instrument->getParameter(name.toStdString().c_str());
     }
     return 0.0f;
 }
 
 void GiantInstrumentsPluginProcessor::setParameter(const juce::String& name, float value)
 {
-    if (currentInstrument)
+    if (setProcessorParameter(name, value))
+        return;
+
+    // No engine parameter ID is this long
+    if (name.getNumBytesAsUTF8() > DSP::GiantParameterEvent::maxParamIdLength)
     {
-        currentInstrument->setParameter(name.toStdString().c_str(), value);
+        jassertfalse;
+        return;
     }
+
+    // Behind a backlog a write joins it, so it never overtakes an older value
+    if (pendingParameters.empty() && parameterQueue.push(name.toRawUTF8(), value, 0, instrumentGeneration))
+        return;
+
+    // Full (audio stopped, or a burst of writes): keep the latest value per
+    // ID until the timer finds room in the queue
+    for (auto& pending : pendingParameters)
+    {
+        if (pending.first == name)
+        {
+            pending.second = value;
+            return;
+        }
+    }
+
+    pendingParameters.emplace_back(name, value);
+    startTimer(20);
+}
+
+bool GiantInstrumentsPluginProcessor::setProcessorParameter(const juce::String& name, float value)
+{
+    if (name == "sourceMotion")
+        setMovingSourceEnabled(value >= 0.5f);
+    else if (name == "sourceDistance")
+        setSourceDistance(value);
+    else if (name == "airTemperature")
+        setAirConditions(value, airHumidity.load(std::memory_order_relaxed));
+    else if (name == "airHumidity")
+        setAirConditions(airTemperature.load(std::memory_order_relaxed), value);
+    else
+        return false;
+
+    return true;
+}
+
+bool GiantInstrumentsPluginProcessor::getProcessorParameter(const juce::String& name, float& value) const
+{
+    if (name == "sourceMotion")
+        value = isMovingSourceEnabled() ? 1.0f : 0.0f;
+    else if (name == "sourceDistance")
+        value = getSourceDistance();
+    else if (name == "airTemperature")
+        value = airTemperature.load(std::memory_order_relaxed);
+    else if (name == "airHumidity")
+        value = airHumidity.load(std::memory_order_relaxed);
+    else
+        return false;
+
+    return true;
 }
 
 //==============================================================================
@@ -463,26 +1223,50 @@ std::unique_ptr<DSP::InstrumentDSP> GiantInstrumentsPluginProcessor::createInstr
     }
 }
 
+std::unique_ptr<DSP::InstrumentDSP> GiantInstrumentsPluginProcessor::createPreparedInstrument(GiantInstrumentType type)
+{
+    // Engines run at the internal rate when one is set (see prepareToPlay)
+    double sampleRate = (engineSampleRate > 0.0) ? engineSampleRate : getSampleRate();
+    int blockSize = (engineBlockSize > 0) ? engineBlockSize : getBlockSize();
+
+    auto instrument = createInstrument(type);
+    instrument->prepare(sampleRate, blockSize);
+    return instrument;
+}
+
+void GiantInstrumentsPluginProcessor::publishInstrument(std::unique_ptr<DSP::InstrumentDSP> instrument)
+{
+    // Writes still waiting for room were meant for the old engine's
+    // parameters; those already queued are dropped by the audio thread
+    pendingParameters.clear();
+
+    auto slot = std::make_unique<InstrumentSlot>();
+    slot->instrument = std::move(instrument);
+    slot->generation = ++instrumentGeneration;
+
+    // The old engine may be mid warm-up; publishing can free it
+    const juce::ScopedLock warmUpGuard(warmUpLock);
+    instruments.publish(std::move(slot));
+}
+
+DSP::InstrumentDSP* GiantInstrumentsPluginProcessor::getCurrentInstrument() const
+{
+    const auto* slot = instruments.getCurrent();
+    return (slot != nullptr) ? slot->instrument.get() : nullptr;
+}
+
 void GiantInstrumentsPluginProcessor::switchInstrument(GiantInstrumentType newType)
 {
     if (newType == instrumentType)
         return;
 
-    double sampleRate = getSampleRate();
-    int blockSize = getBlockSize();
-
-    // Create new instrument
-    auto newInstrument = createInstrument(newType);
-
-    // Prepare new instrument
-    newInstrument->prepare(sampleRate, blockSize);
+    // Create and prepare the new instrument, then swap it in (lock-free:
+    // the audio thread picks it up at its next block)
+    publishInstrument(createPreparedInstrument(newType));
+    instrumentType = newType;
 
-    // Swap (thread-safe with lock)
-    {
-        juce::ScopedLock lock(dspLock);
-        currentInstrument = std::move(newInstrument);
-        instrumentType = newType;
-    }
+    // Warm up the new engine's remaining voices and free the old one in the background
+    startTimer(20);
 
     // Update host display
     updateHostDisplay();
@@ -566,11 +1350,16 @@ bool GiantInstrumentsPluginProcessor::loadPresetFromFile(const juce::File& prese
     // Read preset file
     juce::String presetContent = presetFile.loadFileAsString();
 
-    if (!currentInstrument)
+    // Load preset into a fresh engine and swap it in whole: nothing is
+    // written under the audio thread, and earlier queued writes cannot land
+    // on top of the preset
+    auto instrument = createPreparedInstrument(instrumentType);
+    if (!instrument->loadPreset(presetContent.toRawUTF8()))
         return false;
 
-    // Load preset into current instrument
-    return currentInstrument->loadPreset(presetContent.toRawUTF8());
+    publishInstrument(std::move(instrument));
+    startTimer(20);
+    return true;
 }
 
 void GiantInstrumentsPluginProcessor::processMPE(const juce::MidiBuffer& midiMessages)
@@ -617,6 +1406,17 @@ void GiantInstrumentsPluginProcessor::applyMPEToNote(int noteNumber, int midiCha
         dsp->setParameter("roughness", gestures.roughness);
         dsp->setParameter("detune", gestures.roughness);
     }
+
+    // The note's initial expression for the modulation matrix
+    if (modTarget != nullptr)
+    {
+        auto& matrix = modTarget->getModMatrix();
+        if (gestures.force >= 0.0f)
+            matrix.setNotePressure(noteNumber, gestures.force);
+        if (gestures.contactArea >= 0.0f)
+            matrix.setNoteTimbre(noteNumber, gestures.contactArea);
+        matrix.setNoteBend(noteNumber, 0.0f);
+    }
 }
 
 //==============================================================================
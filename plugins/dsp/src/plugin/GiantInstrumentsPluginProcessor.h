@@ -21,6 +21,19 @@
 #include "dsp/AetherGiantVoiceDSP.h"
 #include "dsp/MPEUniversalSupport.h"
 #include "dsp/MicrotonalTuning.h"
+#include "dsp/GiantMeterFeed.h"
+#include "dsp/GiantModMatrix.h"
+#include "dsp/GiantMovingSource.h"
+#include "dsp/GiantParameterQueue.h"
+#include "dsp/GiantPublisher.h"
+#include "dsp/GiantRenderProfile.h"
+#include "dsp/GiantResampler.h"
+#include "dsp/GiantSpatialEncoder.h"
+#include "dsp/GiantTuningTable.h"
+#include "dsp/GiantVoiceWarmUp.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
 
 //==============================================================================
 // Giant Instrument Type
@@ -39,7 +52,8 @@ enum class GiantInstrumentType
 // Giant Instruments Plugin Processor
 //==============================================================================
 
-class GiantInstrumentsPluginProcessor : public juce::AudioProcessor
+class GiantInstrumentsPluginProcessor : public juce::AudioProcessor,
+                                        private juce::Timer
 {
 public:
     GiantInstrumentsPluginProcessor();
@@ -56,6 +70,12 @@ public:
     bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
 #endif
 
+    /**
+     * Float host I/O only: the engines render float (InstrumentDSP is a
+     * float interface), so double-precision processing is not advertised.
+     * Long decays keep their precision through the engines' double
+     * modal/membrane state instead.
+     */
     void processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override;
 
     //==========================================================================
@@ -112,6 +132,69 @@ public:
      */
     void setInstrumentType(GiantInstrumentType type);
 
+    /**
+     * Run the engine at a fixed internal rate (48000 or 96000) and
+     * resample to the host rate; 0 runs it at the host rate.
+     * The engine rate is the nearest integer division of the host rate
+     * (a 176.4 kHz host with a 48 kHz target runs the engine at 44.1 kHz).
+     * Re-prepares the engine and reports the resampler latency to the host.
+     */
+    void setInternalSampleRate(double rate);
+    double getInternalSampleRate() const { return internalRateTarget; }
+
+    /**
+     * Place the instrument on surround and Ambisonic outputs (mono and
+     * stereo outputs ignore it). Engines with per-voice stems fan their
+     * voices out across the spread by pitch, low notes on the left.
+     * @param azimuthDegrees    Centre direction: 0 = front, positive to the left
+     * @param elevationDegrees  0 = ear level, positive up
+     * @param spreadDegrees     Width the voices (or the stereo pair) cover
+     */
+    void setSpatialPlacement(float azimuthDegrees, float elevationDegrees, float spreadDegrees);
+    float getSpatialAzimuth() const { return spatialAzimuth.load(std::memory_order_relaxed); }
+    float getSpatialElevation() const { return spatialElevation.load(std::memory_order_relaxed); }
+    float getSpatialSpread() const { return spatialSpread.load(std::memory_order_relaxed); }
+
+    /**
+     * Moving-source stage on the rendered output (GiantMovingSource.h):
+     * Doppler, 1/r gain and air absorption for a giant at a distance.
+     * Also reachable through setParameter() as "sourceMotion" (0/1),
+     * "sourceDistance" (meters), "airTemperature" (Celsius) and
+     * "airHumidity" (0-1), so the distance can be automated.
+     * Enabling starts the giant at rest at the next block. While enabled
+     * the propagation delay at the reference distance is reported as
+     * latency, so only moves nearer or farther shift the timing.
+     */
+    void setMovingSourceEnabled(bool enabled);
+    bool isMovingSourceEnabled() const { return movingSourceEnabled.load(std::memory_order_relaxed); }
+    void setSourceDistance(float meters);
+    float getSourceDistance() const { return sourceDistance.load(std::memory_order_relaxed); }
+    void setAirConditions(float temperatureCelsius, float humidity);
+
+    /**
+     * Modulation matrix (GiantModMatrix.h) of engines that implement
+     * GiantModulationTarget. Routes name destinations by integer ID
+     * (DSP::GiantModDestination). The settings carry over engine switches
+     * and are saved with the plugin state.
+     */
+    void setModulationSettings(const DSP::GiantModSettings& settings);
+    DSP::GiantModSettings getModulationSettings() const;
+
+    /** One route; destination -1 or depth 0 clears the slot */
+    void setModRoute(int slot, DSP::GiantModSource source, int destination, float depth);
+
+    /**
+     * Drive Giant Voice from an analyzed performance (a .gftraj file
+     * written by GiantFormantAnalyzer) instead of its vowel tables.
+     * Loads on the calling (message) thread; the phrase carries over
+     * engine switches and its path is saved with the plugin state.
+     * An empty file returns new notes to the vowel tables.
+     * @returns     false if the file is missing or malformed (the current
+     *              phrase is kept)
+     */
+    bool loadFormantTrajectory(const juce::File& file);
+    juce::File getFormantTrajectoryFile() const { return formantTrajectoryFile; }
+
     /**
      * Get name of instrument type
      */
@@ -124,7 +207,12 @@ public:
     /**
      * Get current DSP engine (for editor)
      */
-    DSP::InstrumentDSP* getCurrentDSP() { return currentInstrument.get(); }
+    DSP::InstrumentDSP* getCurrentDSP() { return getCurrentInstrument(); }
+
+    /**
+     * Meter/scope frames published by the audio thread (poll from the editor)
+     */
+    DSP::GiantMeterFeed& getMeterFeed() { return meterFeed; }
 
     /**
      * Get parameter value by name
@@ -133,20 +221,53 @@ public:
 
     /**
      * Set parameter value by name
+     * (message thread; queued and applied at the start of the next block,
+     * or a few milliseconds later while the queue is full)
      */
     void setParameter(const juce::String& name, float value);
 
+    //==========================================================================
+    // Load-time Metrics
+    //==========================================================================
+
+    /**
+     * Milliseconds from construction to the first rendered block
+     * (-1 until audio has been rendered)
+     */
+    double getInstantiateToFirstAudioMs() const { return instantiateToFirstAudioMs.load(std::memory_order_relaxed); }
+
 private:
     //==========================================================================
     // Internal Members
     //==========================================================================
 
-    // Current instrument DSP engine
-    std::unique_ptr<DSP::InstrumentDSP> currentInstrument;
-    GiantInstrumentType instrumentType = GiantInstrumentType::GiantStrings;
+    // One engine as published to the audio thread; the generation tags the
+    // parameter writes meant for it
+    struct InstrumentSlot
+    {
+        std::unique_ptr<DSP::InstrumentDSP> instrument;
+        uint32_t generation = 0;
+    };
+
+    // Engines are prepared on the message thread and swapped in whole; the
+    // one they replace is freed there once the audio thread has moved on
+    DSP::GiantPublisher<const InstrumentSlot> instruments;
+    GiantInstrumentType instrumentType = GiantInstrumentType::GiantStrings;    // Message thread
+    uint32_t instrumentGeneration = 0;                                         // Message thread
+    DSP::InstrumentDSP* activeInstrument = nullptr;     // Audio thread: engine of the current block
+    uint32_t activeGeneration = 0;                      // Audio thread
 
-    // Critical section for DSP switching
-    juce::CriticalSection dspLock;
+    // Keeps the background voice warm-up clear of prepare() and engine swaps
+    // (never taken by the render path; the warm-up runs beside the audio thread)
+    juce::CriticalSection warmUpLock;
+
+    // Message thread parameter writes, applied by the audio thread. Writes
+    // that find the queue full wait here, latest value per ID (message thread)
+    DSP::GiantParameterQueue parameterQueue;
+    std::vector<std::pair<juce::String, float>> pendingParameters;
+
+    // Audio thread -> editor metering
+    DSP::GiantMeterFeed meterFeed;
 
     // MPE Support (Full MPE for all Giant Instruments)
     std::unique_ptr<MPEUniversalSupport> mpeSupport;
@@ -156,6 +277,15 @@ private:
     std::unique_ptr<MicrotonalTuningManager> tuningManager;
     bool microtonalEnabled = true;
 
+    // Tuning tabulated on the message thread, picked up by the audio thread
+    DSP::GiantTuningPublisher tuningTables;
+    const DSP::GiantTuningTable* appliedTuning = nullptr;   // Audio thread
+    DSP::InstrumentDSP* tunedInstrument = nullptr;          // Audio thread
+
+    // Quality profile follows isNonRealtime() (audio thread)
+    DSP::GiantRenderProfile appliedProfile = DSP::GiantRenderProfile::Realtime;
+    DSP::InstrumentDSP* profiledInstrument = nullptr;
+
     // Factory presets
     struct PresetInfo
     {
@@ -166,6 +296,62 @@ private:
     std::vector<PresetInfo> factoryPresets;
     int currentProgramIndex = 0;
 
+    // Host block size from prepareToPlay: every scratch buffer is sized for
+    // it, and longer host blocks render in chunks of it
+    int maxBlockSamples = 0;
+
+    // Internal engine rate (0 = host rate) and engine -> host resampling
+    double internalRateTarget = 0.0;
+    double engineSampleRate = 0.0;
+    int engineBlockSize = 0;
+    DSP::GiantUpsampler upsampler;
+    juce::AudioBuffer<float> engineRenderBuffer;        // Engine rate
+    juce::AudioBuffer<float> upsampledBuffer;           // Host rate
+    float upsampledCarry[DSP::GiantUpsampler::maxChannels][DSP::GiantUpsampler::maxFactor] = {};
+    int upsampledCarryCount = 0;                        // Host samples rendered ahead of the block
+
+    // Surround and Ambisonic output (more than two output channels)
+    static constexpr int maxSpatialStems = 32;
+    DSP::GiantSpatialEncoder spatialEncoder;
+    DSP::GiantSpatialMixer spatialMixer;
+    juce::AudioBuffer<float> stemBuffer;                // One channel per voice stem
+    juce::AudioBuffer<float> spatialStereoBuffer;       // Engines without stems render stereo here
+    std::array<DSP::GiantStemPosition, maxSpatialStems> stemPositions {};
+    DSP::InstrumentDSP* spatialInstrument = nullptr;    // Audio thread
+    std::atomic<float> spatialAzimuth { 0.0f };
+    std::atomic<float> spatialElevation { 0.0f };
+    std::atomic<float> spatialSpread { 60.0f };
+
+    // Modulation matrix settings: edited on the message thread, published
+    // and handed to the engine's matrix at the start of the next block
+    DSP::GiantModSettings modSettings;                                  // Message thread
+    DSP::GiantPublisher<const DSP::GiantModSettings> publishedModSettings;
+    const DSP::GiantModSettings* appliedModSettings = nullptr;          // Audio thread
+    DSP::InstrumentDSP* modulatedInstrument = nullptr;
+    DSP::GiantModulationTarget* modTarget = nullptr;
+
+    // Analyzed performance for Giant Voice: loaded on the message thread,
+    // handed to the engine by the audio thread (none = vowel tables)
+    DSP::GiantPublisher<const DSP::GiantFormantTrajectory> formantTrajectories;
+    const DSP::GiantFormantTrajectory* appliedTrajectory = nullptr;    // Audio thread
+    DSP::InstrumentDSP* trajectoryInstrument = nullptr;                 // Audio thread
+    juce::File formantTrajectoryFile;
+
+    // MIDI channel of each sounding note (MPE per-note expression), 0 = none
+    std::array<int, DSP::GiantModMatrix::numNotes> noteChannels {};
+
+    // Moving-source stage (message thread writes, audio thread reads)
+    DSP::GiantMovingSource movingSource;
+    std::atomic<bool> movingSourceEnabled { false };
+    bool appliedMovingSourceEnabled = false;            // Audio thread
+    std::atomic<float> sourceDistance { DSP::GiantMovingSource::referenceDistance };
+    std::atomic<float> airTemperature { 20.0f };
+    std::atomic<float> airHumidity { 0.5f };
+
+    // Instantiate-to-first-audio metric
+    double instantiationTimeMs = 0.0;
+    std::atomic<double> instantiateToFirstAudioMs { -1.0 };
+
     //==========================================================================
     // Private Methods
     //==========================================================================
@@ -175,6 +361,24 @@ private:
      */
     std::unique_ptr<DSP::InstrumentDSP> createInstrument(GiantInstrumentType type);
 
+    /**
+     * Create an engine prepared for the current engine rate (message thread)
+     */
+    std::unique_ptr<DSP::InstrumentDSP> createPreparedInstrument(GiantInstrumentType type);
+
+    /**
+     * Hand an engine to the audio thread, which picks it up at its next
+     * block; writes still queued for the old engine are dropped
+     * (message thread)
+     */
+    void publishInstrument(std::unique_ptr<DSP::InstrumentDSP> instrument);
+
+    /**
+     * Latest published engine (message thread; the audio thread may still
+     * be finishing a block on the previous one)
+     */
+    DSP::InstrumentDSP* getCurrentInstrument() const;
+
     /**
      * Switch to different instrument (with state preservation if possible)
      */
@@ -191,10 +395,130 @@ private:
     juce::File getPresetsFolder(GiantInstrumentType type) const;
 
     /**
-     * Load preset from file
+     * Load preset from file into a fresh engine of the current type and
+     * swap it in
      */
     bool loadPresetFromFile(const juce::File& presetFile);
 
+    /**
+     * Render a host-rate block from the current engine, resampling when it
+     * runs at an internal rate (audio thread)
+     */
+    void renderInstrument(float* const* outputs, int numChannels, int numSamples);
+
+    /**
+     * Render into the host's channel layout: stereo directly, mono as a
+     * downmix, anything wider through the spatial encoder
+     * (audio thread, outputs cleared)
+     */
+    void renderOutput(float* const* outputs, int numChannels, int numSamples);
+
+    /**
+     * Encode the engine's voice stems (or its stereo pair) into the
+     * surround/Ambisonic output (audio thread, outputs cleared)
+     */
+    void renderSpatial(float* const* outputs, int numChannels, int numSamples);
+
+    /**
+     * Set the encoder up for the main output bus layout and size the
+     * spatial scratch buffers for samplesPerBlock (prepareToPlay)
+     */
+    void configureSpatialOutput(int samplesPerBlock);
+
+    /**
+     * Hand changed modulation settings to the current engine's matrix (audio thread)
+     */
+    void applyModulation();
+
+    /**
+     * Hand a newly loaded performance to the current engine (audio thread)
+     */
+    void applyFormantTrajectory();
+
+    /**
+     * Channel-wide expression (pitch bend, pressure, CC74) to the matrix:
+     * with MPE each note has its own channel, otherwise it covers every note
+     */
+    void applyChannelExpression(int channel, DSP::GiantModSource source, float value);
+
+    /**
+     * Run the moving-source stage over the rendered output (audio thread)
+     */
+    void applyMovingSource(float* const* outputs, int numChannels, int numSamples);
+
+    /**
+     * Report the upsampler's delay plus, with the moving source on, the
+     * reference-distance propagation delay (message thread)
+     */
+    void updateLatency();
+
+    /**
+     * Parameters owned by the processor rather than the engine
+     * @returns     false if name is an engine parameter
+     */
+    bool setProcessorParameter(const juce::String& name, float value);
+    bool getProcessorParameter(const juce::String& name, float& value) const;
+
+    /**
+     * Map a host block position to the engine block about to be rendered
+     */
+    int toEngineSampleOffset(int hostSamplePosition) const;
+
+    /**
+     * Translate the MIDI messages in one render chunk into scheduled events
+     * for the current engine, offsets relative to the chunk (audio thread)
+     */
+    void handleMidiEvents(const juce::MidiBuffer& midiMessages, int startSample, int numSamples);
+
+    /**
+     * Apply the queued parameter writes due at a block position to the
+     * current engine (audio thread)
+     * @returns     Position of the next queued write, or numSamples if none
+     */
+    int applyQueuedParameters(int position, int numSamples);
+
+    /**
+     * Move writes that found the queue full into it, as room allows
+     * (message thread)
+     */
+    void flushPendingParameters();
+
+    /**
+     * Tabulate the current tuning and publish it to the audio thread
+     * (message thread)
+     */
+    void publishTuning();
+
+    /**
+     * Hand the latest published tuning to the current engine
+     * (audio thread)
+     */
+    void applyTuning();
+
+    /**
+     * Switch the engine to the offline profile while the host bounces
+     * (audio thread)
+     */
+    void applyRenderProfile();
+
+    /**
+     * Publish the rendered block's levels for the editor
+     * (audio thread)
+     */
+    void publishMeters(const float* const* outputs, int numChannels, int numSamples);
+
+    /**
+     * Record the instantiate-to-first-audio time on the first rendered block
+     */
+    void noteFirstAudioRendered();
+
+    /**
+     * Warm up lazily prepared voices off the audio thread (see
+     * GiantVoiceWarmUp), free what the audio thread has moved past and
+     * retry parameter writes that found the queue full
+     */
+    void timerCallback() override;
+
     /**
      * Process MIDI messages and extract MPE gestures
      */
@@ -0,0 +1,232 @@
+/*
+  ==============================================================================
+
+    AetherGiantDrumsTest.cpp
+
+    Behaviour tests for Aether Giant Drums (membranes, shells, room)
+
+  ==============================================================================
+*/
+
+#include "JuceStandaloneConfig.h"
+#include <juce_core/juce_core.h>
+#include <juce_dsp/juce_dsp.h>
+#include "../include/dsp/AetherGiantDrumsDSP.h"
+#include <iostream>
+#include <cstdio>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+
+using namespace DSP;
+
+//==============================================================================
+// Test Result Tracking
+//==============================================================================
+
+struct TestStats {
+    int passed = 0;
+    int failed = 0;
+    int total = 0;
+
+    void pass(const char* testName) {
+        total++;
+        passed++;
+        std::cout << "  [PASS] " << testName << std::endl;
+    }
+
+    void fail(const char* testName, const std::string& reason) {
+        total++;
+        failed++;
+        std::cout << "  [FAIL] " << testName << ": " << reason << std::endl;
+    }
+
+    void printSummary() {
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "Test Summary: " << passed << "/" << total << " passed";
+        if (failed > 0) {
+            std::cout << " (" << failed << " failed)";
+        }
+        std::cout << "\n========================================" << std::endl;
+    }
+};
+
+//==============================================================================
+// Audio Utilities
+//==============================================================================
+
+void render(AetherGiantDrumsPureDSP& synth, std::vector<float>& left, std::vector<float>& right,
+            int bufferSize = 512) {
+    const int numSamples = static_cast<int>(left.size());
+    for (int offset = 0; offset < numSamples; offset += bufferSize) {
+        int samplesToProcess = std::min(bufferSize, numSamples - offset);
+        float* outputs[] = { left.data() + offset, right.data() + offset };
+        synth.process(outputs, 2, samplesToProcess);
+    }
+}
+
+void noteOn(AetherGiantDrumsPureDSP& synth, int note, float velocity) {
+    ScheduledEvent event;
+    event.type = ScheduledEvent::NOTE_ON;
+    event.time = 0.0;
+    event.sampleOffset = 0;
+    event.data.note.midiNote = note;
+    event.data.note.velocity = velocity;
+    synth.handleEvent(event);
+}
+
+/** T60 from the Schroeder energy decay curve of the tail after tailStart,
+    fitted between -5 and -35 dB (dry signal and early reflections excluded) */
+double measureT60(const std::vector<float>& impulseResponse, size_t tailStart, double sampleRate) {
+    std::vector<double> decay(impulseResponse.size() + 1, 0.0);
+    for (size_t i = impulseResponse.size(); i-- > tailStart;)
+        decay[i] = decay[i + 1] + static_cast<double>(impulseResponse[i]) * impulseResponse[i];
+
+    size_t start = 0, end = 0;
+    for (size_t i = tailStart; i < impulseResponse.size(); ++i) {
+        const double level = 10.0 * std::log10(decay[i] / decay[tailStart] + 1.0e-300);
+        if (start == 0 && level <= -5.0)
+            start = i;
+        if (level <= -35.0) {
+            end = i;
+            break;
+        }
+    }
+
+    if (start == 0 || end <= start)
+        return 0.0;
+
+    // 30 dB of decay in (end - start) samples
+    return 2.0 * static_cast<double>(end - start) / sampleRate;
+}
+
+//==============================================================================
+// Test 1: Room Tail Decay
+//==============================================================================
+
+bool testRoomDecay(TestStats& stats) {
+    std::cout << "\n[Test 1] Room Tail Decay" << std::endl;
+
+    const double sampleRate = 48000.0;
+
+    for (float reverbTime : { 1.0f, 2.0f, 4.0f }) {
+        for (int lines : { 8, 4 }) {
+            DrumRoomCoupling room;
+            room.prepare(sampleRate);
+
+            DrumRoomCoupling::Parameters params;
+            params.roomSize = 1.0f;
+            params.reverbTime = reverbTime;
+            params.hfDecayRatio = 1.0f;     // Same T60 at every frequency
+            room.setParameters(params);
+            room.setActiveLines(lines);
+
+            std::vector<float> impulseResponse(static_cast<size_t>(sampleRate * (0.2 + reverbTime)));
+            for (size_t i = 0; i < impulseResponse.size(); ++i)
+                impulseResponse[i] = room.processSample((i == 0) ? 1.0f : 0.0f);
+
+            const double t60 = measureT60(impulseResponse, static_cast<size_t>(0.2 * sampleRate), sampleRate);
+            std::printf("    reverbTime %.1f s, %d lines: T60 %.3f s\n", reverbTime, lines, t60);
+
+            // Each line's gain is set from its own delay: fewer lines keep the decay
+            if (std::abs(t60 / reverbTime - 1.0) > 0.05) {
+                stats.fail("room_decay", "Measured T60 is more than 5% off reverbTime");
+                return false;
+            }
+        }
+    }
+
+    stats.pass("room_decay");
+    return true;
+}
+
+//==============================================================================
+// Test 2: Sympathetic Coupling
+//==============================================================================
+
+bool testSympatheticCoupling(TestStats& stats) {
+    std::cout << "\n[Test 2] Sympathetic Coupling" << std::endl;
+
+    // A loud kick and a barely struck drum a semitone up (chromatic layout:
+    // 80 and 90 Hz), 50 ms in: the soft hit alone is nearly gone by then.
+    // Offline profile: no timing-dependent CPU governor.
+    const int length = 2400;
+    auto play = [length](float coupling, bool withKick, std::vector<float>& left, float* energies) {
+        AetherGiantDrumsPureDSP synth;
+        synth.prepare(48000.0, 512);
+        synth.setRenderProfile(GiantRenderProfile::Offline);
+        if (coupling >= 0.0f)
+            synth.setParameter("sympathetic_coupling", coupling);
+
+        std::vector<float> right(length);
+        left.assign(length, 0.0f);
+        if (withKick)
+            noteOn(synth, 36, 1.0f);
+        noteOn(synth, 37, 0.05f);
+        render(synth, left, right);
+        return synth.getVoiceEnergies(energies, 16);
+    };
+
+    float coupledEnergies[16] = {}, dryEnergies[16] = {}, scratch[16] = {};
+    std::vector<float> coupled, dry, untouched, tomCoupled, tomDry;
+    const int numVoices = play(1.0f, true, coupled, coupledEnergies);
+    play(0.0f, true, dry, dryEnergies);
+
+    // Both runs put the drums in the same voices: the quieter one is the tom
+    int kick = 0, tom = 0;
+    for (int v = 0; v < numVoices; ++v) {
+        if (dryEnergies[v] > dryEnergies[kick])
+            kick = v;
+    }
+    tom = (kick == 0) ? 1 : 0;
+    for (int v = 0; v < numVoices; ++v) {
+        if (v != kick && dryEnergies[v] > dryEnergies[tom])
+            tom = v;
+    }
+
+    std::cout << "    Soft drum energy after 50 ms: " << dryEnergies[tom] << " uncoupled, "
+              << coupledEnergies[tom] << " next to the kick" << std::endl;
+
+    if (!(coupledEnergies[tom] > 2.0f * dryEnergies[tom])) {
+        stats.fail("coupling_drive", "Kick did not ring the neighbouring drum");
+        return false;
+    }
+
+    // Off means off: amount 0 renders exactly as an engine that never had coupling
+    play(-1.0f, true, untouched, scratch);
+    if (std::memcmp(dry.data(), untouched.data(), sizeof(float) * length) != 0) {
+        stats.fail("coupling_off", "Coupling 0 changes the output");
+        return false;
+    }
+
+    // A voice never drives itself: one drum alone is unchanged by the amount
+    play(1.0f, false, tomCoupled, scratch);
+    play(0.0f, false, tomDry, scratch);
+    if (std::memcmp(tomCoupled.data(), tomDry.data(), sizeof(float) * length) != 0) {
+        stats.fail("coupling_self", "A lone drum is coupled to itself");
+        return false;
+    }
+
+    stats.pass("sympathetic_coupling");
+    return true;
+}
+
+//==============================================================================
+// Main Test Runner
+//==============================================================================
+
+int main(int argc, char* argv[]) {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "AetherGiantDrums Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestStats stats;
+
+    testRoomDecay(stats);
+    testSympatheticCoupling(stats);
+
+    stats.printSummary();
+
+    return (stats.failed == 0) ? 0 : 1;
+}
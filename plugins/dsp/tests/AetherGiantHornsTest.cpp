@@ -0,0 +1,506 @@
+/*
+  ==============================================================================
+
+    AetherGiantHornsTest.cpp
+
+    Behaviour tests for Aether Giant Horns (lip reed, bore, bell)
+
+  ==============================================================================
+*/
+
+#include "JuceStandaloneConfig.h"
+#include <juce_core/juce_core.h>
+#include <juce_dsp/juce_dsp.h>
+#include "../include/dsp/AetherGiantHornsDSP.h"
+#include "../include/dsp/GiantNoise.h"
+#include "../include/dsp/GiantResampler.h"
+#include "../include/dsp/GiantSpatialEncoder.h"
+#include <iostream>
+#include <cstdio>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace DSP;
+
+//==============================================================================
+// Test Result Tracking
+//==============================================================================
+
+struct TestStats {
+    int passed = 0;
+    int failed = 0;
+    int total = 0;
+
+    void pass(const char* testName) {
+        total++;
+        passed++;
+        std::cout << "  [PASS] " << testName << std::endl;
+    }
+
+    void fail(const char* testName, const std::string& reason) {
+        total++;
+        failed++;
+        std::cout << "  [FAIL] " << testName << ": " << reason << std::endl;
+    }
+
+    void printSummary() {
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "Test Summary: " << passed << "/" << total << " passed";
+        if (failed > 0) {
+            std::cout << " (" << failed << " failed)";
+        }
+        std::cout << "\n========================================" << std::endl;
+    }
+};
+
+//==============================================================================
+// Audio Utilities
+//==============================================================================
+
+void render(AetherGiantHornsPureDSP& synth, std::vector<float>& left, std::vector<float>& right,
+            int bufferSize = 512) {
+    const int numSamples = static_cast<int>(left.size());
+    for (int offset = 0; offset < numSamples; offset += bufferSize) {
+        int samplesToProcess = std::min(bufferSize, numSamples - offset);
+        float* outputs[] = { left.data() + offset, right.data() + offset };
+        synth.process(outputs, 2, samplesToProcess);
+    }
+}
+
+void noteOn(AetherGiantHornsPureDSP& synth, int note, float velocity) {
+    ScheduledEvent event;
+    event.type = ScheduledEvent::NOTE_ON;
+    event.time = 0.0;
+    event.sampleOffset = 0;
+    event.data.note.midiNote = note;
+    event.data.note.velocity = velocity;
+    synth.handleEvent(event);
+}
+
+/** Textbook scalar xoshiro128+ with GiantNoise's splitmix64 seeding */
+struct ReferenceXoshiro {
+    uint32_t s[4];
+
+    static uint64_t splitMix64(uint64_t& state) {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    uint32_t next() {
+        const uint32_t result = s[0] + s[3];
+        const uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = (s[3] << 11) | (s[3] >> 21);
+        return result;
+    }
+};
+
+//==============================================================================
+// Test 1: Growl Noise Streams
+//==============================================================================
+
+bool testNoise(TestStats& stats) {
+    std::cout << "\n[Test 1] Growl Noise Streams" << std::endl;
+
+    // Lane j is its own xoshiro128+ stream; sample 4k + j is lane j's k-th output
+    const uint64_t seed = 12345;
+    ReferenceXoshiro lanes[GiantNoise::lanes];
+    uint64_t mix = seed;
+    for (auto& lane : lanes) {
+        const uint64_t a = ReferenceXoshiro::splitMix64(mix);
+        const uint64_t b = ReferenceXoshiro::splitMix64(mix);
+        lane.s[0] = static_cast<uint32_t>(a);
+        lane.s[1] = static_cast<uint32_t>(a >> 32);
+        lane.s[2] = static_cast<uint32_t>(b);
+        lane.s[3] = static_cast<uint32_t>(b >> 32) | 1u;
+    }
+
+    const int numSamples = 4096;
+    GiantNoise noise(seed);
+    std::vector<float> first(numSamples);
+    int mismatches = 0;
+    double mean = 0.0;
+    for (int i = 0; i < numSamples; ++i) {
+        first[static_cast<size_t>(i)] = noise.nextUniform();
+        const uint32_t expected = lanes[i % GiantNoise::lanes].next();
+        if (first[static_cast<size_t>(i)] != static_cast<float>(expected >> 8) / 16777216.0f)
+            ++mismatches;
+        mean += first[static_cast<size_t>(i)];
+    }
+    mean /= numSamples;
+
+    std::cout << "    " << mismatches << " mismatches against the reference in " << numSamples
+              << " samples, mean " << mean << std::endl;
+
+    if (mismatches != 0 || std::abs(mean - 0.5) > 0.02) {
+        stats.fail("noise_sequence", "Block generator is not xoshiro128+");
+        return false;
+    }
+
+    // Reseeding restarts the sequence; per-voice streams are distinct
+    noise.seed(seed);
+    for (int i = 0; i < numSamples; ++i) {
+        if (noise.nextUniform() != first[static_cast<size_t>(i)]) {
+            stats.fail("noise_reseed", "Reseeding does not restart the sequence");
+            return false;
+        }
+    }
+
+    GiantNoise voice0(GiantNoise::deriveSeed(seed, 0)), voice1(GiantNoise::deriveSeed(seed, 1));
+    int equal = 0;
+    for (int i = 0; i < numSamples; ++i)
+        equal += (voice0.nextUniform() == voice1.nextUniform()) ? 1 : 0;
+
+    if (equal > 4) {
+        stats.fail("noise_streams", "Derived voice streams are not independent");
+        return false;
+    }
+
+    // Engine seed: same seed, same render; another seed, another growl
+    auto play = [](float noiseSeed, std::vector<float>& left) {
+        AetherGiantHornsPureDSP synth;
+        synth.prepare(48000.0, 512);
+        synth.setRenderProfile(GiantRenderProfile::Offline);
+        synth.setParameter("growlAmount", 1.0f);
+        synth.setParameter("chaosThreshold", 0.0f);     // Growl from the first breath
+        synth.setParameter("noiseSeed", noiseSeed);
+
+        left.assign(96000, 0.0f);          // Horns speak after about a second
+        std::vector<float> right(left.size());
+        noteOn(synth, 41, 0.9f);
+        render(synth, left, right);
+    };
+
+    std::vector<float> a, b, c;
+    play(7.0f, a);
+    play(7.0f, b);
+    play(8.0f, c);
+
+    float level = 0.0f, difference = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) {
+        level = std::max(level, std::abs(a[i]));
+        difference = std::max(difference, std::abs(a[i] - c[i]));
+    }
+
+    std::cout << "    Seed 7 vs 8: max difference " << difference << " (peak " << level << ")" << std::endl;
+
+    if (level <= 0.0f || std::memcmp(a.data(), b.data(), sizeof(float) * a.size()) != 0) {
+        stats.fail("noise_engine_seed", "Same seed did not reproduce the render");
+        return false;
+    }
+
+    if (!(difference > 1.0e-4f * level)) {
+        stats.fail("noise_engine_seed", "Seed does not reach the growl noise");
+        return false;
+    }
+
+    stats.pass("noise");
+    return true;
+}
+
+//==============================================================================
+// Test 2: Tuning Hand-Off
+//==============================================================================
+
+bool testTuning(TestStats& stats) {
+    std::cout << "\n[Test 2] Tuning Hand-Off" << std::endl;
+
+    // Message thread publishes tables whose every entry is their sequence
+    // number; the audio thread must only ever see whole, live, newer tables
+    GiantTuningPublisher publisher;
+    const int numTables = 20000;
+    std::atomic<bool> done { false };
+    int acquired = 0, torn = 0, backwards = 0;
+
+    std::thread audioThread([&] {
+        float last = 0.0f;
+        while (!done.load()) {
+            const GiantTuningTable* table = publisher.acquire();
+            if (table == nullptr)
+                continue;
+
+            const float version = table->getFrequency(0);
+            for (int note = 1; note < GiantTuningTable::numNotes; ++note)
+                torn += (table->getFrequency(note) != version) ? 1 : 0;
+            backwards += (version < last) ? 1 : 0;
+            last = version;
+            ++acquired;
+        }
+    });
+
+    for (int i = 1; i <= numTables; ++i) {
+        const float version = static_cast<float>(i);
+        publisher.publish(std::make_unique<const GiantTuningTable>([version](int) { return version; }));
+    }
+    done.store(true);
+    audioThread.join();
+
+    std::cout << "    " << numTables << " tables published, " << acquired << " acquires, " << torn
+              << " torn reads, " << backwards << " stale" << std::endl;
+
+    if (torn != 0 || backwards != 0 || publisher.acquire()->getFrequency(64) != static_cast<float>(numTables)) {
+        stats.fail("tuning_publish", "Audio thread read a freed or stale table");
+        return false;
+    }
+
+    // Quarter-tone sharp: new notes start on the table, sounding ones glide to it
+    const GiantTuningTable quarterSharp([](int note) { return 440.0 * std::pow(2.0, (note - 68.5) / 12.0); });
+
+    GiantHornVoiceManager voices;
+    voices.prepare(48000.0, 4);
+    voices.handleNoteOn(41, 0.8f, GiantGestureParameters(), GiantScaleParameters());
+    GiantHornVoice* sounding = voices.findVoiceForNote(41);
+    const float before = sounding->pitch.frequency;
+
+    voices.setTuningTable(quarterSharp);
+    for (int i = 0; i < 4800; ++i)
+        voices.processSample();
+
+    voices.handleNoteOn(45, 0.8f, GiantGestureParameters(), GiantScaleParameters());
+    const float fresh = voices.findVoiceForNote(45)->pitch.frequency;
+
+    std::printf("    Note 41: %.3f Hz -> %.3f Hz (table %.3f), note 45 starts at %.3f Hz\n",
+                before, sounding->pitch.frequency, quarterSharp.getFrequency(41), fresh);
+
+    if (before != GiantTuningTable::equalTemperament().getFrequency(41)
+        || sounding->pitch.frequency != quarterSharp.getFrequency(41)
+        || fresh != quarterSharp.getFrequency(45)) {
+        stats.fail("tuning_retune", "Voices do not follow the published table");
+        return false;
+    }
+
+    stats.pass("tuning");
+    return true;
+}
+
+//==============================================================================
+// Test 3: Engine-Rate Upsampler
+//==============================================================================
+
+bool testUpsampler(TestStats& stats) {
+    std::cout << "\n[Test 3] Engine-Rate Upsampler" << std::endl;
+
+    const double engineRate = 48000.0;
+    const double pi = 3.14159265358979323846;
+
+    for (int factor : { 2, 4 }) {
+        GiantUpsampler upsampler;
+        upsampler.prepare(factor);
+
+        // Linear phase: an impulse comes out centred on the reported latency
+        std::vector<float> impulse(64, 0.0f), response(static_cast<size_t>(64 * factor));
+        impulse[0] = 1.0f;
+        const float* impulseIn[] = { impulse.data() };
+        float* responseOut[] = { response.data() };
+        upsampler.process(impulseIn, responseOut, 1, 64);
+        const auto peak = std::max_element(response.begin(), response.end(),
+                                           [](float a, float b) { return std::abs(a) < std::abs(b); });
+
+        if (upsampler.getLatencySamples() != factor * GiantUpsampler::tapsPerPhase / 2
+            || peak - response.begin() != upsampler.getLatencySamples()) {
+            stats.fail("upsampler_latency", "Impulse peak is not at the reported latency");
+            return false;
+        }
+
+        // 22 and 23.9 kHz sit in the transition band; their images land just
+        // above the engine Nyquist, where the stopband must already hold
+        for (double frequency : { 100.0, 1000.0, 10000.0, 20000.0, 22000.0, 23900.0 }) {
+            upsampler.reset();
+
+            const int numInput = 9600;
+            std::vector<float> input(numInput), output(static_cast<size_t>(numInput * factor));
+            for (int i = 0; i < numInput; ++i)
+                input[static_cast<size_t>(i)] = 0.5f * static_cast<float>(std::sin(2.0 * pi * frequency * i / engineRate));
+
+            const float* in[] = { input.data() };
+            float* out[] = { output.data() };
+            upsampler.process(in, out, 1, numInput);
+
+            // Least-squares fit of the tone at the host rate (past the start-up
+            // transient); what is left over is the images, taken against the
+            // input level since transition-band tones are themselves cut
+            const double hostRate = engineRate * factor;
+            const size_t start = static_cast<size_t>(numInput);
+            double ss = 0.0, sc = 0.0, cc = 0.0, ys = 0.0, yc = 0.0;
+            for (size_t i = start; i < output.size(); ++i) {
+                const double s = std::sin(2.0 * pi * frequency * i / hostRate);
+                const double c = std::cos(2.0 * pi * frequency * i / hostRate);
+                ss += s * s;
+                sc += s * c;
+                cc += c * c;
+                ys += output[i] * s;
+                yc += output[i] * c;
+            }
+            const double determinant = ss * cc - sc * sc;
+            const double a = (ys * cc - yc * sc) / determinant;
+            const double b = (yc * ss - ys * sc) / determinant;
+
+            double residual = 0.0;
+            for (size_t i = start; i < output.size(); ++i) {
+                const double e = output[i] - a * std::sin(2.0 * pi * frequency * i / hostRate)
+                                 - b * std::cos(2.0 * pi * frequency * i / hostRate);
+                residual += e * e;
+            }
+
+            const double amplitude = std::sqrt(a * a + b * b);
+            const double gainDb = 20.0 * std::log10(amplitude / 0.5);
+            const double imagesDb = 20.0 * std::log10(std::sqrt(residual / (output.size() - start))
+                                                      / (0.5 / std::sqrt(2.0)));
+            std::printf("    %dx, %5.0f Hz: gain %+.4f dB, images %.1f dB\n", factor, frequency, gainDb, imagesDb);
+
+            if (frequency <= 20000.0 && std::abs(gainDb) > 0.01) {
+                stats.fail("upsampler_passband", "Passband is not flat to 20 kHz");
+                return false;
+            }
+
+            if (imagesDb > -80.0) {
+                stats.fail("upsampler_images", "Images are less than 80 dB down");
+                return false;
+            }
+        }
+    }
+
+    stats.pass("upsampler");
+    return true;
+}
+
+//==============================================================================
+// Test 4: Spatial Encoding
+//==============================================================================
+
+bool testSpatial(TestStats& stats) {
+    std::cout << "\n[Test 4] Spatial Encoding" << std::endl;
+
+    const float degrees = 3.14159265358979323846f / 180.0f;
+
+    // First-order AmbiX: W, Y, Z, X = 1, sin(az) cos(el), sin(el), cos(az) cos(el)
+    GiantSpatialEncoder ambisonic;
+    ambisonic.configureAmbisonic(1);
+    float worstAmbisonic = 0.0f;
+    for (float azimuth : { 0.0f, 30.0f, 90.0f, -135.0f, 180.0f }) {
+        for (float elevation : { 0.0f, 20.0f, -45.0f, 90.0f }) {
+            float gains[GiantSpatialEncoder::maxChannels];
+            ambisonic.computeGains(azimuth, elevation, gains);
+
+            const float expected[4] = { 1.0f, std::sin(azimuth * degrees) * std::cos(elevation * degrees),
+                                        std::sin(elevation * degrees),
+                                        std::cos(azimuth * degrees) * std::cos(elevation * degrees) };
+            for (int ch = 0; ch < 4; ++ch)
+                worstAmbisonic = std::max(worstAmbisonic, std::abs(gains[ch] - expected[ch]));
+        }
+    }
+
+    std::cout << "    First order: max gain error " << worstAmbisonic << std::endl;
+
+    if (ambisonic.getNumChannels() != 4 || worstAmbisonic > 1.0e-5f) {
+        stats.fail("spatial_ambisonic", "First-order gains are not ACN/SN3D");
+        return false;
+    }
+
+    // 5.1 in host order L R C LFE Ls Rs: a source between C and L pans on that
+    // pair at constant power; the LFE never gets a direct feed
+    GiantSpatialEncoder bed;
+    bed.configureSpeakers({ { 30.0f, 0.0f, false }, { -30.0f, 0.0f, false }, { 0.0f, 0.0f, false },
+                            { 0.0f, 0.0f, true }, { 110.0f, 0.0f, false }, { -110.0f, 0.0f, false } });
+
+    for (float azimuth : { 0.0f, 10.0f, 15.0f, 30.0f }) {
+        float gains[GiantSpatialEncoder::maxChannels];
+        bed.computeGains(azimuth, 0.0f, gains);
+        const float power = gains[0] * gains[0] + gains[2] * gains[2];
+        std::printf("    5.1 at %2.0f deg: L %.3f C %.3f (power %.4f), R %.3f LFE %.3f Ls %.3f Rs %.3f\n",
+                    azimuth, gains[0], gains[2], power, gains[1], gains[3], gains[4], gains[5]);
+
+        if (std::abs(power - 1.0f) > 1.0e-5f || gains[1] != 0.0f || gains[3] != 0.0f || gains[4] != 0.0f
+            || gains[5] != 0.0f) {
+            stats.fail("spatial_bed", "Bed source is not a constant-power pair");
+            return false;
+        }
+    }
+
+    float centre[GiantSpatialEncoder::maxChannels], left[GiantSpatialEncoder::maxChannels];
+    bed.computeGains(0.0f, 0.0f, centre);
+    bed.computeGains(30.0f, 0.0f, left);
+    if (std::abs(centre[2] - 1.0f) > 1.0e-5f || std::abs(left[0] - 1.0f) > 1.0e-5f) {
+        stats.fail("spatial_bed", "Source on a speaker does not play from that speaker alone");
+        return false;
+    }
+
+    // Horns stems sum to the mono output
+    const int length = 96000;          // Horns speak after about a second
+    AetherGiantHornsPureDSP mixed, stemmed;
+    for (auto* synth : { &mixed, &stemmed }) {
+        synth->prepare(48000.0, 512);
+        synth->setRenderProfile(GiantRenderProfile::Offline);
+        noteOn(*synth, 41, 0.8f);
+        noteOn(*synth, 48, 0.6f);
+    }
+
+    const int numStems = stemmed.getNumStems();
+    std::vector<std::vector<float>> stems(static_cast<size_t>(numStems), std::vector<float>(512));
+    std::vector<float*> stemPointers;
+    for (auto& stem : stems)
+        stemPointers.push_back(stem.data());
+    std::vector<GiantStemPosition> positions(static_cast<size_t>(numStems));
+
+    std::vector<float> mixedLeft(512), mixedRight(512);
+    float difference = 0.0f, level = 0.0f;
+    int activeStems = 0;
+    for (int offset = 0; offset < length; offset += 512) {
+        float* outputs[] = { mixedLeft.data(), mixedRight.data() };
+        mixed.process(outputs, 2, 512);
+        stemmed.processStems(stemPointers.data(), positions.data(), 512);
+
+        for (int i = 0; i < 512; ++i) {
+            float sum = 0.0f;
+            for (int s = 0; s < numStems; ++s)
+                sum += stems[static_cast<size_t>(s)][static_cast<size_t>(i)];
+            difference = std::max(difference, std::abs(sum - mixedLeft[static_cast<size_t>(i)]));
+            level = std::max(level, std::abs(mixedLeft[static_cast<size_t>(i)]));
+        }
+    }
+    for (const auto& position : positions)
+        activeStems += position.active ? 1 : 0;
+
+    std::cout << "    Horns: " << activeStems << " active stems, sum vs process(): max difference "
+              << difference << " (peak " << level << ")" << std::endl;
+
+    if (activeStems != 2 || level <= 0.0f || difference > 1.0e-5f * level) {
+        stats.fail("spatial_stems", "Stems do not sum to the mono output");
+        return false;
+    }
+
+    stats.pass("spatial");
+    return true;
+}
+
+//==============================================================================
+// Main Test Runner
+//==============================================================================
+
+int main(int argc, char* argv[]) {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "AetherGiantHorns Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestStats stats;
+
+    testNoise(stats);
+    testTuning(stats);
+    testUpsampler(stats);
+    testSpatial(stats);
+
+    stats.printSummary();
+
+    return (stats.failed == 0) ? 0 : 1;
+}
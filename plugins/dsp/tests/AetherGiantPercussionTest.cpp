@@ -0,0 +1,413 @@
+/*
+  ==============================================================================
+
+    AetherGiantPercussionTest.cpp
+
+    Behaviour tests for Aether Giant Percussion (modal gongs, bells, plates)
+
+  ==============================================================================
+*/
+
+#include "JuceStandaloneConfig.h"
+#include <juce_core/juce_core.h>
+#include <juce_dsp/juce_dsp.h>
+#include "../include/dsp/AetherGiantPercussionDSP.h"
+#include "../include/dsp/GiantParameterQueue.h"
+#include <iostream>
+#include <cstdio>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace DSP;
+
+//==============================================================================
+// Test Result Tracking
+//==============================================================================
+
+struct TestStats {
+    int passed = 0;
+    int failed = 0;
+    int total = 0;
+
+    void pass(const char* testName) {
+        total++;
+        passed++;
+        std::cout << "  [PASS] " << testName << std::endl;
+    }
+
+    void fail(const char* testName, const std::string& reason) {
+        total++;
+        failed++;
+        std::cout << "  [FAIL] " << testName << ": " << reason << std::endl;
+    }
+
+    void printSummary() {
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "Test Summary: " << passed << "/" << total << " passed";
+        if (failed > 0) {
+            std::cout << " (" << failed << " failed)";
+        }
+        std::cout << "\n========================================" << std::endl;
+    }
+};
+
+//==============================================================================
+// Audio Utilities
+//==============================================================================
+
+void render(AetherGiantPercussionPureDSP& synth, std::vector<float>& left, std::vector<float>& right,
+            int bufferSize = 512) {
+    const int numSamples = static_cast<int>(left.size());
+    for (int offset = 0; offset < numSamples; offset += bufferSize) {
+        int samplesToProcess = std::min(bufferSize, numSamples - offset);
+        float* outputs[] = { left.data() + offset, right.data() + offset };
+        synth.process(outputs, 2, samplesToProcess);
+    }
+}
+
+void noteOn(AetherGiantPercussionPureDSP& synth, int note, float velocity) {
+    ScheduledEvent event;
+    event.type = ScheduledEvent::NOTE_ON;
+    event.time = 0.0;
+    event.sampleOffset = 0;
+    event.data.note.midiNote = note;
+    event.data.note.velocity = velocity;
+    synth.handleEvent(event);
+}
+
+float getRms(const float* buffer, int numSamples) {
+    double sum = 0.0;
+    for (int i = 0; i < numSamples; ++i)
+        sum += static_cast<double>(buffer[i]) * buffer[i];
+    return static_cast<float>(std::sqrt(sum / numSamples));
+}
+
+//==============================================================================
+// Test 1: Queued Parameter Writes
+//==============================================================================
+
+bool testQueuedParameters(TestStats& stats) {
+    std::cout << "\n[Test 1] Queued Parameter Writes" << std::endl;
+
+    AetherGiantPercussionPureDSP synth;
+    synth.prepare(48000.0, 512);
+
+    // The message thread queues; the audio thread applies at the next block,
+    // as GiantInstrumentsPluginProcessor::applyQueuedParameters does
+    GiantParameterQueue queue;
+    std::thread messageThread([&queue] {
+        queue.push("damping", 0.37f);
+        queue.push("materialHardness", 0.81f);
+        queue.push("damping", 0.42f);
+    });
+    messageThread.join();
+
+    while (const GiantParameterEvent* queued = queue.front(0)) {
+        synth.setParameter(queued->paramId, queued->value);
+        queue.pop();
+    }
+
+    std::vector<float> left(512), right(512);
+    render(synth, left, right);
+
+    if (synth.getParameter("damping") != 0.42f || synth.getParameter("materialHardness") != 0.81f) {
+        stats.fail("queued_parameters", "Queued write not visible after one block");
+        return false;
+    }
+
+    // A write for an engine the audio thread has not picked up yet waits for
+    // it; writes for a switched-out engine (earlier generation) are dropped
+    queue.push("damping", 0.9f, 0, 1);
+    queue.push("damping", 0.5f, 128, 2);
+    queue.push("damping", 0.6f, 0, 1);
+    const GiantParameterEvent* next = queue.front(1);
+    if (next == nullptr || next->value != 0.9f) {
+        stats.fail("queued_parameters_generation", "Write for the current engine not returned");
+        return false;
+    }
+    queue.pop();
+    if (queue.front(1) != nullptr) {
+        stats.fail("queued_parameters_generation", "Write for the next engine applied early");
+        return false;
+    }
+    next = queue.front(2);
+    if (next == nullptr || next->value != 0.5f || next->sampleOffset != 128) {
+        stats.fail("queued_parameters_generation", "Write for the next engine lost");
+        return false;
+    }
+    queue.pop();
+    if (queue.front(2) != nullptr) {
+        stats.fail("queued_parameters_generation", "Stale write not dropped");
+        return false;
+    }
+
+    stats.pass("queued_parameters");
+    return true;
+}
+
+//==============================================================================
+// Test 2: Same-Note Re-Excitation
+//==============================================================================
+
+bool testReExcite(TestStats& stats) {
+    std::cout << "\n[Test 2] Same-Note Re-Excitation" << std::endl;
+
+    // Offline profile throughout: no CPU budget governor (timing dependent)
+    // and every mode on every hit, so renders are comparable sample for sample
+    auto makeSynth = [](AetherGiantPercussionPureDSP& synth) {
+        synth.prepare(48000.0, 512);
+        synth.setRenderProfile(GiantRenderProfile::Offline);
+    };
+
+    // A 16 hits/s roll on one note: one voice when re-exciting, a new voice per hit otherwise
+    int peakVoices[2] = {};
+    for (int policy = 0; policy < 2; ++policy) {
+        AetherGiantPercussionPureDSP synth;
+        makeSynth(synth);
+        synth.setParameter("reExcite", (policy == 0) ? 1.0f : 0.0f);
+        while (synth.warmUpVoices(8) > 0) {}
+
+        std::vector<float> left(3000), right(3000);
+        for (int hit = 0; hit < 32; ++hit) {
+            noteOn(synth, 48, 0.7f);
+            render(synth, left, right);
+            peakVoices[policy] = std::max(peakVoices[policy], synth.getActiveVoiceCount());
+        }
+    }
+
+    std::cout << "    Roll peak voices: " << peakVoices[0] << " re-excited, " << peakVoices[1]
+              << " one per hit" << std::endl;
+
+    if (peakVoices[0] != 1 || peakVoices[1] < 8) {
+        stats.fail("reexcite_roll", "Roll did not stay on one voice");
+        return false;
+    }
+
+    // A soft hit on a loud tail, against the tail alone and the soft hit alone
+    const int hitAt = 2400;             // 50 ms in: the loud tail is still ringing hard
+    const int length = 24000;
+    AetherGiantPercussionPureDSP tail, reStruck, softAlone;
+    std::vector<float> tailOut(length), reStruckOut(length), softOut(length), scratch(length);
+
+    for (auto* synth : { &tail, &reStruck, &softAlone })
+        makeSynth(*synth);
+
+    auto renderRange = [&scratch](AetherGiantPercussionPureDSP& synth, std::vector<float>& out, int start, int end) {
+        for (int offset = start; offset < end; offset += 512) {
+            const int n = std::min(512, end - offset);
+            float* outputs[] = { out.data() + offset, scratch.data() + offset };
+            synth.process(outputs, 2, n);
+        }
+    };
+
+    noteOn(tail, 48, 0.9f);
+    noteOn(reStruck, 48, 0.9f);
+    renderRange(tail, tailOut, 0, hitAt);
+    renderRange(reStruck, reStruckOut, 0, hitAt);
+    renderRange(softAlone, softOut, 0, hitAt);
+
+    noteOn(reStruck, 48, 0.2f);
+    noteOn(softAlone, 48, 0.2f);
+    renderRange(tail, tailOut, hitAt, length);
+    renderRange(reStruck, reStruckOut, hitAt, length);
+    renderRange(softAlone, softOut, hitAt, length);
+
+    // Continuous: the tail rings on undisturbed and the new hit adds at its own
+    // level (a re-strike that restarted, skipped or re-scaled the tail would not sum)
+    float deviation = 0.0f;
+    float softPeak = 0.0f;
+    for (int i = hitAt; i < length; ++i) {
+        deviation = std::max(deviation, std::abs(reStruckOut[i] - tailOut[i] - softOut[i]));
+        softPeak = std::max(softPeak, std::abs(softOut[i]));
+    }
+
+    std::cout << "    Re-strike vs tail + fresh hit: max deviation " << deviation
+              << " (soft hit peak " << softPeak << ")" << std::endl;
+
+    if (reStruck.getActiveVoiceCount() != 1 || deviation > 1.0e-3f * softPeak) {
+        stats.fail("reexcite_continuity", "Re-strike is not the tail plus the new hit");
+        return false;
+    }
+
+    stats.pass("reexcite");
+    return true;
+}
+
+//==============================================================================
+// Test 3: Mode Level of Detail
+//==============================================================================
+
+bool testModeDetail(TestStats& stats) {
+    std::cout << "\n[Test 3] Mode Level of Detail" << std::endl;
+
+    GiantPercussionVoice voice;
+    voice.prepare(48000.0);
+    ModalResonatorBank::Parameters bank;
+    bank.numModes = 64;
+    voice.resonator.setParameters(bank);
+
+    GiantGestureParameters gesture;
+    GiantScaleParameters scale;
+    auto modesFor = [&](float velocity, int activeVoices, float distanceMeters, bool fullDetail) {
+        GiantModeDetail::Context context;
+        context.velocity = velocity;
+        context.airLoss = scale.airLoss;
+        context.distanceMeters = distanceMeters;
+        context.activeVoices = activeVoices;
+        context.fullDetail = fullDetail;
+        voice.trigger(48, velocity, gesture, scale, context);
+        return voice.detailModes;
+    };
+
+    const int loud = modesFor(0.9f, 0, 10.0f, false);
+    const int soft = modesFor(0.3f, 0, 10.0f, false);
+    const int crowded = modesFor(0.3f, 16, 10.0f, false);
+    const int distant = modesFor(0.9f, 0, 100.0f, false);
+    const int offline = modesFor(0.3f, 16, 100.0f, true);
+    std::cout << "    Modes: loud " << loud << ", soft " << soft << ", soft among 16 " << crowded
+              << ", loud at 100 m " << distant << ", offline " << offline << std::endl;
+
+    // Foreground hits keep every audible mode; soft, crowded and distant ones fewer
+    if (loud != 64 || offline != 64 || !(soft < loud) || !(crowded < soft) || !(distant < loud)) {
+        stats.fail("mode_detail_trigger", "Trigger-time mode count ignores the hit");
+        return false;
+    }
+
+    // Sixteen background hits cost half the detail each: total grows with sqrt(N)
+    if (std::abs(crowded - soft / 2) > 1) {
+        stats.fail("mode_detail_density", "Dense passage does not scale by 1/sqrt(N)");
+        return false;
+    }
+
+    // Over the tail the top modes drop out as they fall 60 dB under the loudest
+    modesFor(0.9f, 0, 10.0f, false);
+    float left = 0.0f, right = 0.0f;
+    for (int i = 0; i < 48000 && voice.isActive(); ++i)
+        voice.processSample(left, right);
+
+    std::cout << "    Modes after 1 s of tail: " << voice.detailModes << std::endl;
+
+    if (voice.isActive() && voice.detailModes >= loud) {
+        stats.fail("mode_detail_tail", "Tail kept every mode");
+        return false;
+    }
+
+    // What is dropped is inaudible: a soft hit sounds the same with every mode
+    float levels[2] = {};
+    for (int profile = 0; profile < 2; ++profile) {
+        AetherGiantPercussionPureDSP synth;
+        synth.prepare(48000.0, 512);
+        synth.setParameter("numModes", 64.0f);
+        synth.setParameter("cpuBudget", 1.0f);
+        synth.setRenderProfile((profile == 0) ? GiantRenderProfile::Realtime : GiantRenderProfile::Offline);
+
+        std::vector<float> leftOut(96000), rightOut(96000);
+        noteOn(synth, 48, 0.3f);
+        render(synth, leftOut, rightOut);
+        levels[profile] = getRms(leftOut.data(), 96000);
+    }
+
+    const float levelError = std::abs(levels[0] / levels[1] - 1.0f);
+    std::cout << "    Soft hit RMS: reduced detail " << levels[0] << ", every mode " << levels[1] << std::endl;
+
+    if (levelError > 0.01f) {
+        stats.fail("mode_detail_output", "Reduced detail changes the level by more than 1%");
+        return false;
+    }
+
+    stats.pass("mode_detail");
+    return true;
+}
+
+//==============================================================================
+// Test 4: Render Profile Switching
+//==============================================================================
+
+bool testRenderProfile(TestStats& stats) {
+    std::cout << "\n[Test 4] Render Profile Switching" << std::endl;
+
+    // A soft hit: realtime renders it with reduced detail (see Test 3)
+    const int length = 48000;
+    auto play = [length](std::initializer_list<GiantRenderProfile> beforeHit, GiantRenderProfile afterHit,
+                         std::vector<float>& left) {
+        AetherGiantPercussionPureDSP synth;
+        synth.prepare(48000.0, 512);
+        synth.setParameter("numModes", 64.0f);
+        synth.setParameter("cpuBudget", 1.0f);
+        for (GiantRenderProfile profile : beforeHit)
+            synth.setRenderProfile(profile);
+
+        left.assign(length, 0.0f);
+        std::vector<float> right(length);
+        noteOn(synth, 48, 0.3f);
+        std::vector<float> head(4800), headRight(4800);
+        render(synth, head, headRight);
+        std::copy(head.begin(), head.end(), left.begin());
+
+        // Switch while the note sounds
+        synth.setRenderProfile(afterHit);
+        std::vector<float> tail(length - 4800), tailRight(length - 4800);
+        render(synth, tail, tailRight);
+        std::copy(tail.begin(), tail.end(), left.begin() + 4800);
+    };
+
+    auto same = [length](const std::vector<float>& a, const std::vector<float>& b) {
+        return std::memcmp(a.data(), b.data(), sizeof(float) * length) == 0;
+    };
+
+    std::vector<float> realtime, offline, roundTrip, offlineThenRealtime;
+    play({}, GiantRenderProfile::Realtime, realtime);
+    play({ GiantRenderProfile::Offline }, GiantRenderProfile::Offline, offline);
+    play({ GiantRenderProfile::Offline, GiantRenderProfile::Realtime }, GiantRenderProfile::Realtime, roundTrip);
+    play({ GiantRenderProfile::Offline }, GiantRenderProfile::Realtime, offlineThenRealtime);
+
+    float difference = 0.0f;
+    for (int i = 0; i < length; ++i)
+        difference = std::max(difference, std::abs(realtime[i] - offline[i]));
+    std::cout << "    Realtime vs offline soft hit: max difference " << difference << std::endl;
+
+    // The profile reaches the voices
+    if (same(realtime, offline)) {
+        stats.fail("render_profile_offline", "Offline profile renders as realtime");
+        return false;
+    }
+
+    // Switching back restores realtime exactly
+    if (!same(realtime, roundTrip)) {
+        stats.fail("render_profile_back", "Offline -> realtime differs from a fresh realtime engine");
+        return false;
+    }
+
+    // A sounding note keeps the detail it was struck with
+    if (!same(offline, offlineThenRealtime)) {
+        stats.fail("render_profile_sounding", "Switching profile changed a sounding note");
+        return false;
+    }
+
+    stats.pass("render_profile");
+    return true;
+}
+
+//==============================================================================
+// Main Test Runner
+//==============================================================================
+
+int main(int argc, char* argv[]) {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "AetherGiantPercussion Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestStats stats;
+
+    testQueuedParameters(stats);
+    testReExcite(stats);
+    testModeDetail(stats);
+    testRenderProfile(stats);
+
+    stats.printSummary();
+
+    return (stats.failed == 0) ? 0 : 1;
+}
@@ -14,9 +14,13 @@
 #include <juce_core/juce_core.h>
 #include <juce_dsp/juce_dsp.h>
 #include "../include/dsp/AetherGiantVoiceDSP.h"
+#include "../tools/GiantFormantAnalysis.h"
 #include <iostream>
 #include <cstdio>
 #include <cmath>
+#include <cstring>
+#include <limits>
+#include <thread>
 #include <vector>
 
 using namespace DSP;
@@ -348,6 +352,435 @@ bool testStereoOutput(TestStats& stats) {
     return true;
 }
 
+//==============================================================================
+// Test 8: Lazy Voice Preparation
+//==============================================================================
+
+bool testLazyVoicePreparation(TestStats& stats) {
+    std::cout << "\n[Test 8] Lazy Voice Preparation" << std::endl;
+
+    AetherGiantVoicePureDSP synth;
+    synth.prepare(48000.0, 512);
+
+    const int maxVoices = synth.getMaxPolyphony();
+    const int eager = synth.getPreparedVoiceCount();
+    std::cout << "    Prepared after prepare(): " << eager << "/" << maxVoices << std::endl;
+
+    if (eager <= 0 || eager >= maxVoices) {
+        stats.fail("lazy_prepare", "Expected a small eager pool");
+        return false;
+    }
+
+    // Note-ons never prepare (allocate) a cold voice: beyond the eager pool they steal
+    auto playAll = [maxVoices](AetherGiantVoicePureDSP& target) {
+        for (int i = 0; i < maxVoices; ++i) {
+            ScheduledEvent event;
+            event.type = ScheduledEvent::NOTE_ON;
+            event.time = 0.0;
+            event.sampleOffset = 0;
+            event.data.note.midiNote = 48 + i;
+            event.data.note.velocity = 0.7f;
+            target.handleEvent(event);
+        }
+    };
+
+    playAll(synth);
+
+    if (synth.getPreparedVoiceCount() != eager || synth.getActiveVoiceCount() != eager) {
+        stats.fail("lazy_trigger", "Note-on prepared a cold voice");
+        return false;
+    }
+
+    // The warm-up runs beside the audio thread (no lock): keep rendering
+    // and playing the eager pool while another thread warms the rest
+    AetherGiantVoicePureDSP warm;
+    warm.prepare(48000.0, 512);
+
+    std::thread warmUp([&warm] {
+        int cold = warm.warmUpVoices(1);
+        while (cold > 0)
+            cold = warm.warmUpVoices(1);
+    });
+
+    std::vector<float> left(512), right(512);
+    float* outputs[] = { left.data(), right.data() };
+    for (int block = 0; block < 64; ++block) {
+        ScheduledEvent event;
+        event.type = ScheduledEvent::NOTE_ON;
+        event.time = 0.0;
+        event.sampleOffset = 0;
+        event.data.note.midiNote = 36 + block % 12;
+        event.data.note.velocity = 0.5f;
+        warm.handleEvent(event);
+        warm.process(outputs, 2, 512);
+    }
+
+    warmUp.join();
+    warm.reset();
+
+    if (warm.getPreparedVoiceCount() != maxVoices) {
+        stats.fail("lazy_warmup", "Warm-up did not prepare every voice");
+        return false;
+    }
+
+    // Once warm, full polyphony
+    playAll(warm);
+
+    if (warm.getActiveVoiceCount() != maxVoices) {
+        stats.fail("lazy_polyphony", "Warm voices did not start");
+        return false;
+    }
+
+    stats.pass("lazy_voice_preparation");
+    return true;
+}
+
+//==============================================================================
+// Test 9: Formant Trajectory
+//==============================================================================
+
+/** One second of a 120 Hz pulse train through four vocal-tract resonances */
+std::vector<float> synthesizeVowel(double sampleRate, const double* formants, const double* bandwidths) {
+    const double pi = 3.14159265358979323846;
+    const int period = static_cast<int>(sampleRate / 120.0);
+    std::vector<float> signal(static_cast<size_t>(sampleRate));
+    double y1[4] = {}, y2[4] = {};
+
+    for (size_t n = 0; n < signal.size(); ++n) {
+        double x = (n % period == 0) ? 1.0 : 0.0;
+        for (int k = 0; k < 4; ++k) {
+            const double r = std::exp(-pi * bandwidths[k] / sampleRate);
+            const double y = x + 2.0 * r * std::cos(2.0 * pi * formants[k] / sampleRate) * y1[k] - r * r * y2[k];
+            y2[k] = y1[k];
+            y1[k] = y;
+            x = y;
+        }
+        signal[n] = static_cast<float>(0.01 * x);
+    }
+    return signal;
+}
+
+bool testFormantTrajectory(TestStats& stats) {
+    std::cout << "\n[Test 9] Formant Trajectory" << std::endl;
+
+    using Frame = GiantFormantTrajectory::Frame;
+    const juce::File file = juce::File::createTempFile(".gftraj");
+
+    // Analyzer -> file -> loader: the analysis finds the resonances and the loader returns it unchanged
+    const double formants[4] = { 700.0, 1200.0, 2500.0, 3500.0 };
+    const double bandwidths[4] = { 80.0, 90.0, 120.0, 150.0 };
+    const auto analysis = GiantFormantAnalysis::analyze(synthesizeVowel(44100.0, formants, bandwidths), 44100.0, 100.0f);
+
+    const Frame& middle = analysis.frames[analysis.frames.size() / 2];
+    std::cout << "    Analyzed: F0 " << analysis.referenceF0 << " Hz, F1 " << middle.formantHz[0]
+              << " Hz, F2 " << middle.formantHz[1] << " Hz" << std::endl;
+
+    if (std::abs(analysis.referenceF0 - 120.0f) > 2.0f) {
+        stats.fail("trajectory_analysis", "Reference pitch not found");
+        return false;
+    }
+    for (int k = 0; k < GiantFormantTrajectory::numFormants; ++k) {
+        if (std::abs(middle.formantHz[k] - formants[k]) > 0.05 * formants[k]) {
+            stats.fail("trajectory_analysis", "Formant off by more than 5%");
+            return false;
+        }
+    }
+
+    if (!GiantFormantTrajectory::write(file, 100.0f, analysis.referenceF0, analysis.frames)) {
+        stats.fail("trajectory_write", "Could not write the trajectory");
+        return false;
+    }
+
+    auto loaded = GiantFormantTrajectory::load(file);
+    if (loaded == nullptr || loaded->getNumFrames() != static_cast<int>(analysis.frames.size())
+        || loaded->getFrameRate() != 100.0f || loaded->getReferenceF0() != analysis.referenceF0) {
+        stats.fail("trajectory_load", "Loaded header differs from the analysis");
+        return false;
+    }
+    for (size_t i = 0; i < analysis.frames.size(); ++i) {
+        const Frame frame = loaded->getFrame(i / 100.0);
+        if (std::memcmp(&frame, &analysis.frames[i], sizeof(Frame)) != 0) {
+            stats.fail("trajectory_load", "Loaded frame differs from the analysis");
+            return false;
+        }
+    }
+
+    // getFrame: linear between frames, voicing switches at the midpoint, last frame held
+    Frame voiced = {};
+    voiced.f0 = 100.0f;
+    voiced.level = 0.5f;
+    for (int k = 0; k < GiantFormantTrajectory::numFormants; ++k) {
+        voiced.formantHz[k] = 500.0f * (k + 1);
+        voiced.bandwidthHz[k] = 100.0f;
+    }
+    Frame higher = voiced;
+    higher.f0 = 200.0f;
+    higher.level = 1.0f;
+    higher.formantHz[0] = 700.0f;
+    Frame unvoiced = higher;
+    unvoiced.f0 = 0.0f;
+
+    GiantFormantTrajectory::write(file, 10.0f, 150.0f, { voiced, higher, unvoiced });
+    loaded = GiantFormantTrajectory::load(file);
+
+    const Frame quarter = loaded->getFrame(0.025);
+    const Frame beforeSwitch = loaded->getFrame(0.14);
+    const Frame afterSwitch = loaded->getFrame(0.16);
+    const Frame pastEnd = loaded->getFrame(5.0);
+
+    if (std::abs(quarter.f0 - 125.0f) > 1e-3f || std::abs(quarter.level - 0.625f) > 1e-6f
+        || std::abs(quarter.formantHz[0] - 550.0f) > 1e-3f) {
+        stats.fail("trajectory_interpolation", "Frames not interpolated linearly");
+        return false;
+    }
+    if (beforeSwitch.f0 != 200.0f || afterSwitch.f0 != 0.0f) {
+        stats.fail("trajectory_voicing", "Voicing did not switch at the midpoint");
+        return false;
+    }
+    if (std::memcmp(&pastEnd, &unvoiced, sizeof(Frame)) != 0) {
+        stats.fail("trajectory_hold", "Last frame not held past the end");
+        return false;
+    }
+
+    // The loader rejects frames the resonators cannot take
+    Frame bad = voiced;
+    bad.formantHz[1] = std::numeric_limits<float>::quiet_NaN();
+    GiantFormantTrajectory::write(file, 10.0f, 150.0f, { voiced, bad });
+    const bool rejectsNaN = (GiantFormantTrajectory::load(file) == nullptr);
+
+    bad = voiced;
+    bad.formantHz[3] = 30000.0f;
+    GiantFormantTrajectory::write(file, 10.0f, 150.0f, { voiced, bad });
+    const bool rejectsNyquist = (GiantFormantTrajectory::load(file) == nullptr);
+
+    if (!rejectsNaN || !rejectsNyquist) {
+        stats.fail("trajectory_validation", "Loader accepted an invalid frame");
+        return false;
+    }
+
+    // The voice follows a loaded phrase
+    GiantFormantTrajectory::write(file, 100.0f, analysis.referenceF0, analysis.frames);
+    AetherGiantVoicePureDSP synth;
+    synth.prepare(48000.0, 512);
+    synth.setFormantTrajectory(GiantFormantTrajectory::load(file));
+    file.deleteFile();
+
+    ScheduledEvent noteOn;
+    noteOn.type = ScheduledEvent::NOTE_ON;
+    noteOn.time = 0.0;
+    noteOn.sampleOffset = 0;
+    noteOn.data.note.midiNote = 48;
+    noteOn.data.note.velocity = 0.8f;
+    synth.handleEvent(noteOn);
+
+    std::vector<float> left(48000), right(48000);
+    processAudioInChunks(synth, left.data(), right.data(), 48000);
+
+    bool finite = true;
+    for (float sample : left)
+        finite = finite && std::isfinite(sample);
+
+    if (!finite || getPeakLevel(left.data(), 48000) <= 0.0f) {
+        stats.fail("trajectory_voice", "Voice silent or unstable on a phrase");
+        return false;
+    }
+
+    stats.pass("formant_trajectory");
+    return true;
+}
+
+//==============================================================================
+// Test 10: Modulation Matrix
+//==============================================================================
+
+bool testModMatrix(TestStats& stats) {
+    std::cout << "\n[Test 10] Modulation Matrix" << std::endl;
+
+    const int interval = 32;        // 1500 Hz control rate at 48 kHz
+    const float pi = 3.14159265358979323846f;
+
+    auto single = [](GiantModSource source, GiantModDestination destination, float depth) {
+        GiantModSettings settings;
+        settings.routes[0].source = source;
+        settings.routes[0].destination = static_cast<int>(destination);
+        settings.routes[0].depth = depth;
+        return settings;
+    };
+
+    // LFO shapes, read where each control ramp ends (7 Hz: no tick lands on a
+    // discontinuity). In between, values ramp linearly over exactly 32 samples.
+    const GiantLfoShape shapes[] = { GiantLfoShape::Sine, GiantLfoShape::Triangle, GiantLfoShape::Saw,
+                                     GiantLfoShape::Square, GiantLfoShape::SampleAndHold };
+    float worstShape = 0.0f, worstRamp = 0.0f;
+    int heldChanges = 0;
+
+    for (GiantLfoShape shape : shapes) {
+        GiantModSettings settings = single(GiantModSource::Lfo1, GiantModDestination::Pitch, 1.0f);
+        settings.lfos[0].rateHz = 7.0f;
+        settings.lfos[0].shape = shape;
+
+        GiantModMatrix matrix;
+        matrix.prepare(48000.0, 1);
+        matrix.setSettings(settings);
+        matrix.noteOn(0, 60, 1.0f);
+
+        float previous = 0.0f;
+        for (int tick = 1; tick <= 600; ++tick) {
+            float ramp[interval];
+            for (int i = 0; i < interval; ++i) {
+                matrix.advance();
+                ramp[i] = matrix.getValue(0, GiantModDestination::Pitch);
+            }
+
+            const float phase = static_cast<float>(tick * 7 % 1500) / 1500.0f;
+            const float value = ramp[interval - 1];
+            float expected = 0.0f;
+            switch (shape) {
+                case GiantLfoShape::Sine:     expected = std::sin(2.0f * pi * phase); break;
+                case GiantLfoShape::Triangle: expected = 1.0f - 4.0f * std::abs(phase - 0.5f); break;
+                case GiantLfoShape::Saw:      expected = 2.0f * phase - 1.0f; break;
+                case GiantLfoShape::Square:   expected = (phase < 0.5f) ? 1.0f : -1.0f; break;
+                default:
+                    // Sample and hold: a new value only when the phase wraps
+                    expected = (tick * 7 / 1500 != (tick - 1) * 7 / 1500) ? value : previous;
+                    heldChanges += (value != previous) ? 1 : 0;
+                    break;
+            }
+            worstShape = std::max(worstShape, std::abs(value - expected));
+
+            for (int i = 0; i < interval; ++i) {
+                const float line = previous + (value - previous) * static_cast<float>(i + 1) / interval;
+                worstRamp = std::max(worstRamp, std::abs(ramp[i] - line));
+            }
+            previous = value;
+        }
+    }
+
+    std::cout << "    LFO shapes: max error " << worstShape << ", ramp error " << worstRamp
+              << ", S&H steps " << heldChanges << std::endl;
+
+    // 600 ticks (0.4 s) at 7 Hz wrap twice
+    if (worstShape > 1.0e-3f || worstRamp > 1.0e-4f || heldChanges != 2) {
+        stats.fail("mod_lfo", "LFO shapes or control-rate ramps are wrong");
+        return false;
+    }
+
+    // ADSR: linear 100 ms attack, 50 ms decay to 0.5, 100 ms release
+    {
+        GiantModSettings settings = single(GiantModSource::Envelope, GiantModDestination::Level, 1.0f);
+        settings.envelope.attackSeconds = 0.1f;
+        settings.envelope.decaySeconds = 0.05f;
+        settings.envelope.sustain = 0.5f;
+        settings.envelope.releaseSeconds = 0.1f;
+
+        GiantModMatrix matrix;
+        matrix.prepare(48000.0, 1);
+        matrix.setSettings(settings);
+        matrix.noteOn(0, 60, 1.0f);
+
+        auto run = [&matrix](int samples) {
+            for (int i = 0; i < samples; ++i)
+                matrix.advance();
+            return matrix.getValue(0, GiantModDestination::Level);
+        };
+
+        const float halfAttack = run(2400);
+        const float sustained = run(4800 + 24000);
+        matrix.noteOff(0);
+        const float oneReleaseConstant = run(4800);
+        const float released = run(48000);
+
+        std::printf("    Envelope: %.4f at 50 ms, %.4f sustained, %.4f one release constant in, %g after 1 s\n",
+                    halfAttack, sustained, oneReleaseConstant, released);
+
+        if (std::abs(halfAttack - 0.5f) > 0.01f || std::abs(sustained - 0.5f) > 1.0e-3f
+            || std::abs(oneReleaseConstant - 0.5f * std::exp(-1.0f)) > 0.01f || released != 0.0f) {
+            stats.fail("mod_envelope", "Envelope stages are wrong");
+            return false;
+        }
+    }
+
+    // Removing the last route ramps to zero, then the matrix stops: exactly 0
+    {
+        GiantModSettings settings = single(GiantModSource::Lfo1, GiantModDestination::Pitch, 2.0f);
+        GiantModMatrix matrix;
+        matrix.prepare(48000.0, 1);
+        matrix.setSettings(settings);
+        matrix.noteOn(0, 60, 1.0f);
+        for (int i = 0; i < 1000; ++i)
+            matrix.advance();
+
+        matrix.setSettings(GiantModSettings());
+        int samplesToStop = 0;
+        while (matrix.isRunning() && samplesToStop < 48000) {
+            matrix.advance();
+            ++samplesToStop;
+        }
+
+        std::cout << "    Route removed: stopped after " << samplesToStop << " samples, value "
+                  << matrix.getValue(0, GiantModDestination::Pitch) << std::endl;
+
+        if (matrix.isRunning() || samplesToStop > 3 * interval
+            || matrix.getValue(0, GiantModDestination::Pitch) != 0.0f) {
+            stats.fail("mod_settle", "Matrix did not settle to exactly zero");
+            return false;
+        }
+    }
+
+    // Engine: no routes (default, or one added and removed) renders bit-identically
+    // to an untouched engine; an active route changes the output
+    auto play = [](int variant, std::vector<float>& left) {
+        AetherGiantVoicePureDSP synth;
+        synth.prepare(48000.0, 512);
+        synth.setRenderProfile(GiantRenderProfile::Offline);
+
+        if (variant == 1)
+            synth.getModMatrix().setSettings(GiantModSettings());
+        if (variant >= 2) {
+            GiantModSettings settings;
+            settings.routes[0].source = GiantModSource::Lfo1;
+            settings.routes[0].destination = static_cast<int>(GiantModDestination::Pitch);
+            settings.routes[0].depth = 0.5f;
+            synth.getModMatrix().setSettings(settings);
+        }
+        if (variant == 2)
+            synth.getModMatrix().setSettings(GiantModSettings());
+
+        left.assign(48000, 0.0f);
+        std::vector<float> right(left.size());
+        ScheduledEvent event;
+        event.type = ScheduledEvent::NOTE_ON;
+        event.time = 0.0;
+        event.sampleOffset = 0;
+        event.data.note.midiNote = 48;
+        event.data.note.velocity = 0.8f;
+        synth.handleEvent(event);
+        processAudioInChunks(synth, left.data(), right.data(), 48000);
+    };
+
+    std::vector<float> untouched, defaults, removed, routed;
+    play(0, untouched);
+    play(1, defaults);
+    play(2, removed);
+    play(3, routed);
+
+    const size_t bytes = sizeof(float) * untouched.size();
+    if (getPeakLevel(untouched.data(), 48000) <= 0.0f
+        || std::memcmp(untouched.data(), defaults.data(), bytes) != 0
+        || std::memcmp(untouched.data(), removed.data(), bytes) != 0) {
+        stats.fail("mod_idle", "Idle matrix changes the output");
+        return false;
+    }
+
+    if (std::memcmp(untouched.data(), routed.data(), bytes) == 0) {
+        stats.fail("mod_route", "Active route has no effect");
+        return false;
+    }
+
+    stats.pass("mod_matrix");
+    return true;
+}
+
 //==============================================================================
 // Main Test Runner
 //==============================================================================
@@ -366,6 +799,9 @@ int main(int argc, char* argv[]) {
     testAggression(stats);
     testSampleRates(stats);
     testStereoOutput(stats);
+    testLazyVoicePreparation(stats);
+    testFormantTrajectory(stats);
+    testModMatrix(stats);
 
     stats.printSummary();
 
@@ -0,0 +1,155 @@
+/*
+  ==============================================================================
+
+    GiantBatchRendererTest.cpp
+
+    Parallel batch renders of isolated notes vs. rendering each note alone
+
+  ==============================================================================
+*/
+
+#include "JuceStandaloneConfig.h"
+#include <juce_core/juce_core.h>
+#include <juce_dsp/juce_dsp.h>
+#include "../include/dsp/GiantBatchRenderer.h"
+#include "../include/dsp/AetherGiantDrumsDSP.h"
+#include "../include/dsp/AetherGiantHornsDSP.h"
+#include "../include/dsp/AetherGiantPercussionDSP.h"
+#include "../include/dsp/AetherGiantVoiceDSP.h"
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace DSP;
+
+//==============================================================================
+// Test Result Tracking
+//==============================================================================
+
+struct TestStats {
+    int passed = 0;
+    int failed = 0;
+    int total = 0;
+
+    void pass(const char* testName) {
+        total++;
+        passed++;
+        std::cout << "  [PASS] " << testName << std::endl;
+    }
+
+    void fail(const char* testName, const std::string& reason) {
+        total++;
+        failed++;
+        std::cout << "  [FAIL] " << testName << ": " << reason << std::endl;
+    }
+
+    void printSummary() {
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "Test Summary: " << passed << "/" << total << " passed";
+        if (failed > 0) {
+            std::cout << " (" << failed << " failed)";
+        }
+        std::cout << "\n========================================" << std::endl;
+    }
+};
+
+//==============================================================================
+// Test: Batch Matches Serial (every engine)
+//==============================================================================
+
+/** A velocity layer and a note range rendered as one batch on four threads
+    must match each note rendered alone, one after another, bit for bit. */
+template <typename Engine>
+bool testBatchMatchesSerial(TestStats& stats, const char* name) {
+    std::cout << "\n[" << name << "] Batch vs. Serial" << std::endl;
+
+    constexpr int numJobs = 12;
+    constexpr int numSamples = 96000;     // Horns speak after about a second
+
+    auto createEngine = [](double sampleRate, int blockSize) {
+        auto engine = std::make_unique<Engine>();
+        engine->prepare(sampleRate, blockSize);
+        return std::unique_ptr<InstrumentDSP>(std::move(engine));
+    };
+
+    GiantBatchSettings settings;
+    settings.numThreads = 4;
+
+    std::vector<std::vector<float>> batchAudio(numJobs * 2, std::vector<float>(numSamples));
+    std::vector<std::vector<float>> serialAudio(numJobs * 2, std::vector<float>(numSamples));
+    std::vector<GiantBatchJob> batchJobs(numJobs);
+    std::vector<GiantBatchResult> batchResults(numJobs);
+
+    for (int j = 0; j < numJobs; ++j) {
+        GiantBatchJob& job = batchJobs[static_cast<size_t>(j)];
+        job.midiNote = (j < numJobs / 2) ? 48 : 36 + 4 * j;
+        job.velocity = (j < numJobs / 2) ? 0.15f * (j + 1) : 0.8f;
+        job.noteOffSample = 72000 + 100 * j;    // Off the block grid
+        job.numSamples = numSamples;
+        job.outputs[0] = batchAudio[static_cast<size_t>(2 * j)].data();
+        job.outputs[1] = batchAudio[static_cast<size_t>(2 * j + 1)].data();
+    }
+
+    GiantBatchRenderer(createEngine, settings).renderBatch(batchJobs.data(), numJobs, batchResults.data());
+
+    // Serial: one thread, one note per call, in reverse order
+    settings.numThreads = 1;
+    const GiantBatchRenderer serial(createEngine, settings);
+
+    bool identical = true;
+    float peak = 0.0f;
+    for (int j = numJobs - 1; j >= 0; --j) {
+        GiantBatchJob job = batchJobs[static_cast<size_t>(j)];
+        job.outputs[0] = serialAudio[static_cast<size_t>(2 * j)].data();
+        job.outputs[1] = serialAudio[static_cast<size_t>(2 * j + 1)].data();
+
+        GiantBatchResult result;
+        serial.renderBatch(&job, 1, &result);
+
+        identical = identical && result.renderedSamples == batchResults[static_cast<size_t>(j)].renderedSamples
+                              && result.peak == batchResults[static_cast<size_t>(j)].peak;
+        for (int ch = 0; ch < 2; ++ch)
+            identical = identical && std::memcmp(serialAudio[static_cast<size_t>(2 * j + ch)].data(),
+                                                 batchAudio[static_cast<size_t>(2 * j + ch)].data(),
+                                                 sizeof(float) * numSamples) == 0;
+        peak = std::max(peak, result.peak);
+    }
+
+    std::cout << "    " << numJobs << " notes, peak " << peak << std::endl;
+
+    if (peak <= 0.0f) {
+        stats.fail(name, "Batch rendered silence");
+        return false;
+    }
+    if (!identical) {
+        stats.fail(name, "Batch render differs from rendering each note alone");
+        return false;
+    }
+
+    stats.pass(name);
+    return true;
+}
+
+//==============================================================================
+// Main Test Runner
+//==============================================================================
+
+int main(int argc, char* argv[]) {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "GiantBatchRenderer Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestStats stats;
+
+    testBatchMatchesSerial<AetherGiantDrumsPureDSP>(stats, "drums_batch");
+    testBatchMatchesSerial<AetherGiantPercussionPureDSP>(stats, "percussion_batch");
+    testBatchMatchesSerial<AetherGiantHornsPureDSP>(stats, "horns_batch");
+    testBatchMatchesSerial<AetherGiantVoicePureDSP>(stats, "voice_batch");
+
+    stats.printSummary();
+
+    return (stats.failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,307 @@
+/*
+  ==============================================================================
+
+    PgoTrainingWorkload.cpp
+
+    Profile-guided optimization training workload and benchmark
+
+    Drives every in-tree giant engine through its headline presets and a
+    typical performance: a mono line, 4-note chords and a full-polyphony
+    cluster, with pitch bend, mod wheel and pressure gestures. The preset
+    list deliberately walks every bore shape, horn type, mallet type and
+    instrument type so the per-sample switches see realistic branch
+    frequencies.
+
+    Run by build_pgo.sh against the instrumented build (training), then
+    against the baseline and optimized builds (benchmark). The last line
+    of output is machine-readable: "TOTAL_RENDER_MS <ms>".
+
+    Usage: PgoTrainingWorkload [--seconds <per preset>]
+
+  ==============================================================================
+*/
+
+#include "JuceStandaloneConfig.h"
+#include <juce_core/juce_core.h>
+#include <juce_dsp/juce_dsp.h>
+#include "../include/dsp/AetherGiantDrumsDSP.h"
+#include "../include/dsp/AetherGiantHornsDSP.h"
+#include "../include/dsp/AetherGiantPercussionDSP.h"
+#include "../include/dsp/AetherGiantVoiceDSP.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace DSP;
+
+namespace {
+
+constexpr double kSampleRate = 48000.0;
+constexpr int kBlockSize = 256;
+
+//==============================================================================
+// Presets
+//==============================================================================
+
+struct PresetValue
+{
+    const char* paramId;
+    float value;
+};
+
+struct TrainingPreset
+{
+    const char* name;
+    std::vector<PresetValue> values;
+};
+
+struct InstrumentWorkload
+{
+    const char* name;
+    std::function<std::unique_ptr<InstrumentDSP>()> create;
+    std::vector<TrainingPreset> presets;
+    int lowestNote;
+    int highestNote;
+    bool sustained;     // Holds notes (horns, voice) vs. one-shot strikes
+    const char* cpuBudgetParam;
+};
+
+std::vector<InstrumentWorkload> makeWorkloads()
+{
+    std::vector<InstrumentWorkload> workloads;
+
+    workloads.push_back({
+        "Giant Drums",
+        [] { return std::make_unique<AetherGiantDrumsPureDSP>(); },
+        {
+            { "Taiko Colossus", { { "membrane_tension", 0.3f }, { "membrane_diameter", 2.5f },
+                                  { "room_size", 0.8f }, { "saturation_amount", 0.2f } } },
+            { "Thunder Kit",    { { "membrane_tension", 0.6f }, { "membrane_diameter", 1.2f },
+                                  { "membrane_inharmonicity", 0.3f }, { "saturation_amount", 0.7f },
+                                  { "reverb_time", 3.0f } } },
+            { "Dry Frame Drum", { { "membrane_tension", 0.8f }, { "membrane_diameter", 0.8f },
+                                  { "room_size", 0.1f }, { "shell_coupling", 0.7f } } }
+        },
+        28, 52, false, "cpu_budget" });
+
+    workloads.push_back({
+        "Giant Horns",
+        [] { return std::make_unique<AetherGiantHornsPureDSP>(); },
+        {
+            { "Titan Tuba",          { { "hornType", 2.0f }, { "boreShape", 3.0f }, { "boreLength", 8.0f },
+                                       { "mouthPressure", 0.6f } } },
+            { "War Horn",            { { "hornType", 5.0f }, { "boreShape", 1.0f }, { "growlAmount", 0.8f },
+                                       { "chaosThreshold", 0.4f }, { "mouthPressure", 0.9f } } },
+            { "Cathedral Trombone",  { { "hornType", 1.0f }, { "boreShape", 0.0f }, { "boreLength", 6.0f } } },
+            { "Mythic Trumpet",      { { "hornType", 0.0f }, { "boreShape", 2.0f }, { "brightness", 0.8f } } },
+            { "Colossal French Horn",{ { "hornType", 3.0f }, { "boreShape", 1.0f }, { "warmth", 0.8f } } },
+            { "Abyssal Sax",         { { "hornType", 4.0f }, { "boreShape", 2.0f }, { "nonlinearity", 0.6f } } }
+        },
+        28, 64, true, "cpuBudget" });
+
+    workloads.push_back({
+        "Giant Percussion",
+        [] { return std::make_unique<AetherGiantPercussionPureDSP>(); },
+        {
+            { "Temple Gong",     { { "instrumentType", 0.0f }, { "malletType", 0.0f }, { "numModes", 32.0f },
+                                   { "sizeMeters", 3.0f } } },
+            { "Cathedral Bell",  { { "instrumentType", 1.0f }, { "malletType", 3.0f }, { "numModes", 24.0f } } },
+            { "Giant Plate",     { { "instrumentType", 2.0f }, { "malletType", 2.0f }, { "numModes", 16.0f } } },
+            { "Tower Chimes",    { { "instrumentType", 3.0f }, { "malletType", 1.0f }, { "numModes", 12.0f } } },
+            { "Singing Bowl",    { { "instrumentType", 4.0f }, { "malletType", 0.0f }, { "numModes", 8.0f } } }
+        },
+        36, 72, false, "cpuBudget" });
+
+    workloads.push_back({
+        "Giant Voice",
+        [] { return std::make_unique<AetherGiantVoicePureDSP>(); },
+        {
+            { "Mountain Chant",  { { "scaleMeters", 8.0f }, { "vowelOpenness", 0.3f }, { "subharmonicMix", 0.6f } } },
+            { "Titan Roar",      { { "aggression", 0.9f }, { "chaosAmount", 0.7f }, { "turbulence", 0.8f } } },
+            { "Choir of Giants", { { "vowelOpenness", 0.7f }, { "formantDrift", 0.5f }, { "breathAttack", 0.4f } } }
+        },
+        36, 60, true, "cpuBudget" });
+
+    return workloads;
+}
+
+//==============================================================================
+// Performance
+//==============================================================================
+
+ScheduledEvent makeNoteOn(int note, float velocity)
+{
+    ScheduledEvent event;
+    event.type = ScheduledEvent::NOTE_ON;
+    event.time = 0.0;
+    event.sampleOffset = 0;
+    event.data.note.midiNote = note;
+    event.data.note.velocity = velocity;
+    return event;
+}
+
+ScheduledEvent makeNoteOff(int note)
+{
+    ScheduledEvent event;
+    event.type = ScheduledEvent::NOTE_OFF;
+    event.time = 0.0;
+    event.sampleOffset = 0;
+    event.data.note.midiNote = note;
+    event.data.note.velocity = 0.0f;
+    return event;
+}
+
+/**
+ * Render one preset: mono line, 4-note chords, then a full-polyphony
+ * cluster, each for a third of the preset time
+ *
+ * @returns Seconds spent inside process()
+ */
+double performPreset(InstrumentDSP& engine, const InstrumentWorkload& workload,
+                     double seconds, std::mt19937& rng)
+{
+    std::vector<float> left(kBlockSize), right(kBlockSize);
+    float* outputs[] = { left.data(), right.data() };
+
+    const int totalBlocks = static_cast<int>(seconds * kSampleRate / kBlockSize);
+    const int blocksPerSection = std::max(1, totalBlocks / 3);
+    const int blocksPerPhrase = std::max(1, static_cast<int>(0.5 * kSampleRate / kBlockSize));
+
+    std::uniform_int_distribution<int> noteDist(workload.lowestNote, workload.highestNote);
+    std::uniform_real_distribution<float> velocityDist(0.3f, 1.0f);
+
+    std::vector<int> held;
+    double renderSeconds = 0.0;
+
+    for (int block = 0; block < totalBlocks; ++block)
+    {
+        const int section = std::min(2, block / blocksPerSection);
+        const int polyphony = section == 0 ? 1 : section == 1 ? 4 : engine.getMaxPolyphony();
+
+        // New phrase: release the previous one, strike/blow the next
+        if (block % blocksPerPhrase == 0)
+        {
+            for (int note : held)
+                engine.handleEvent(makeNoteOff(note));
+            held.clear();
+
+            for (int v = 0; v < polyphony; ++v)
+            {
+                const int note = noteDist(rng);
+                engine.handleEvent(makeNoteOn(note, velocityDist(rng)));
+                held.push_back(note);
+            }
+
+            // Percussive one-shots release immediately and ring out
+            if (!workload.sustained)
+            {
+                for (int note : held)
+                    engine.handleEvent(makeNoteOff(note));
+                held.clear();
+            }
+        }
+
+        // Continuous gestures: slow bend sweep, mod wheel, pressure
+        const float lfo = static_cast<float>(std::sin(block * 0.05));
+
+        ScheduledEvent bend;
+        bend.type = ScheduledEvent::PITCH_BEND;
+        bend.time = 0.0;
+        bend.sampleOffset = 0;
+        bend.data.pitchBend.bendValue = lfo * 0.25f;
+        engine.handleEvent(bend);
+
+        if (block % 8 == 0)
+        {
+            ScheduledEvent modWheel;
+            modWheel.type = ScheduledEvent::CONTROL_CHANGE;
+            modWheel.time = 0.0;
+            modWheel.sampleOffset = 0;
+            modWheel.data.controlChange.controllerNumber = 1;
+            modWheel.data.controlChange.value = 0.5f + 0.5f * lfo;
+            engine.handleEvent(modWheel);
+
+            ScheduledEvent pressure;
+            pressure.type = ScheduledEvent::CHANNEL_PRESSURE;
+            pressure.time = 0.0;
+            pressure.sampleOffset = 0;
+            pressure.data.channelPressure.pressure = 0.6f + 0.4f * lfo;
+            engine.handleEvent(pressure);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        engine.process(outputs, 2, kBlockSize);
+        auto end = std::chrono::steady_clock::now();
+        renderSeconds += std::chrono::duration<double>(end - start).count();
+    }
+
+    for (int note : held)
+        engine.handleEvent(makeNoteOff(note));
+
+    return renderSeconds;
+}
+
+} // namespace
+
+//==============================================================================
+// Main
+//==============================================================================
+
+int main(int argc, char* argv[])
+{
+    double secondsPerPreset = 6.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc)
+            secondsPerPreset = std::max(0.5, std::atof(argv[++i]));
+    }
+
+    std::printf("\n========================================\n");
+    std::printf("Giant Instruments PGO Training Workload\n");
+    std::printf("========================================\n");
+    std::printf("%.1f s per preset, %.0f Hz, %d-sample blocks\n\n",
+                secondsPerPreset, kSampleRate, kBlockSize);
+
+    std::mt19937 rng(1234);  // Same performance on every run
+    double totalRenderSeconds = 0.0;
+
+    for (const auto& workload : makeWorkloads())
+    {
+        double instrumentSeconds = 0.0;
+        double audioSeconds = 0.0;
+
+        for (const auto& preset : workload.presets)
+        {
+            auto engine = workload.create();
+            engine->prepare(kSampleRate, kBlockSize);
+
+            // Keep the CPU governor from degrading quality in slow
+            // instrumented builds; the profile must see full-quality paths
+            engine->setParameter(workload.cpuBudgetParam, 1.0f);
+
+            for (const auto& value : preset.values)
+                engine->setParameter(value.paramId, value.value);
+
+            const double rendered = performPreset(*engine, workload, secondsPerPreset, rng);
+            instrumentSeconds += rendered;
+            audioSeconds += secondsPerPreset;
+
+            std::printf("  %-18s %-22s %9.2f ms\n", workload.name, preset.name, rendered * 1000.0);
+        }
+
+        std::printf("  %-18s %-22s %9.2f ms  (%.1fx realtime)\n\n", workload.name, "[all presets]",
+                    instrumentSeconds * 1000.0, audioSeconds / std::max(instrumentSeconds, 1.0e-9));
+        totalRenderSeconds += instrumentSeconds;
+    }
+
+    std::printf("TOTAL_RENDER_MS %.3f\n", totalRenderSeconds * 1000.0);
+    return 0;
+}
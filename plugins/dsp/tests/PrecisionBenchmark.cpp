@@ -0,0 +1,171 @@
+/*
+  ==============================================================================
+
+    PrecisionBenchmark.cpp
+
+    Float vs double benchmark for long giant decays
+
+    Renders the modal recurrence used by ModalResonatorMode (TPT SVF bandpass
+    driven by a per-sample amplitude decay) at float and double precision and
+    reports:
+    - render cost per precision
+    - envelope drift against the closed-form decay after a long tail
+    - realtime factor of the Percussion engine (double-precision state)
+
+  ==============================================================================
+*/
+
+#include "JuceStandaloneConfig.h"
+#include <juce_core/juce_core.h>
+#include <juce_dsp/juce_dsp.h>
+#include "../include/dsp/AetherGiantPercussionDSP.h"
+#include <iostream>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace DSP;
+
+namespace {
+
+constexpr double kSampleRate = 48000.0;
+constexpr int kNumModes = 32;
+constexpr double kTailSeconds = 30.0;
+
+//==============================================================================
+// Modal recurrence templated on state precision
+//==============================================================================
+
+template <typename T>
+struct ModalModel
+{
+    std::vector<juce::dsp::StateVariableTPTFilter<T>> filters;
+    std::vector<T> amplitude;
+    std::vector<T> decay;
+
+    void prepare()
+    {
+        filters.resize(kNumModes);
+        amplitude.assign(kNumModes, T(1));
+        decay.assign(kNumModes, T(0));
+
+        for (int i = 0; i < kNumModes; ++i)
+        {
+            auto& svf = filters[i];
+            svf.prepare({ kSampleRate, 512u, 1u });
+            svf.setType(juce::dsp::StateVariableTPTFilterType::bandpass);
+            svf.setCutoffFrequency(static_cast<T>(40.0 * (i + 1)));
+            svf.setResonance(static_cast<T>(20.0));
+
+            // Giant gong tails: 0.99990 .. 0.99999
+            decay[i] = static_cast<T>(0.99999 - 0.0000029 * i);
+            svf.processSample(0, T(0.5));
+        }
+    }
+
+    T processSample()
+    {
+        T out = T(0);
+        for (int i = 0; i < kNumModes; ++i)
+        {
+            out += filters[i].processSample(0, T(0)) * amplitude[i];
+            amplitude[i] *= decay[i];
+        }
+        return out;
+    }
+};
+
+template <typename T>
+double renderModel(ModalModel<T>& model, int numSamples, double& checksum)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    T sum = T(0);
+    for (int n = 0; n < numSamples; ++n)
+        sum += std::abs(model.processSample());
+
+    auto end = std::chrono::steady_clock::now();
+    checksum = static_cast<double>(sum);
+    return std::chrono::duration<double>(end - start).count();
+}
+
+/** Worst relative envelope error (dB) against the closed-form decay */
+template <typename T>
+double worstEnvelopeErrorDb(const ModalModel<T>& model, int numSamples)
+{
+    double worst = 0.0;
+    for (int i = 0; i < kNumModes; ++i)
+    {
+        const double exact = std::pow(static_cast<double>(model.decay[i]), numSamples);
+        const double actual = static_cast<double>(model.amplitude[i]);
+        const double relError = std::abs(actual - exact) / exact;
+        worst = std::max(worst, relError);
+    }
+    return 20.0 * std::log10(std::max(worst, 1.0e-300));
+}
+
+} // namespace
+
+//==============================================================================
+// Main
+//==============================================================================
+
+int main()
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Giant Instruments Precision Benchmark" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    const int numSamples = static_cast<int>(kTailSeconds * kSampleRate);
+
+    ModalModel<float> floatModel;
+    ModalModel<double> doubleModel;
+    floatModel.prepare();
+    doubleModel.prepare();
+
+    double floatChecksum = 0.0;
+    double doubleChecksum = 0.0;
+    const double floatTime = renderModel(floatModel, numSamples, floatChecksum);
+    const double doubleTime = renderModel(doubleModel, numSamples, doubleChecksum);
+
+    std::printf("\nModal recurrence (%d modes, %.0f s tail)\n", kNumModes, kTailSeconds);
+    std::printf("  float : %8.3f ms   envelope error %7.1f dB\n",
+                floatTime * 1000.0, worstEnvelopeErrorDb(floatModel, numSamples));
+    std::printf("  double: %8.3f ms   envelope error %7.1f dB\n",
+                doubleTime * 1000.0, worstEnvelopeErrorDb(doubleModel, numSamples));
+    std::printf("  double/float cost ratio: %.2fx\n", doubleTime / floatTime);
+
+    // Full engine (double-precision modal state)
+    AetherGiantPercussionPureDSP engine;
+    engine.prepare(kSampleRate, 512);
+    engine.setParameter("numModes", 32.0f);
+    engine.setParameter("sizeMeters", 4.0f);
+    engine.setParameter("damping", 0.1f);
+
+    ScheduledEvent noteOn;
+    noteOn.type = ScheduledEvent::NOTE_ON;
+    noteOn.time = 0.0;
+    noteOn.sampleOffset = 0;
+    noteOn.data.note.midiNote = 36;
+    noteOn.data.note.velocity = 1.0f;
+    engine.handleEvent(noteOn);
+
+    std::vector<float> left(512), right(512);
+    float* outputs[] = { left.data(), right.data() };
+
+    auto start = std::chrono::steady_clock::now();
+    for (int offset = 0; offset < numSamples; offset += 512)
+        engine.process(outputs, 2, std::min(512, numSamples - offset));
+    auto end = std::chrono::steady_clock::now();
+
+    const double engineTime = std::chrono::duration<double>(end - start).count();
+    std::printf("\nPercussion engine, %.0f s gong tail: %.3f ms (%.1fx realtime)\n",
+                kTailSeconds, engineTime * 1000.0, kTailSeconds / engineTime);
+
+    // Keep the optimizer honest
+    std::printf("\n(checksums %.6g / %.6g)\n", floatChecksum, doubleChecksum);
+
+    return 0;
+}
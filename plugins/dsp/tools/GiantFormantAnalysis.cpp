@@ -0,0 +1,380 @@
+/*
+  ==============================================================================
+
+    GiantFormantAnalysis.cpp
+
+    Offline formant and pitch analysis for the Giant Voice engine
+
+    Frames for a .gftraj trajectory (GiantFormantTrajectory.h). Nothing
+    here runs in the plugin:
+    - mono input, decimated to ~11 kHz (the formants of interest sit below 5 kHz)
+    - formants: pre-emphasis, Hamming window, autocorrelation LPC
+      (Levinson-Durbin), roots of the predictor polynomial -> frequency and
+      bandwidth of the four lowest resonances
+    - pitch: normalized autocorrelation, voiced above a clarity threshold,
+      3-frame median filtered; the median voiced pitch is stored as the
+      phrase's reference so the engine can transpose it to any note
+    - level: frame RMS relative to the phrase peak
+
+  ==============================================================================
+*/
+
+#include "GiantFormantAnalysis.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <iterator>
+#include <vector>
+
+namespace DSP {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kAnalysisRate = 11025.0;     // Target rate after decimation
+constexpr double kLpcWindowSeconds = 0.025;
+constexpr double kPitchWindowSeconds = 0.040;  // Two periods at the lowest pitch
+constexpr double kMinPitchHz = 50.0;
+constexpr double kMaxPitchHz = 600.0;
+constexpr double kVoicingClarity = 0.5;        // Normalized autocorrelation peak
+constexpr double kAnalysisFloor = 0.01;        // Frames 40 dB under the peak hold the last values
+constexpr double kMinFormantHz = 90.0;
+constexpr double kMaxBandwidthHz = 600.0;
+constexpr int kDecimationTaps = 63;
+
+using Frame = GiantFormantTrajectory::Frame;
+constexpr int kNumFormants = GiantFormantTrajectory::numFormants;
+
+// Adult male "Ah": used until the first frame with a full set of formants
+constexpr float kDefaultFormants[kNumFormants] = { 730.0f, 1090.0f, 2440.0f, 3400.0f };
+constexpr float kDefaultBandwidths[kNumFormants] = { 80.0f, 90.0f, 120.0f, 130.0f };
+
+//==============================================================================
+// Signal preparation
+//==============================================================================
+
+/** Low-pass (Blackman-windowed sinc) and keep every factor-th sample */
+std::vector<float> decimate(const std::vector<float>& input, int factor)
+{
+    if (factor <= 1)
+        return input;
+
+    std::vector<double> taps(kDecimationTaps);
+    const int centre = kDecimationTaps / 2;
+    const double cutoff = 0.45 / factor;  // Cycles per input sample
+    double sum = 0.0;
+    for (int i = 0; i < kDecimationTaps; ++i)
+    {
+        const int n = i - centre;
+        const double sinc = (n == 0) ? 2.0 * cutoff : std::sin(2.0 * kPi * cutoff * n) / (kPi * n);
+        const double window = 0.42 - 0.5 * std::cos(2.0 * kPi * i / (kDecimationTaps - 1))
+                            + 0.08 * std::cos(4.0 * kPi * i / (kDecimationTaps - 1));
+        taps[i] = sinc * window;
+        sum += taps[i];
+    }
+
+    std::vector<float> output(input.size() / static_cast<size_t>(factor));
+    for (size_t o = 0; o < output.size(); ++o)
+    {
+        const long long centreIndex = static_cast<long long>(o) * factor;
+        double acc = 0.0;
+        for (int t = 0; t < kDecimationTaps; ++t)
+        {
+            const long long index = centreIndex + t - centre;
+            if (index >= 0 && index < static_cast<long long>(input.size()))
+                acc += taps[t] * input[static_cast<size_t>(index)];
+        }
+        output[o] = static_cast<float>(acc / sum);
+    }
+    return output;
+}
+
+/** Window of signal centred on a sample (zero outside the signal) */
+std::vector<double> extractFrame(const std::vector<float>& signal, long long centre, int length)
+{
+    std::vector<double> frame(static_cast<size_t>(length), 0.0);
+    const long long start = centre - length / 2;
+    for (int i = 0; i < length; ++i)
+    {
+        const long long index = start + i;
+        if (index >= 0 && index < static_cast<long long>(signal.size()))
+            frame[static_cast<size_t>(i)] = signal[static_cast<size_t>(index)];
+    }
+    return frame;
+}
+
+double rms(const std::vector<double>& frame)
+{
+    double energy = 0.0;
+    for (double x : frame)
+        energy += x * x;
+    return std::sqrt(energy / std::max<size_t>(1, frame.size()));
+}
+
+//==============================================================================
+// Formants (LPC)
+//==============================================================================
+
+/** Levinson-Durbin on the autocorrelation of a windowed frame
+    @returns    Predictor polynomial A(z) = 1 + a1 z^-1 + ... (order + 1 values),
+                empty for a silent frame */
+std::vector<double> lpc(const std::vector<double>& frame, int order)
+{
+    std::vector<double> r(static_cast<size_t>(order) + 1, 0.0);
+    for (int lag = 0; lag <= order; ++lag)
+        for (size_t i = static_cast<size_t>(lag); i < frame.size(); ++i)
+            r[static_cast<size_t>(lag)] += frame[i] * frame[i - static_cast<size_t>(lag)];
+
+    if (r[0] <= 0.0)
+        return {};
+
+    r[0] *= 1.0 + 1.0e-4;  // -40 dB noise floor keeps the recursion stable
+
+    std::vector<double> a(static_cast<size_t>(order) + 1, 0.0);
+    std::vector<double> previous(a.size());
+    a[0] = 1.0;
+    double error = r[0];
+
+    for (int i = 1; i <= order; ++i)
+    {
+        double acc = r[static_cast<size_t>(i)];
+        for (int j = 1; j < i; ++j)
+            acc += a[static_cast<size_t>(j)] * r[static_cast<size_t>(i - j)];
+
+        const double k = -acc / error;
+        previous = a;
+        for (int j = 1; j < i; ++j)
+            a[static_cast<size_t>(j)] = previous[static_cast<size_t>(j)] + k * previous[static_cast<size_t>(i - j)];
+        a[static_cast<size_t>(i)] = k;
+
+        error *= 1.0 - k * k;
+        if (error <= 0.0)
+            return {};
+    }
+    return a;
+}
+
+/** Roots of z^p + a1 z^(p-1) + ... + ap (Durand-Kerner) */
+std::vector<std::complex<double>> polynomialRoots(const std::vector<double>& a)
+{
+    const int degree = static_cast<int>(a.size()) - 1;
+    std::vector<std::complex<double>> roots(static_cast<size_t>(degree));
+    const std::complex<double> seed(0.4, 0.9);
+    roots[0] = 1.0;
+    for (int i = 1; i < degree; ++i)
+        roots[static_cast<size_t>(i)] = roots[static_cast<size_t>(i - 1)] * seed;
+
+    auto evaluate = [&a](std::complex<double> z)
+    {
+        std::complex<double> value = a[0];
+        for (size_t i = 1; i < a.size(); ++i)
+            value = value * z + a[i];
+        return value;
+    };
+
+    for (int iteration = 0; iteration < 500; ++iteration)
+    {
+        double largestStep = 0.0;
+        for (int i = 0; i < degree; ++i)
+        {
+            std::complex<double> denominator = 1.0;
+            for (int j = 0; j < degree; ++j)
+                if (j != i)
+                    denominator *= roots[static_cast<size_t>(i)] - roots[static_cast<size_t>(j)];
+
+            const auto step = evaluate(roots[static_cast<size_t>(i)]) / denominator;
+            roots[static_cast<size_t>(i)] -= step;
+            largestStep = std::max(largestStep, std::abs(step));
+        }
+
+        if (largestStep < 1.0e-12)
+            break;
+    }
+    return roots;
+}
+
+/** Four lowest resonances of a frame
+    @returns    false if fewer than four usable poles were found */
+bool findFormants(const std::vector<double>& frame, double sampleRate, int order,
+                  float* formantHz, float* bandwidthHz)
+{
+    // Pre-emphasis (+6 dB/octave) flattens the glottal tilt so F3/F4 get poles
+    std::vector<double> emphasized(frame.size());
+    for (size_t i = 0; i < frame.size(); ++i)
+    {
+        const double previous = (i > 0) ? frame[i - 1] : 0.0;
+        const double window = 0.54 - 0.46 * std::cos(2.0 * kPi * i / (frame.size() - 1));
+        emphasized[i] = (frame[i] - 0.97 * previous) * window;
+    }
+
+    const auto a = lpc(emphasized, order);
+    if (a.empty())
+        return false;
+
+    struct Resonance { double frequency, bandwidth; };
+    std::vector<Resonance> resonances;
+
+    for (const auto& root : polynomialRoots(a))
+    {
+        if (root.imag() <= 0.0)
+            continue;
+
+        const double frequency = std::arg(root) * sampleRate / (2.0 * kPi);
+        const double bandwidth = -std::log(std::abs(root)) * sampleRate / kPi;
+        if (frequency > kMinFormantHz && frequency < 0.5 * sampleRate - 50.0
+            && bandwidth > 0.0 && bandwidth < kMaxBandwidthHz)
+        {
+            resonances.push_back({ frequency, bandwidth });
+        }
+    }
+
+    if (static_cast<int>(resonances.size()) < kNumFormants)
+        return false;
+
+    std::sort(resonances.begin(), resonances.end(),
+              [](const Resonance& x, const Resonance& y) { return x.frequency < y.frequency; });
+
+    for (int i = 0; i < kNumFormants; ++i)
+    {
+        formantHz[i] = static_cast<float>(resonances[static_cast<size_t>(i)].frequency);
+        bandwidthHz[i] = static_cast<float>(resonances[static_cast<size_t>(i)].bandwidth);
+    }
+    return true;
+}
+
+//==============================================================================
+// Pitch
+//==============================================================================
+
+/** Pitch of a frame by normalized autocorrelation
+    @returns    Hz, or 0 if unvoiced */
+float findPitch(const std::vector<double>& frame, double sampleRate)
+{
+    const int minLag = static_cast<int>(sampleRate / kMaxPitchHz);
+    const int maxLag = std::min(static_cast<int>(sampleRate / kMinPitchHz),
+                                static_cast<int>(frame.size()) / 2);
+    if (maxLag <= minLag + 2)
+        return 0.0f;
+
+    std::vector<double> clarity(static_cast<size_t>(maxLag) + 2, 0.0);
+    for (int lag = minLag - 1; lag <= maxLag + 1; ++lag)
+    {
+        double cross = 0.0, energyA = 0.0, energyB = 0.0;
+        for (size_t i = 0; i + static_cast<size_t>(lag) < frame.size(); ++i)
+        {
+            cross += frame[i] * frame[i + static_cast<size_t>(lag)];
+            energyA += frame[i] * frame[i];
+            energyB += frame[i + static_cast<size_t>(lag)] * frame[i + static_cast<size_t>(lag)];
+        }
+        clarity[static_cast<size_t>(lag)] = cross / std::sqrt(std::max(energyA * energyB, 1.0e-30));
+    }
+
+    double best = 0.0;
+    for (int lag = minLag; lag <= maxLag; ++lag)
+        best = std::max(best, clarity[static_cast<size_t>(lag)]);
+
+    if (best < kVoicingClarity)
+        return 0.0f;
+
+    // Shortest lag that is a local peak within 10% of the best: avoids
+    // picking a multiple of the period (octave-down errors)
+    for (int lag = minLag; lag <= maxLag; ++lag)
+    {
+        const double c = clarity[static_cast<size_t>(lag)];
+        if (c >= 0.9 * best && c >= clarity[static_cast<size_t>(lag - 1)]
+            && c >= clarity[static_cast<size_t>(lag + 1)])
+        {
+            // Parabolic interpolation of the peak
+            const double left = clarity[static_cast<size_t>(lag - 1)];
+            const double right = clarity[static_cast<size_t>(lag + 1)];
+            const double curvature = left - 2.0 * c + right;
+            const double offset = (curvature < 0.0) ? 0.5 * (left - right) / curvature : 0.0;
+            return static_cast<float>(sampleRate / (lag + offset));
+        }
+    }
+    return 0.0f;
+}
+
+} // namespace
+
+//==============================================================================
+// GiantFormantAnalysis Implementation
+//==============================================================================
+
+GiantFormantAnalysis GiantFormantAnalysis::analyze(const std::vector<float>& input, double inputRate, float frameRate)
+{
+    const int factor = std::max(1, static_cast<int>(std::lround(inputRate / kAnalysisRate)));
+    const auto signal = decimate(input, factor);
+    const double sampleRate = inputRate / factor;
+
+    const int lpcOrder = 2 + static_cast<int>(sampleRate / 1000.0);
+    const int lpcLength = static_cast<int>(kLpcWindowSeconds * sampleRate);
+    const int pitchLength = static_cast<int>(kPitchWindowSeconds * sampleRate);
+    const int numFrames = std::max(1, static_cast<int>(signal.size() / sampleRate * frameRate));
+
+    GiantFormantAnalysis analysis;
+    analysis.frames.resize(static_cast<size_t>(numFrames));
+
+    float lastFormants[kNumFormants];
+    float lastBandwidths[kNumFormants];
+    std::copy(std::begin(kDefaultFormants), std::end(kDefaultFormants), lastFormants);
+    std::copy(std::begin(kDefaultBandwidths), std::end(kDefaultBandwidths), lastBandwidths);
+
+    auto frameCentre = [&](int k) { return std::llround(k * sampleRate / frameRate); };
+
+    // Levels first: the analysis floor is relative to the phrase peak
+    float peakLevel = 0.0f;
+    for (int k = 0; k < numFrames; ++k)
+    {
+        Frame& frame = analysis.frames[static_cast<size_t>(k)];
+        frame.level = static_cast<float>(rms(extractFrame(signal, frameCentre(k), lpcLength)));
+        peakLevel = std::max(peakLevel, frame.level);
+    }
+
+    for (int k = 0; k < numFrames; ++k)
+    {
+        Frame& frame = analysis.frames[static_cast<size_t>(k)];
+        const bool audible = frame.level > kAnalysisFloor * peakLevel;
+
+        // Quiet or unresolved frames hold the previous formants
+        if (audible)
+            findFormants(extractFrame(signal, frameCentre(k), lpcLength), sampleRate, lpcOrder,
+                         lastFormants, lastBandwidths);
+        std::copy(lastFormants, lastFormants + kNumFormants, frame.formantHz);
+        std::copy(lastBandwidths, lastBandwidths + kNumFormants, frame.bandwidthHz);
+
+        frame.f0 = audible ? findPitch(extractFrame(signal, frameCentre(k), pitchLength), sampleRate) : 0.0f;
+    }
+
+    // Median of three removes isolated octave jumps and voicing flickers
+    std::vector<float> rawPitch(static_cast<size_t>(numFrames));
+    for (int k = 0; k < numFrames; ++k)
+        rawPitch[static_cast<size_t>(k)] = analysis.frames[static_cast<size_t>(k)].f0;
+
+    std::vector<float> voiced;
+    for (int k = 1; k + 1 < numFrames; ++k)
+    {
+        float window[3] = { rawPitch[static_cast<size_t>(k - 1)], rawPitch[static_cast<size_t>(k)],
+                            rawPitch[static_cast<size_t>(k + 1)] };
+        std::sort(window, window + 3);
+        analysis.frames[static_cast<size_t>(k)].f0 = window[1];
+    }
+
+    for (auto& frame : analysis.frames)
+    {
+        if (frame.f0 > 0.0f)
+            voiced.push_back(frame.f0);
+        if (peakLevel > 0.0f)
+            frame.level /= peakLevel;
+    }
+
+    if (!voiced.empty())
+    {
+        std::nth_element(voiced.begin(), voiced.begin() + static_cast<long>(voiced.size() / 2), voiced.end());
+        analysis.referenceF0 = voiced[voiced.size() / 2];
+    }
+
+    return analysis;
+}
+
+}  // namespace DSP
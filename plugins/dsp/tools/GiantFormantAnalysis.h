@@ -0,0 +1,36 @@
+/*
+  ==============================================================================
+
+    GiantFormantAnalysis.h
+
+    Offline formant and pitch analysis for the Giant Voice engine
+
+    The analysis behind GiantFormantAnalyzer, kept free of file I/O so the
+    analyzer -> .gftraj -> GiantFormantTrajectory round trip can be tested.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../include/dsp/GiantFormantTrajectory.h"
+#include <vector>
+
+namespace DSP {
+
+//==============================================================================
+/**
+ * Frames of an analyzed vocal phrase
+ */
+struct GiantFormantAnalysis
+{
+    std::vector<GiantFormantTrajectory::Frame> frames;
+    float referenceF0 = 0.0f;           // Median voiced pitch (Hz, 0 = none voiced)
+
+    /** Analyze a mono phrase
+        @param input        Samples at inputRate
+        @param frameRate    Frames per second in the result */
+    static GiantFormantAnalysis analyze(const std::vector<float>& input, double inputRate, float frameRate);
+};
+
+}  // namespace DSP
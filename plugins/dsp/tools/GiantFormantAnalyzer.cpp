@@ -0,0 +1,103 @@
+/*
+  ==============================================================================
+
+    GiantFormantAnalyzer.cpp
+
+    Offline formant and pitch analysis for the Giant Voice engine
+
+    Reads a recorded vocal phrase, runs GiantFormantAnalysis over its mono
+    mix and writes the .gftraj trajectory (GiantFormantTrajectory.h) that
+    AetherGiantVoicePureDSP follows at control rate.
+
+    Usage: GiantFormantAnalyzer <input audio> <output.gftraj> [--rate <frames/s>]
+
+  ==============================================================================
+*/
+
+#include "JuceStandaloneConfig.h"
+#include <juce_core/juce_core.h>
+#include <juce_audio_formats/juce_audio_formats.h>
+#include "GiantFormantAnalysis.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace DSP;
+
+namespace {
+
+bool readMono(const juce::File& file, std::vector<float>& samples, double& sampleRate)
+{
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+
+    std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(file));
+    if (reader == nullptr || reader->lengthInSamples <= 0)
+        return false;
+
+    const int numChannels = static_cast<int>(reader->numChannels);
+    const int length = static_cast<int>(reader->lengthInSamples);
+    juce::AudioBuffer<float> buffer(numChannels, length);
+    reader->read(&buffer, 0, length, 0, true, true);
+
+    samples.assign(static_cast<size_t>(length), 0.0f);
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const float* channel = buffer.getReadPointer(ch);
+        for (int i = 0; i < length; ++i)
+            samples[static_cast<size_t>(i)] += channel[i] / numChannels;
+    }
+
+    sampleRate = reader->sampleRate;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        std::fprintf(stderr, "Usage: GiantFormantAnalyzer <input audio> <output.gftraj> [--rate <frames/s>]\n");
+        return 1;
+    }
+
+    float frameRate = 200.0f;
+    for (int i = 3; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--rate") == 0 && i + 1 < argc)
+            frameRate = static_cast<float>(std::max(10.0, std::min(1000.0, std::atof(argv[++i]))));
+    }
+
+    const auto cwd = juce::File::getCurrentWorkingDirectory();
+    const auto input = cwd.getChildFile(argv[1]);
+    const auto output = cwd.getChildFile(argv[2]);
+
+    std::vector<float> samples;
+    double sampleRate = 0.0;
+    if (!readMono(input, samples, sampleRate))
+    {
+        std::fprintf(stderr, "Could not read %s\n", argv[1]);
+        return 1;
+    }
+
+    const auto analysis = GiantFormantAnalysis::analyze(samples, sampleRate, frameRate);
+
+    if (!GiantFormantTrajectory::write(output, frameRate, analysis.referenceF0, analysis.frames))
+    {
+        std::fprintf(stderr, "Could not write %s\n", argv[2]);
+        return 1;
+    }
+
+    int voicedFrames = 0;
+    for (const auto& frame : analysis.frames)
+        voicedFrames += (frame.f0 > 0.0f) ? 1 : 0;
+
+    std::printf("%s: %.2f s, %zu frames at %.0f/s (%d voiced), reference pitch %.1f Hz, %zu bytes\n",
+                argv[2], samples.size() / sampleRate, analysis.frames.size(), frameRate, voicedFrames,
+                analysis.referenceF0,
+                sizeof(GiantFormantTrajectory::FileHeader) + analysis.frames.size() * sizeof(GiantFormantTrajectory::Frame));
+    return 0;
+}
@@ -0,0 +1,259 @@
+/*
+  ==============================================================================
+
+    GiantOfflineRender.cpp
+
+    Command-line bounce of a MIDI file through a Giant Instruments engine,
+    rendered chunk-parallel on all cores (GiantChunkRenderer.h)
+
+    The MIDI file's tracks are merged and played through one engine; the
+    render runs past the last event by --tail seconds so giant decays are
+    not cut off. --verify renders the cue a second time serially and
+    reports the largest sample difference, which tells whether the chosen
+    pre-roll is long enough for the cue.
+
+    Usage: GiantOfflineRender <drums|horns|percussion|voice> <input.mid> <output.wav>
+                              [--preset <file.json>] [--rate <Hz>] [--block <samples>]
+                              [--chunk <s>] [--preroll <s>] [--crossfade <s>]
+                              [--threads <n>] [--tail <s>] [--verify]
+
+  ==============================================================================
+*/
+
+#include "JuceStandaloneConfig.h"
+#include <juce_core/juce_core.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_audio_formats/juce_audio_formats.h>
+#include "../include/dsp/AetherGiantDrumsDSP.h"
+#include "../include/dsp/AetherGiantHornsDSP.h"
+#include "../include/dsp/AetherGiantPercussionDSP.h"
+#include "../include/dsp/AetherGiantVoiceDSP.h"
+#include "../include/dsp/GiantChunkRenderer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace DSP;
+
+namespace {
+
+std::unique_ptr<InstrumentDSP> createEngine(const std::string& name)
+{
+    if (name == "drums")      return std::make_unique<AetherGiantDrumsPureDSP>();
+    if (name == "horns")      return std::make_unique<AetherGiantHornsPureDSP>();
+    if (name == "percussion") return std::make_unique<AetherGiantPercussionPureDSP>();
+    if (name == "voice")      return std::make_unique<AetherGiantVoicePureDSP>();
+    return nullptr;
+}
+
+/** MIDI file -> engine events (same mapping as the plugin processor)
+    @returns    false if the file could not be read */
+bool readTimeline(const juce::File& file, double sampleRate,
+                  std::vector<GiantTimelineEvent>& events, double& lastEventSeconds)
+{
+    juce::FileInputStream stream(file);
+    juce::MidiFile midi;
+    if (!stream.openedOk() || !midi.readFrom(stream))
+        return false;
+
+    midi.convertTimestampTicksToSeconds();
+
+    juce::MidiMessageSequence merged;
+    for (int t = 0; t < midi.getNumTracks(); ++t)
+        merged.addSequence(*midi.getTrack(t), 0.0);
+
+    lastEventSeconds = 0.0;
+    for (const auto* holder : merged)
+    {
+        const auto& message = holder->message;
+
+        GiantTimelineEvent timed;
+        timed.samplePosition = static_cast<int64_t>(std::llround(message.getTimeStamp() * sampleRate));
+        ScheduledEvent& event = timed.event;
+        event.time = message.getTimeStamp();
+        event.sampleOffset = 0;
+
+        if (message.isNoteOn())
+        {
+            event.type = ScheduledEvent::NOTE_ON;
+            event.data.note.midiNote = message.getNoteNumber();
+            event.data.note.velocity = message.getVelocity() / 127.0f;
+        }
+        else if (message.isNoteOff())
+        {
+            event.type = ScheduledEvent::NOTE_OFF;
+            event.data.note.midiNote = message.getNoteNumber();
+            event.data.note.velocity = 0.0f;
+        }
+        else if (message.isPitchWheel())
+        {
+            event.type = ScheduledEvent::PITCH_BEND;
+            event.data.pitchBend.bendValue = (message.getPitchWheelValue() - 8192) / 8192.0f;
+        }
+        else if (message.isController())
+        {
+            event.type = ScheduledEvent::CONTROL_CHANGE;
+            event.data.controlChange.controllerNumber = message.getControllerNumber();
+            event.data.controlChange.value = message.getControllerValue() / 127.0f;
+        }
+        else if (message.isChannelPressure())
+        {
+            event.type = ScheduledEvent::CHANNEL_PRESSURE;
+            event.data.channelPressure.pressure = message.getChannelPressureValue() / 127.0f;
+        }
+        else
+        {
+            continue;
+        }
+
+        events.push_back(timed);
+        lastEventSeconds = std::max(lastEventSeconds, message.getTimeStamp());
+    }
+
+    return true;
+}
+
+bool writeWav(const juce::File& file, const std::vector<std::vector<float>>& channels, double sampleRate)
+{
+    file.deleteFile();
+    auto stream = std::make_unique<juce::FileOutputStream>(file);
+    if (!stream->openedOk())
+        return false;
+
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatWriter> writer(
+        wav.createWriterFor(stream.get(), sampleRate, static_cast<unsigned int>(channels.size()), 24, {}, 0));
+    if (writer == nullptr)
+        return false;
+    stream.release();   // Owned by the writer now
+
+    const int64_t numSamples = channels.empty() ? 0 : static_cast<int64_t>(channels[0].size());
+    constexpr int64_t writeBlock = 65536;
+
+    for (int64_t start = 0; start < numSamples; start += writeBlock)
+    {
+        const int n = static_cast<int>(std::min(writeBlock, numSamples - start));
+        const float* pointers[2] = {};
+        for (size_t ch = 0; ch < channels.size() && ch < 2; ++ch)
+            pointers[ch] = channels[ch].data() + start;
+
+        if (!writer->writeFromFloatArrays(pointers, static_cast<int>(channels.size()), n))
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 4)
+    {
+        std::fprintf(stderr,
+            "Usage: GiantOfflineRender <drums|horns|percussion|voice> <input.mid> <output.wav>\n"
+            "                          [--preset <file.json>] [--rate <Hz>] [--block <samples>]\n"
+            "                          [--chunk <s>] [--preroll <s>] [--crossfade <s>]\n"
+            "                          [--threads <n>] [--tail <s>] [--verify]\n");
+        return 1;
+    }
+
+    const std::string engineName = argv[1];
+    if (createEngine(engineName) == nullptr)
+    {
+        std::fprintf(stderr, "Unknown engine %s\n", argv[1]);
+        return 1;
+    }
+
+    GiantChunkRenderSettings settings;
+    double tailSeconds = 10.0;
+    const char* presetPath = nullptr;
+
+    for (int i = 4; i < argc; ++i)
+    {
+        const bool hasValue = (i + 1 < argc);
+        if (std::strcmp(argv[i], "--preset") == 0 && hasValue)
+            presetPath = argv[++i];
+        else if (std::strcmp(argv[i], "--rate") == 0 && hasValue)
+            settings.sampleRate = std::max(8000.0, std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--block") == 0 && hasValue)
+            settings.blockSize = std::max(16, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--chunk") == 0 && hasValue)
+            settings.chunkSeconds = std::max(1.0, std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--preroll") == 0 && hasValue)
+            settings.prerollSeconds = std::max(0.0, std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--crossfade") == 0 && hasValue)
+            settings.crossfadeSeconds = std::max(0.0, std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--threads") == 0 && hasValue)
+            settings.numThreads = std::max(0, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--tail") == 0 && hasValue)
+            tailSeconds = std::max(0.0, std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--verify") == 0)
+            settings.verify = true;
+    }
+
+    const auto cwd = juce::File::getCurrentWorkingDirectory();
+
+    std::string preset;
+    if (presetPath != nullptr)
+    {
+        const auto presetFile = cwd.getChildFile(presetPath);
+        if (!presetFile.existsAsFile())
+        {
+            std::fprintf(stderr, "Could not read %s\n", presetPath);
+            return 1;
+        }
+        preset = presetFile.loadFileAsString().toStdString();
+    }
+
+    std::vector<GiantTimelineEvent> events;
+    double lastEventSeconds = 0.0;
+    if (!readTimeline(cwd.getChildFile(argv[2]), settings.sampleRate, events, lastEventSeconds))
+    {
+        std::fprintf(stderr, "Could not read %s\n", argv[2]);
+        return 1;
+    }
+
+    GiantChunkRenderer renderer(
+        [&engineName, &preset](double sampleRate, int blockSize)
+        {
+            auto engine = createEngine(engineName);
+            engine->prepare(sampleRate, blockSize);
+            if (!preset.empty())
+                engine->loadPreset(preset.c_str());
+            return engine;
+        },
+        settings);
+
+    const auto numSamples = static_cast<int64_t>(std::ceil((lastEventSeconds + tailSeconds) * settings.sampleRate));
+
+    std::vector<std::vector<float>> output;
+    const auto report = renderer.render(events, numSamples, output);
+
+    if (!writeWav(cwd.getChildFile(argv[3]), output, settings.sampleRate))
+    {
+        std::fprintf(stderr, "Could not write %s\n", argv[3]);
+        return 1;
+    }
+
+    const double audioSeconds = static_cast<double>(numSamples) / settings.sampleRate;
+    std::printf("%s: %.1f s of audio, %d chunks on %d threads in %.2f s (%.1fx realtime), seam error %.3g\n",
+                argv[3], audioSeconds, report.numChunks, report.numThreads, report.renderSeconds,
+                audioSeconds / std::max(1.0e-9, report.renderSeconds), report.maxSeamDifference);
+
+    if (report.verified)
+    {
+        const double dB = 20.0 * std::log10(std::max(1.0e-12f, report.maxDifference));
+        std::printf("verify: serial render %.2f s (%.2fx speed-up), max difference %.3g (%.1f dBFS) at %.3f s\n",
+                    report.serialRenderSeconds, report.serialRenderSeconds / std::max(1.0e-9, report.renderSeconds),
+                    report.maxDifference, dB,
+                    static_cast<double>(report.maxDifferencePosition) / settings.sampleRate);
+    }
+
+    return 0;
+}